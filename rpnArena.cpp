@@ -0,0 +1,171 @@
+#include "rpnArena.h"
+#include <cstring>
+#include <utility>
+//-------------------------------------------------------------------------------------------
+//    Class:		CRPNArena
+//
+//    File:			rpnArena.cpp
+//
+//    Description:	This file contains the function definitions for
+//					CRPNArena
+//
+//    Programmer:	Han Jung
+//
+//    Date:			10/17/2026
+//
+//    Version:		1.0
+//
+//    Environment:	Intel Xeon PC
+//                  Software:   MS Windows 10 for execution;
+//                  Compiles under Microsoft Visual C++ 2017 (/std:c++17)
+//
+//	  class:		CRPNArena
+//
+//	  Properties:
+//				vector<SArenaBlock> m_blocks;
+//				size_t m_block;
+//				size_t m_offset;
+//				size_t m_blockSize;
+//				size_t m_used;
+//				uint64_t m_heapAllocations;
+//
+//	  Non-inline Methods:
+//				CRPNArena(size_t blockSize);
+//				void* allocate(size_t bytes, size_t alignment);
+//				string_view copy(string_view text);
+//				void reset();
+//				void release();
+//
+//    History Log:
+//				10/17/2026	HJ arena for program text, version 1.0
+// ----------------------------------------------------------------------------
+namespace PB_CALC
+{
+	//-------------------------------------------------------------------------
+	//		method:			CRPNArena(size_t blockSize)
+	//		description:	constructor; no block is allocated until the
+	//						first request
+	//		calls:			n/a
+	//		called by:		CRPNEngine()
+	//						CRPNTypedEngine<T>()
+	//						embedding code
+	//		parameters:		size_t blockSize -- size of each block
+	//		returns:		n/a
+	//		History Log:
+	//					10/17/2026 HJ completed version 1.0
+	// -------------------------------------------------------------------------
+	CRPNArena::CRPNArena(size_t blockSize) : m_block(0), m_offset(0),
+		m_blockSize(blockSize > 0 ? blockSize : ARENABLOCKSIZE), m_used(0),
+		m_heapAllocations(0)
+	{
+	}
+	//-------------------------------------------------------------------------
+	//		method:			allocate(size_t bytes, size_t alignment)
+	//		description:	hands out bytes from the current block.  If they
+	//						do not fit, the next kept block is tried, and a
+	//						new block (of m_blockSize, or larger for a
+	//						large request) is added only when the kept
+	//						blocks run out.
+	//		calls:			n/a
+	//		called by:		copy()
+	//						CRPNEngine::setProgram()
+	//						CRPNEngine::ownProgramText()
+	//						embedding code
+	//		parameters:		size_t bytes -- size of the request
+	//						size_t alignment -- a power of two
+	//		returns:		void* -- the memory, valid until reset() or
+	//						release()
+	//		History Log:
+	//					10/17/2026 HJ completed version 1.0
+	// -------------------------------------------------------------------------
+	void* CRPNArena::allocate(size_t bytes, size_t alignment)
+	{
+		for (;;)
+		{
+			if (m_block < m_blocks.size())
+			{
+				SArenaBlock& block = m_blocks[m_block];
+				const uintptr_t base =
+					reinterpret_cast<uintptr_t>(block.data.get());
+				const size_t offset = static_cast<size_t>(((base + m_offset
+					+ alignment - 1) & ~static_cast<uintptr_t>(alignment - 1))
+					- base);
+				if (offset <= block.size && bytes <= block.size - offset)
+				{
+					m_offset = offset + bytes;
+					m_used += bytes;
+					return block.data.get() + offset;
+				}
+				m_block++;
+				m_offset = 0;
+				continue;
+			}
+			// every kept block is used up or was too small
+			SArenaBlock block;
+			block.size = (bytes + alignment > m_blockSize) ? bytes + alignment
+				: m_blockSize;
+			block.data.reset(new char[block.size]);
+			m_heapAllocations++;
+			m_blocks.push_back(move(block));
+		}
+	}
+	//-------------------------------------------------------------------------
+	//		method:			copy(string_view text)
+	//		description:	copies text into the arena
+	//		calls:			allocate()
+	//		called by:		CRPNEngine::setProgramText()
+	//						CRPNTypedEngine<T>::setProgram()
+	//						embedding code
+	//		parameters:		string_view text -- the characters to copy
+	//		returns:		string_view -- the copy, valid until reset() or
+	//						release()
+	//		History Log:
+	//					10/17/2026 HJ completed version 1.0
+	// -------------------------------------------------------------------------
+	string_view CRPNArena::copy(string_view text)
+	{
+		if (text.empty())
+			return string_view();
+		char* data = static_cast<char*>(allocate(text.size(), 1));
+		memcpy(data, text.data(), text.size());
+		return string_view(data, text.size());
+	}
+	//-------------------------------------------------------------------------
+	//		method:			reset()
+	//		description:	frees everything handed out, in one step.  The
+	//						blocks are kept and refilled from the first.
+	//		calls:			n/a
+	//		called by:		CRPNEngine::setProgram()
+	//						CRPNEngine::setProgramText()
+	//						CRPNEngine::loadProgramFile()
+	//						CRPNEngine::ownProgramText()
+	//						CRPNTypedEngine<T>::setProgram()
+	//						embedding code
+	//		parameters:		n/a
+	//		returns:		n/a
+	//		History Log:
+	//					10/17/2026 HJ completed version 1.0
+	// -------------------------------------------------------------------------
+	void CRPNArena::reset()
+	{
+		m_block = 0;
+		m_offset = 0;
+		m_used = 0;
+	}
+	//-------------------------------------------------------------------------
+	//		method:			release()
+	//		description:	frees everything handed out and gives the
+	//						blocks back to the heap
+	//		calls:			reset()
+	//		called by:		embedding code
+	//		parameters:		n/a
+	//		returns:		n/a
+	//		History Log:
+	//					10/17/2026 HJ completed version 1.0
+	// -------------------------------------------------------------------------
+	void CRPNArena::release()
+	{
+		vector<SArenaBlock>().swap(m_blocks);
+		reset();
+	}
+}
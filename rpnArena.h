@@ -0,0 +1,118 @@
+//----------------------------------------------------------------------------
+//    File:		rpnArena.h
+//
+//    Class:	CRPNArena
+//----------------------------------------------------------------------------
+#ifndef RPNARENA_H
+#define RPNARENA_H
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string_view>
+#include <vector>
+//----------------------------------------------------------------------------
+//
+//    Title:		RPNArena Class
+//
+//    Description:	This file contains the class definition for CRPNArena,
+//					a monotonic allocator.  Memory is handed out from large
+//					blocks by moving an offset, and is never freed piece by
+//					piece: reset() releases everything at once by rewinding
+//					to the first block.  The blocks are kept for reuse, so
+//					an arena that is filled to about the same size over and
+//					over (a program recorded again, the next batch) stops
+//					allocating after the first time.
+//
+//					Only trivially destructible data belongs in an arena;
+//					nothing is destroyed on reset().
+//
+//    Programmer:	Han Jung
+//
+//    Date:			10/17/2026
+//
+//    Version:		1.0
+//
+//    Environment:
+//       Hardware: Intel Xeon PC
+//       Software: Windows 10
+//       Compiles under Microsoft Visual C++ 2017 (/std:c++17)
+//
+//	  class CRPNArena:
+//
+//	  Properties:
+//		vector<SArenaBlock> m_blocks -- the blocks, in the order used
+//		size_t m_block -- the block being filled
+//		size_t m_offset -- bytes used in that block
+//		size_t m_blockSize -- size of a new block, unless a request is
+//			larger
+//		size_t m_used -- bytes handed out since the last reset
+//		uint64_t m_heapAllocations -- blocks allocated in the arena's
+//			lifetime
+//
+//	  Methods:
+//
+//		inline:
+//			size_t used() const;
+//			size_t capacity() const;
+//			size_t blocks() const;
+//			uint64_t heapAllocations() const;
+//
+//		non-inline:
+//		public:
+//			CRPNArena(size_t blockSize);
+//			void* allocate(size_t bytes, size_t alignment);
+//			string_view copy(string_view text);
+//			void reset();
+//			void release();
+//
+//    History Log:
+//			10/17/2026	HJ  arena for program text, version 1.0
+// ----------------------------------------------------------------------------
+
+using namespace std;
+
+namespace PB_CALC
+{
+	const size_t ARENABLOCKSIZE = 4096;
+
+	class CRPNArena
+	{
+	public:
+		CRPNArena(size_t blockSize = ARENABLOCKSIZE);
+		void* allocate(size_t bytes, size_t alignment = alignof(max_align_t));
+		string_view copy(string_view text);
+		void reset();
+		void release();
+
+		size_t used() const { return m_used; }
+		size_t capacity() const
+		{
+			size_t total = 0;
+			for (const SArenaBlock& block : m_blocks)
+				total += block.size;
+			return total;
+		}
+		size_t blocks() const { return m_blocks.size(); }
+		uint64_t heapAllocations() const { return m_heapAllocations; }
+
+	private:
+		struct SArenaBlock
+		{
+			unique_ptr<char[]> data;
+			size_t size;
+		};
+
+		CRPNArena(const CRPNArena&);
+		CRPNArena& operator=(const CRPNArena&);
+
+		vector<SArenaBlock> m_blocks;
+		size_t m_block;
+		size_t m_offset;
+		size_t m_blockSize;
+		size_t m_used;
+		uint64_t m_heapAllocations;
+	};
+}
+
+#endif
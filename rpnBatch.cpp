@@ -0,0 +1,403 @@
+#include "rpnBatch.h"
+//-------------------------------------------------------------------------------------------
+//    Class:		CRPNBatch
+//
+//    File:			rpnBatch.cpp
+//
+//    Description:	This file contains the function definitions for
+//					CRPNBatch
+//
+//    Programmer:	Han Jung
+//
+//    Date:			10/17/2026
+//
+//    Version:		1.0
+//
+//    Environment:	Intel Xeon PC
+//                  Software:   MS Windows 10 for execution;
+//                  Compiles under Microsoft Visual C++ 2017 (/std:c++17)
+//
+//	  class:		CRPNBatch
+//
+//	  Properties:
+//				vector<thread> m_threads;
+//				vector<unique_ptr<CRPNEngine>> m_engines;
+//				vector<unique_ptr<SChunkQueue>> m_queues;
+//				vector<string_view> m_lines;
+//				vector<string> m_results;
+//				mutex m_lock;
+//				condition_variable m_wake;
+//				condition_variable m_done;
+//				unsigned m_generation;
+//				unsigned m_busy;
+//				bool m_stop;
+//
+//	  Non-inline Methods:
+//				CRPNBatch(unsigned threads);
+//				~CRPNBatch();
+//				void run(istream& istr, ostream& ostr);
+//				void run(string_view text, ostream& ostr);
+//				bool mergeStats(CRPNStats& total) const;
+//				bool loadLibrary(const string& filename);
+//
+//				private:
+//					void evaluateChunk(unsigned worker, size_t chunk);
+//					void runChunks();
+//					void runLines(string_view text, ostream& ostr);
+//					bool takeChunk(unsigned worker, size_t& chunk);
+//					void worker(unsigned id);
+//
+//    History Log:
+//				10/17/2026	HJ parallel batch evaluator, version 1.0
+//				10/17/2026	HJ library programs, version 1.1
+// ----------------------------------------------------------------------------
+namespace PB_CALC
+{
+	//-------------------------------------------------------------------------
+	//		method:			CRPNBatch(unsigned threads)
+	//		description:	constructor; creates one engine per worker and
+	//						starts workers 1..threads-1.  The thread that
+	//						calls run() works as worker 0.
+	//		calls:			worker()
+	//		called by:		main()
+	//		parameters:		unsigned threads -- worker count, 0 for one per
+	//						hardware thread
+	//		returns:		n/a
+	//		History Log:
+	//					10/17/2026 HJ completed version 1.0
+	// -------------------------------------------------------------------------
+	CRPNBatch::CRPNBatch(unsigned threads) : m_generation(0), m_busy(0),
+		m_stop(false)
+	{
+		if (threads == 0)
+			threads = thread::hardware_concurrency();
+		if (threads == 0)
+			threads = 1;
+		for (unsigned i = 0; i < threads; i++)
+		{
+			m_engines.push_back(unique_ptr<CRPNEngine>(new CRPNEngine));
+			m_queues.push_back(unique_ptr<SChunkQueue>(new SChunkQueue));
+		}
+		for (unsigned i = 1; i < threads; i++)
+			m_threads.push_back(thread(&CRPNBatch::worker, this, i));
+	}
+	//-------------------------------------------------------------------------
+	//		method:			~CRPNBatch()
+	//		description:	destructor; stops and joins the workers
+	//		calls:			n/a
+	//		called by:		n/a
+	//		parameters:		n/a
+	//		returns:		n/a
+	//		History Log:
+	//					10/17/2026 HJ completed version 1.0
+	// -------------------------------------------------------------------------
+	CRPNBatch::~CRPNBatch()
+	{
+		{
+			lock_guard<mutex> guard(m_lock);
+			m_stop = true;
+		}
+		m_wake.notify_all();
+		for (thread& t : m_threads)
+			t.join();
+	}
+	//-------------------------------------------------------------------------
+	//		method:			run(istream& istr, ostream& ostr)
+	//		description:	evaluates every line of istr and writes the
+	//						results to ostr in input order.  Input is
+	//						processed BATCHWINDOWSIZE bytes at a time, so
+	//						memory use does not grow with the input.
+	//		calls:			runLines()
+	//		called by:		main()
+	//		parameters:		istream& istr -- expressions, one per line
+	//						ostream& ostr -- receives the results
+	//		returns:		n/a
+	//		History Log:
+	//					10/17/2026 HJ completed version 1.0
+	// -------------------------------------------------------------------------
+	void CRPNBatch::run(istream& istr, ostream& ostr)
+	{
+		string window;
+		vector<char> block(BATCHWINDOWSIZE);
+		bool atEnd = false;
+		while (!atEnd)
+		{
+			istr.read(block.data(), block.size());
+			size_t got = static_cast<size_t>(istr.gcount());
+			atEnd = (got < block.size());
+			window.append(block.data(), got);
+
+			// only whole lines are evaluated; a partial last line waits
+			// for the next block
+			size_t end = window.size();
+			if (!atEnd)
+			{
+				size_t newline = window.rfind('\n');
+				if (newline == string::npos)
+					continue;
+				end = newline + 1;
+			}
+			runLines(string_view(window.data(), end), ostr);
+			window.erase(0, end);
+		}
+		ostr.flush();
+	}
+	//-------------------------------------------------------------------------
+	//		method:			run(string_view text, ostream& ostr)
+	//		description:	evaluates every line of text and writes the
+	//						results to ostr in input order.  The lines are
+	//						views into text, so a mapped file is evaluated
+	//						without being copied.  Lines are still taken
+	//						BATCHWINDOWSIZE bytes at a time to bound the
+	//						line and result buffers.
+	//		calls:			runLines()
+	//		called by:		main()
+	//		parameters:		string_view text -- expressions, one per line
+	//						ostream& ostr -- receives the results
+	//		returns:		n/a
+	//		History Log:
+	//					10/17/2026 HJ completed version 1.0
+	// -------------------------------------------------------------------------
+	void CRPNBatch::run(string_view text, ostream& ostr)
+	{
+		while (!text.empty())
+		{
+			size_t end = text.size();
+			if (end > BATCHWINDOWSIZE)
+			{
+				// end the window after the last whole line in it, or after
+				// the first line if that alone is longer than a window
+				end = text.rfind('\n', BATCHWINDOWSIZE - 1);
+				if (end == string_view::npos)
+					end = text.find('\n', BATCHWINDOWSIZE);
+				end = (end == string_view::npos) ? text.size() : end + 1;
+			}
+			runLines(text.substr(0, end), ostr);
+			text.remove_prefix(end);
+		}
+		ostr.flush();
+	}
+	//-------------------------------------------------------------------------
+	//		method:			loadLibrary(const string& filename)
+	//		description:	loads a library file into every worker's
+	//						engine, so any chunk can run its programs.  Call
+	//						it before the first run.
+	//		calls:			CRPNEngine::loadLibrary()
+	//		called by:		main()
+	//		parameters:		const string& filename -- the library file
+	//		returns:		bool -- false if an engine could not load it
+	//		History Log:
+	//					10/17/2026 HJ completed version 1.0
+	// -------------------------------------------------------------------------
+	bool CRPNBatch::loadLibrary(const string& filename)
+	{
+		for (unique_ptr<CRPNEngine>& engine : m_engines)
+			if (!engine->loadLibrary(filename))
+				return false;
+		return true;
+	}
+	//-------------------------------------------------------------------------
+	//		method:			mergeStats(CRPNStats& total) const
+	//		description:	adds the statistics of every worker's engine to
+	//						total.  Call it between runs, not during one.
+	//		calls:			CRPNEngine::stats()
+	//						CRPNStats::merge()
+	//		called by:		main()
+	//		parameters:		CRPNStats& total -- receives the counts
+	//		returns:		bool -- false if this build collects none
+	//		History Log:
+	//					10/17/2026 HJ completed version 1.0
+	// -------------------------------------------------------------------------
+	bool CRPNBatch::mergeStats(CRPNStats& total) const
+	{
+		for (const unique_ptr<CRPNEngine>& engine : m_engines)
+		{
+			const CRPNStats* stats = engine->stats();
+			if (stats == nullptr)
+				return false;
+			total.merge(*stats);
+		}
+		return true;
+	}
+	//-------------------------------------------------------------------------
+	//		method:			runLines(string_view text, ostream& ostr)
+	//		description:	evaluates whole lines of input on the pool and
+	//						writes their results in order
+	//		calls:			splitLines()
+	//						runChunks()
+	//		called by:		run()
+	//		parameters:		string_view text -- whole lines of input
+	//						ostream& ostr -- receives the results
+	//		returns:		n/a
+	//		History Log:
+	//					10/17/2026 HJ completed version 1.0
+	// -------------------------------------------------------------------------
+	void CRPNBatch::runLines(string_view text, ostream& ostr)
+	{
+		splitLines(text, m_lines);
+		runChunks();
+		for (size_t chunk = 0; chunk * LINESPERCHUNK < m_lines.size(); chunk++)
+			ostr.write(m_results[chunk].data(), m_results[chunk].size());
+	}
+	//-------------------------------------------------------------------------
+	//		method:			runChunks()
+	//		description:	deals the chunks of m_lines out to the workers
+	//						in contiguous ranges, wakes them, works as
+	//						worker 0 and waits until every chunk is done
+	//		calls:			takeChunk()
+	//						evaluateChunk()
+	//		called by:		runLines()
+	//		parameters:		n/a
+	//		returns:		n/a
+	//		History Log:
+	//					10/17/2026 HJ completed version 1.0
+	// -------------------------------------------------------------------------
+	void CRPNBatch::runChunks()
+	{
+		const size_t chunks = (m_lines.size() + LINESPERCHUNK - 1)
+			/ LINESPERCHUNK;
+		const size_t workers = m_queues.size();
+		if (m_results.size() < chunks)
+			m_results.resize(chunks);
+		for (size_t w = 0; w < workers; w++)
+		{
+			deque<size_t>& queue = m_queues[w]->chunks;
+			for (size_t c = chunks * w / workers;
+				c < chunks * (w + 1) / workers; c++)
+				queue.push_back(c);
+		}
+
+		{
+			lock_guard<mutex> guard(m_lock);
+			m_busy = static_cast<unsigned>(m_threads.size());
+			m_generation++;
+		}
+		m_wake.notify_all();
+
+		size_t chunk = 0;
+		while (takeChunk(0, chunk))
+			evaluateChunk(0, chunk);
+
+		unique_lock<mutex> guard(m_lock);
+		m_done.wait(guard, [this] { return m_busy == 0; });
+	}
+	//-------------------------------------------------------------------------
+	//		method:			takeChunk(unsigned worker, size_t& chunk)
+	//		description:	takes the next chunk from the front of the
+	//						worker's own queue, or steals one from the back
+	//						of another worker's queue when its own is empty
+	//		calls:			n/a
+	//		called by:		runChunks()
+	//						worker()
+	//		parameters:		unsigned worker -- the worker asking
+	//						size_t& chunk -- receives the chunk
+	//		returns:		bool -- false when no work is left anywhere
+	//		History Log:
+	//					10/17/2026 HJ completed version 1.0
+	// -------------------------------------------------------------------------
+	bool CRPNBatch::takeChunk(unsigned worker, size_t& chunk)
+	{
+		const size_t workers = m_queues.size();
+		for (size_t i = 0; i < workers; i++)
+		{
+			SChunkQueue& queue = *m_queues[(worker + i) % workers];
+			lock_guard<mutex> guard(queue.lock);
+			if (queue.chunks.empty())
+				continue;
+			if (i == 0)
+			{
+				chunk = queue.chunks.front();
+				queue.chunks.pop_front();
+			}
+			else
+			{
+				chunk = queue.chunks.back();
+				queue.chunks.pop_back();
+			}
+			return true;
+		}
+		return false;
+	}
+	//-------------------------------------------------------------------------
+	//		method:			evaluateChunk(unsigned worker, size_t chunk)
+	//		description:	evaluates the lines of one chunk on the worker's
+	//						engine, each from a reset engine, and formats
+	//						the results into m_results[chunk]
+	//		calls:			CRPNEngine::reset()
+	//						CRPNEngine::evaluate()
+	//						formatNumber()
+	//		called by:		runChunks()
+	//						worker()
+	//		parameters:		unsigned worker -- whose engine to use
+	//						size_t chunk -- the chunk to evaluate
+	//		returns:		n/a
+	//		History Log:
+	//					10/17/2026 HJ completed version 1.0
+	// -------------------------------------------------------------------------
+	void CRPNBatch::evaluateChunk(unsigned worker, size_t chunk)
+	{
+		CRPNEngine& engine = *m_engines[worker];
+		string& results = m_results[chunk];
+		results.clear();
+		const size_t first = chunk * LINESPERCHUNK;
+		const size_t last = min(first + LINESPERCHUNK, m_lines.size());
+		for (size_t i = first; i < last; i++)
+		{
+			double top = 0.0;
+			engine.reset();
+			switch (engine.evaluate(m_lines[i], top))
+			{
+			case EVAL_OK:
+			{
+				char number[NUMBERSIZE];
+				results.append(number, formatNumber(top, number,
+					sizeof(number)));
+				break;
+			}
+			case EVAL_ERROR:
+				results.append(errorText, sizeof(errorText) - 1);
+				break;
+			case EVAL_EMPTY:
+				break;
+			}
+			results.push_back('\n');
+		}
+	}
+	//-------------------------------------------------------------------------
+	//		method:			worker(unsigned id)
+	//		description:	thread body: waits for a window, drains chunks
+	//						until none are left, reports done, repeats
+	//		calls:			takeChunk()
+	//						evaluateChunk()
+	//		called by:		CRPNBatch()
+	//		parameters:		unsigned id -- this worker's index
+	//		returns:		n/a
+	//		History Log:
+	//					10/17/2026 HJ completed version 1.0
+	// -------------------------------------------------------------------------
+	void CRPNBatch::worker(unsigned id)
+	{
+		unsigned seen = 0;
+		for (;;)
+		{
+			{
+				unique_lock<mutex> guard(m_lock);
+				m_wake.wait(guard, [this, seen]
+				{
+					return m_stop || m_generation != seen;
+				});
+				if (m_stop)
+					return;
+				seen = m_generation;
+			}
+
+			size_t chunk = 0;
+			while (takeChunk(id, chunk))
+				evaluateChunk(id, chunk);
+
+			lock_guard<mutex> guard(m_lock);
+			if (--m_busy == 0)
+				m_done.notify_one();
+		}
+	}
+}
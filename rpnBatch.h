@@ -0,0 +1,140 @@
+//----------------------------------------------------------------------------
+//    File:		rpnBatch.h
+//
+//    Class:	CRPNBatch
+//----------------------------------------------------------------------------
+#ifndef RPNBATCH_H
+#define RPNBATCH_H
+
+#include <condition_variable>
+#include <deque>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+#include "rpnEngine.h"
+#include "rpnMappedFile.h"
+//----------------------------------------------------------------------------
+//
+//    Title:		RPNBatch Class
+//
+//    Description:	This file contains the class definition for CRPNBatch,
+//					a parallel batch evaluator.  Input is read in large
+//					windows, each window is cut into chunks of lines, and
+//					the chunks are evaluated on a work-stealing thread pool
+//					with one CRPNEngine per worker.  Results are written in
+//					input order, one per line, in the same format as
+//					CRPNCalc::runBatch().  Text that is already in memory,
+//					such as a mapped file, is evaluated in place.
+//
+//					Unlike runBatch(), every line is independent: it is
+//					evaluated from an empty stack and zeroed registers, so
+//					the output does not depend on how lines are split
+//					among workers.
+//
+//    Programmer:	Han Jung
+//
+//    Date:			10/17/2026
+//
+//    Version:		1.0
+//
+//    Environment:
+//       Hardware: Intel Xeon PC
+//       Software: Windows 10
+//       Compiles under Microsoft Visual C++ 2017 (/std:c++17)
+//
+//	  class CRPNBatch:
+//
+//	  Properties:
+//		vector<thread> m_threads -- workers 1..n-1; the caller is worker 0
+//		vector<unique_ptr<CRPNEngine>> m_engines -- one per worker
+//		vector<unique_ptr<SChunkQueue>> m_queues -- one per worker
+//		vector<string_view> m_lines -- lines of the current window
+//		vector<string> m_results -- output of each chunk
+//		mutex m_lock -- guards the fields below
+//		condition_variable m_wake -- a new window is ready
+//		condition_variable m_done -- a worker finished the window
+//		unsigned m_generation -- counts windows
+//		unsigned m_busy -- workers still on the current window
+//		bool m_stop -- the pool is shutting down
+//
+//	  Methods:
+//
+//		inline:
+//			unsigned threads() const;
+//
+//		non-inline:
+//		public:
+//			CRPNBatch(unsigned threads);
+//			~CRPNBatch();
+//			void run(istream& istr, ostream& ostr);
+//			void run(string_view text, ostream& ostr);
+//			bool mergeStats(CRPNStats& total) const;
+//			bool loadLibrary(const string& filename);
+//		private:
+//			void evaluateChunk(unsigned worker, size_t chunk);
+//			void runChunks();
+//			void runLines(string_view text, ostream& ostr);
+//			bool takeChunk(unsigned worker, size_t& chunk);
+//			void worker(unsigned id);
+//
+//    History Log:
+//			10/17/2026	HJ  parallel batch evaluator, version 1.0
+//			10/17/2026	HJ  library programs, version 1.1
+// ----------------------------------------------------------------------------
+
+using namespace std;
+
+namespace PB_CALC
+{
+	const size_t BATCHWINDOWSIZE = 16 * 1024 * 1024;
+	const size_t LINESPERCHUNK = 2048;
+
+	class CRPNBatch
+	{
+	public:
+		CRPNBatch(unsigned threads = 0);  // 0: one per hardware thread
+		~CRPNBatch();
+		void run(istream& istr, ostream& ostr);
+		void run(string_view text, ostream& ostr);
+		bool mergeStats(CRPNStats& total) const;
+		bool loadLibrary(const string& filename);
+		unsigned threads() const
+		{
+			return static_cast<unsigned>(m_engines.size());
+		}
+
+	private:
+		struct SChunkQueue
+		{
+			mutex lock;
+			deque<size_t> chunks;
+		};
+
+		CRPNBatch(const CRPNBatch&);
+		CRPNBatch& operator=(const CRPNBatch&);
+
+		void evaluateChunk(unsigned worker, size_t chunk);
+		void runChunks();
+		void runLines(string_view text, ostream& ostr);
+		bool takeChunk(unsigned worker, size_t& chunk);
+		void worker(unsigned id);
+
+		vector<thread> m_threads;
+		vector<unique_ptr<CRPNEngine>> m_engines;
+		vector<unique_ptr<SChunkQueue>> m_queues;
+		vector<string_view> m_lines;
+		vector<string> m_results;
+		mutex m_lock;
+		condition_variable m_wake;
+		condition_variable m_done;
+		unsigned m_generation;
+		unsigned m_busy;
+		bool m_stop;
+	};
+}
+
+#endif
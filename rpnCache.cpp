@@ -0,0 +1,259 @@
+#include "rpnCache.h"
+#include <cstring>
+#include <utility>
+//-------------------------------------------------------------------------------------------
+//    Class:		CRPNResultCache
+//
+//    File:			rpnCache.cpp
+//
+//    Description:	This file contains the function definitions for
+//					CRPNResultCache
+//
+//    Programmer:	Han Jung
+//
+//    Date:			10/17/2026
+//
+//    Version:		1.0
+//
+//    Environment:	Intel Xeon PC
+//                  Software:   MS Windows 10 for execution;
+//                  Compiles under Microsoft Visual C++ 2017 (/std:c++17)
+//
+//	  class:		CRPNResultCache
+//
+//	  Properties:
+//				list<SCacheEntry> m_entries;
+//				unordered_map<uint64_t, list<SCacheEntry>::iterator> m_index;
+//				size_t m_capacity;
+//				uint64_t m_hits;
+//				uint64_t m_misses;
+//				uint64_t m_evictions;
+//
+//	  Non-inline Methods:
+//				CRPNResultCache();
+//				void setCapacity(size_t capacity);
+//				void clear();
+//				void resetCounters();
+//				bool find(uint64_t hash, const vector<double>& key,
+//					bool error, vector<double>& result, bool& resultError);
+//				void insert(uint64_t hash, const vector<double>& key,
+//					bool error, const vector<double>& result,
+//					bool resultError);
+//				static uint64_t hashKey(const vector<double>& key,
+//					bool error);
+//
+//    History Log:
+//				10/17/2026	HJ LRU cache of program results, version 1.0
+// ----------------------------------------------------------------------------
+namespace PB_CALC
+{
+	namespace
+	{
+		//--------------------------------------------------------------------
+		//	Function:		sameBits(const vector<double>& a,
+		//						const vector<double>& b)
+		//	Description:	compares two keys bit for bit
+		//	Returns:		true if they are identical
+		//--------------------------------------------------------------------
+		bool sameBits(const vector<double>& a, const vector<double>& b)
+		{
+			return a.size() == b.size() && (a.empty()
+				|| memcmp(a.data(), b.data(), a.size() * sizeof(double)) == 0);
+		}
+	}
+
+	//-------------------------------------------------------------------------
+	//		method:			CRPNResultCache()
+	//		description:	constructor; an empty, disabled cache
+	//		calls:			n/a
+	//		called by:		CRPNEngine()
+	//		parameters:		n/a
+	//		returns:		n/a
+	//		History Log:
+	//					10/17/2026 HJ completed version 1.0
+	// -------------------------------------------------------------------------
+	CRPNResultCache::CRPNResultCache() : m_capacity(0), m_hits(0),
+		m_misses(0), m_evictions(0)
+	{
+	}
+	//-------------------------------------------------------------------------
+	//		method:			setCapacity(size_t capacity)
+	//		description:	sets the most entries kept, dropping the least
+	//						recently used ones if there are more
+	//		calls:			clear()
+	//		called by:		CRPNEngine::setResultCache()
+	//		parameters:		size_t capacity -- entries; 0 disables the
+	//						cache and empties it
+	//		returns:		n/a
+	//		History Log:
+	//					10/17/2026 HJ completed version 1.0
+	// -------------------------------------------------------------------------
+	void CRPNResultCache::setCapacity(size_t capacity)
+	{
+		m_capacity = capacity;
+		if (capacity == 0)
+		{
+			clear();
+			return;
+		}
+		while (m_entries.size() > capacity)
+		{
+			m_index.erase(m_entries.back().hash);
+			m_entries.pop_back();
+		}
+	}
+	//-------------------------------------------------------------------------
+	//		method:			clear()
+	//		description:	drops every entry; the counters are kept
+	//		calls:			n/a
+	//		called by:		setCapacity()
+	//						CRPNEngine::setProgram()
+	//						CRPNEngine::loadProgramFile()
+	//		parameters:		n/a
+	//		returns:		n/a
+	//		History Log:
+	//					10/17/2026 HJ completed version 1.0
+	// -------------------------------------------------------------------------
+	void CRPNResultCache::clear()
+	{
+		m_entries.clear();
+		m_index.clear();
+	}
+	//-------------------------------------------------------------------------
+	//		method:			resetCounters()
+	//		description:	sets the hit, miss and eviction counts to zero
+	//		calls:			n/a
+	//		called by:		embedding code
+	//		parameters:		n/a
+	//		returns:		n/a
+	//		History Log:
+	//					10/17/2026 HJ completed version 1.0
+	// -------------------------------------------------------------------------
+	void CRPNResultCache::resetCounters()
+	{
+		m_hits = 0;
+		m_misses = 0;
+		m_evictions = 0;
+	}
+	//-------------------------------------------------------------------------
+	//		method:			find(uint64_t hash, const vector<double>& key,
+	//							bool error, vector<double>& result,
+	//							bool& resultError)
+	//		description:	looks up a starting state; a hit becomes the
+	//						most recently used entry
+	//		calls:			sameBits()
+	//		called by:		CRPNEngine::runProgram()
+	//		parameters:		uint64_t hash -- hashKey(key, error)
+	//						const vector<double>& key -- the state
+	//						bool error -- the error flag of the state
+	//						vector<double>& result -- receives the final
+	//						state on a hit
+	//						bool& resultError -- receives its error flag
+	//		returns:		bool -- true on a hit
+	//		History Log:
+	//					10/17/2026 HJ completed version 1.0
+	// -------------------------------------------------------------------------
+	bool CRPNResultCache::find(uint64_t hash, const vector<double>& key,
+		bool error, vector<double>& result, bool& resultError)
+	{
+		unordered_map<uint64_t, list<SCacheEntry>::iterator>::iterator found =
+			m_index.find(hash);
+		if (found == m_index.end() || found->second->error != error
+			|| !sameBits(found->second->key, key))
+		{
+			m_misses++;
+			return false;
+		}
+		m_entries.splice(m_entries.begin(), m_entries, found->second);
+		result.assign(found->second->result.begin(),
+			found->second->result.end());
+		resultError = found->second->resultError;
+		m_hits++;
+		return true;
+	}
+	//-------------------------------------------------------------------------
+	//		method:			insert(uint64_t hash, const vector<double>& key,
+	//							bool error, const vector<double>& result,
+	//							bool resultError)
+	//		description:	remembers the final state of a run as the most
+	//						recently used entry.  An entry with the same
+	//						hash is replaced; otherwise, in a full cache,
+	//						the least recently used entry is reused.
+	//		calls:			n/a
+	//		called by:		CRPNEngine::runProgram()
+	//		parameters:		uint64_t hash -- hashKey(key, error)
+	//						const vector<double>& key -- starting state
+	//						bool error -- its error flag
+	//						const vector<double>& result -- final state
+	//						bool resultError -- its error flag
+	//		returns:		n/a
+	//		History Log:
+	//					10/17/2026 HJ completed version 1.0
+	// -------------------------------------------------------------------------
+	void CRPNResultCache::insert(uint64_t hash, const vector<double>& key,
+		bool error, const vector<double>& result, bool resultError)
+	{
+		if (m_capacity == 0)
+			return;
+		list<SCacheEntry>::iterator entry;
+		unordered_map<uint64_t, list<SCacheEntry>::iterator>::iterator found =
+			m_index.find(hash);
+		if (found != m_index.end())
+		{
+			entry = found->second;
+			m_entries.splice(m_entries.begin(), m_entries, entry);
+		}
+		else
+		{
+			if (m_entries.size() < m_capacity)
+			{
+				m_entries.emplace_front();
+				m_index[hash] = m_entries.begin();
+			}
+			else
+			{
+				// move the index node too, so an eviction never allocates
+				m_entries.splice(m_entries.begin(), m_entries,
+					prev(m_entries.end()));
+				unordered_map<uint64_t, list<SCacheEntry>::iterator>::node_type
+					node = m_index.extract(m_entries.front().hash);
+				node.key() = hash;
+				m_index.insert(move(node));
+				m_evictions++;
+			}
+			entry = m_entries.begin();
+		}
+		entry->hash = hash;
+		entry->key.assign(key.begin(), key.end());
+		entry->error = error;
+		entry->result.assign(result.begin(), result.end());
+		entry->resultError = resultError;
+	}
+	//-------------------------------------------------------------------------
+	//		method:			hashKey(const vector<double>& key, bool error)
+	//		description:	hashes a key by the bits of its values
+	//		calls:			n/a
+	//		called by:		CRPNEngine::runProgram()
+	//		parameters:		const vector<double>& key -- the state
+	//						bool error -- its error flag
+	//		returns:		uint64_t -- the hash
+	//		History Log:
+	//					10/17/2026 HJ completed version 1.0
+	// -------------------------------------------------------------------------
+	uint64_t CRPNResultCache::hashKey(const vector<double>& key, bool error)
+	{
+		uint64_t hash = error ? 0x6A09E667F3BCC909ULL : 0xBB67AE8584CAA73BULL;
+		hash ^= key.size();
+		for (double d : key)
+		{
+			uint64_t bits;
+			memcpy(&bits, &d, sizeof bits);
+			hash = ((hash << 5) | (hash >> 59)) ^ bits;
+			hash *= 0x9E3779B97F4A7C15ULL;
+		}
+		// the splitmix64 finalizer, so nearby values spread out
+		hash = (hash ^ (hash >> 30)) * 0xBF58476D1CE4E5B9ULL;
+		hash = (hash ^ (hash >> 27)) * 0x94D049BB133111EBULL;
+		return hash ^ (hash >> 31);
+	}
+}
@@ -0,0 +1,123 @@
+//----------------------------------------------------------------------------
+//    File:		rpnCache.h
+//
+//    Class:	CRPNResultCache
+//----------------------------------------------------------------------------
+#ifndef RPNCACHE_H
+#define RPNCACHE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <list>
+#include <unordered_map>
+#include <vector>
+//----------------------------------------------------------------------------
+//
+//    Title:		RPNResultCache Class
+//
+//    Description:	This file contains the class definition for
+//					CRPNResultCache, a bounded LRU memo of program runs.
+//					A key is the state a run starts from, as the engine
+//					lays it out (registers, then the stack bottom first),
+//					plus the error flag; the value is the state it ends
+//					in.  Keys compare bit for bit, so -0 and 0, and NaNs
+//					with different payloads, are different keys.
+//
+//					The cache holds results for one program.  The engine
+//					clears it whenever the program is replaced.  Once it
+//					is full, each insert reuses the least recently used
+//					entry, so a cache that has filled up allocates only
+//					when a key or result is longer than any before.
+//
+//    Programmer:	Han Jung
+//
+//    Date:			10/17/2026
+//
+//    Version:		1.0
+//
+//    Environment:
+//       Hardware: Intel Xeon PC
+//       Software: Windows 10
+//       Compiles under Microsoft Visual C++ 2017 (/std:c++17)
+//
+//	  class CRPNResultCache:
+//
+//	  Properties:
+//		list<SCacheEntry> m_entries -- most recently used first
+//		unordered_map<uint64_t, list<SCacheEntry>::iterator> m_index --
+//			entries by key hash
+//		size_t m_capacity -- most entries kept; 0 disables the cache
+//		uint64_t m_hits -- lookups that found their key
+//		uint64_t m_misses -- lookups that did not
+//		uint64_t m_evictions -- entries dropped to make room
+//
+//	  Methods:
+//
+//		inline:
+//			size_t size() const;
+//			size_t capacity() const;
+//			bool enabled() const;
+//			uint64_t hits() const;
+//			uint64_t misses() const;
+//			uint64_t evictions() const;
+//
+//		non-inline:
+//		public:
+//			CRPNResultCache();
+//			void setCapacity(size_t capacity);
+//			void clear();
+//			void resetCounters();
+//			bool find(uint64_t hash, const vector<double>& key, bool error,
+//				vector<double>& result, bool& resultError);
+//			void insert(uint64_t hash, const vector<double>& key,
+//				bool error, const vector<double>& result, bool resultError);
+//			static uint64_t hashKey(const vector<double>& key, bool error);
+//
+//    History Log:
+//			10/17/2026	HJ  LRU cache of program results, version 1.0
+// ----------------------------------------------------------------------------
+
+using namespace std;
+
+namespace PB_CALC
+{
+	class CRPNResultCache
+	{
+	public:
+		CRPNResultCache();
+		void setCapacity(size_t capacity);
+		void clear();
+		void resetCounters();
+		bool find(uint64_t hash, const vector<double>& key, bool error,
+			vector<double>& result, bool& resultError);
+		void insert(uint64_t hash, const vector<double>& key, bool error,
+			const vector<double>& result, bool resultError);
+		static uint64_t hashKey(const vector<double>& key, bool error);
+
+		size_t size() const { return m_entries.size(); }
+		size_t capacity() const { return m_capacity; }
+		bool enabled() const { return m_capacity > 0; }
+		uint64_t hits() const { return m_hits; }
+		uint64_t misses() const { return m_misses; }
+		uint64_t evictions() const { return m_evictions; }
+
+	private:
+		struct SCacheEntry
+		{
+			uint64_t hash;
+			vector<double> key;
+			bool error;
+			vector<double> result;
+			bool resultError;
+		};
+
+		list<SCacheEntry> m_entries;
+		unordered_map<uint64_t, list<SCacheEntry>::iterator> m_index;
+		size_t m_capacity;
+		uint64_t m_hits;
+		uint64_t m_misses;
+		uint64_t m_evictions;
+	};
+}
+
+#endif
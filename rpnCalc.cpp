@@ -1,10 +1,13 @@
 #include "rpnCalc.h"
+#include "rpnOperators.h"
+#include "rpnTokenizer.h"
 //-------------------------------------------------------------------------------------------
 //    Class:		CRPNCalc
 //
 //    File:			RPNCalc.cpp
 //
-//    Description:	This file contains the function definitions for CRPNCalc
+//    Description:	This file contains the function definitions for CRPNCalc,
+//					the interactive shell around CRPNEngine
 //
 //    Programmer:	Han Jung
 //					Cheuk Chi Chow
@@ -18,47 +21,34 @@
 //                  Software:   MS Windows 10 for execution; 
 //                  Compiles under Microsoft Visual C++.Net 2017
 // 
-//	  class:		CRPNCalc
+//	  class:		CRPNCalc : public CRPNEngine
 //
 //	  Properties:
-//				double m_registers[NUMREGS];
 //				string m_buffer;
-//				deque<double> m_stack;
-//				list<string> m_program;
-//				istringstream m_instrStream;
-//				bool m_error;
 //				bool m_helpOn;
 //				bool m_on;
 //				bool m_programRunning;
+//				istream* m_in;
+//				ostream* m_out;
+//				bool m_prompts;
 //
 //	  Non-inline Methods:
-//				CRPNCalc(bool on = true);
+//				CRPNCalc(istream& istr = cin, ostream& ostr = cout);
 //				void run();
+//				void runBatch(istream& istr, ostream& ostr);
 //				void print(ostream& ostr);  // changes m_error on error, so not const
 //				void input(istream& istr);
 //
-//				private:
-//					// private methods
-//					void add();
-//					void binary_prep(double& d1, double& d2);
-//					void clearEntry();
-//					void clearAll();
-//					void divide();
-//					void exp();
-//					void getReg(int reg);
+//				protected:
+//					// CRPNEngine hooks
 //					void loadProgram();
-//					void mod();
-//					void multiply();
-//					void neg();
-//					void parse();
 //					void recordProgram();
-//					void rotateUp();
-//					void rotateDown();
-//					void runProgram();
 //					void saveToFile();
-//					void setReg(int reg);
-//					void subtract();
-//					void unary_prep(double& d);
+//					void toggleHelp();
+//					void turnOff();
+//
+//				private:
+//					void prompt(const char* text);
 //	  related functions:
 //				ostream &operator <<(ostream &ostr, const CRPNCalc &calc)
 //    			istream &operator >>(istream &istr, CRPNCalc &calc)
@@ -68,57 +58,126 @@
 //				6/9/2017	CC completed version 0.1
 //				6/10/2017	HN completed version 1.0
 //				6/11/2017	HJ completed version 1.1
+//				10/17/2026	HJ tokenizer, compiled programs and CRPNStack
+//				10/17/2026	HJ evaluation moved to CRPNEngine
+//				10/17/2026	HJ F saves program files
+//				10/17/2026	HJ recording ends at a P token, not a p byte
 // ----------------------------------------------------------------------------	
 namespace PB_CALC
 {
+	namespace
+	{
+		const size_t BATCHFLUSHSIZE = 65536;
+	}
 	//-------------------------------------------------------------------------
-	//		method:			CRPNCalc(bool on)
-	//		description:	constructor which takes boolean value for m_on as
-	//						an argument and runs calculator if m_on is true.
-	//		calls:			run()
+	//		method:			CRPNCalc(istream& istr, ostream& ostr)
+	//		description:	constructor.  All console input and output,
+	//						including the prompts of P, L and F, goes
+	//						through istr/ostr.  Call run() to start the
+	//						calculator.
+	//		calls:			CRPNEngine()
 	//		called by:		main();
 	//
-	//		parameters:		boolean value
+	//		parameters:		istream& istr -- where commands are read from
+	//						ostream& ostr -- where the display is written
 	//			
 	//		returns:		n/a
 	//		History Log:
 	//					5/31/2017 HJ completed version 1.0
+	//					10/17/2026 HJ injected streams, version 1.1
+	//					10/17/2026 HJ no longer runs from the constructor
 	// -------------------------------------------------------------------------
-	CRPNCalc::CRPNCalc(bool on) : m_on(on), m_error(false), m_helpOn(true),
-		m_programRunning(false)
+	CRPNCalc::CRPNCalc(istream& istr, ostream& ostr) : m_helpOn(true),
+		m_on(false), m_programRunning(false), m_in(&istr), m_out(&ostr),
+		m_prompts(true)
 	{
-		for (int i = 0; i < NUMREGS; i++)
-			m_registers[i] = 0.0;
-		if (m_on)
-			run();
 	}
 	//-------------------------------------------------------------------------
 	//		method:			run()
-	//		description:	runs the calculator method if m_on is set to true.
+	//		description:	runs the interactive calculator until X or the
+	//						end of input
 	//		calls:			print()
 	//						input()
 	//						
-	//		called by:		run()
+	//		called by:		main()
 	//		parameters:		n/a
 	//			
 	//		returns:		n/a
 	//		History Log:
 	//					6/10/2017 HN completed version 1.0
+	//					10/17/2026 HJ only clears a console screen
 	// -------------------------------------------------------------------------
 	void CRPNCalc::run()
 	{
+		m_on = true;
 		while (m_on)
 		{
-			system("CLS");
-			print(cout);
-			input(cin);
+			if (m_out == &cout)
+				system("CLS");
+			print(*m_out);
+			input(*m_in);
+		}
+	}
+	//-------------------------------------------------------------------------
+	//		method:			runBatch(istream& istr, ostream& ostr)
+	//		description:	headless mode: parses every line of istr and
+	//						writes one result per line to ostr -- the top of
+	//						the stack, an empty line if the stack is empty,
+	//						or <<error>>.  The calculator keeps its state
+	//						from line to line as it does interactively.  No
+	//						screen clearing or help; output is collected in
+	//						a buffer and written in large blocks.  Stops at
+	//						the end of input or at X.  P, L and F read what
+	//						they need from istr without prompting.
+	//		calls:			parse()
+	//		called by:		main()
+	//		parameters:		istream& istr -- expressions, one per line
+	//						ostream& ostr -- receives the results
+	//		returns:		n/a
+	//		History Log:
+	//					10/17/2026 HJ completed version 1.0
+	// -------------------------------------------------------------------------
+	void CRPNCalc::runBatch(istream& istr, ostream& ostr)
+	{
+		string results;
+		results.reserve(BATCHFLUSHSIZE + NUMBERSIZE + sizeof(errorText));
+		istream* savedIn = m_in;
+		bool savedPrompts = m_prompts;
+		m_in = &istr;
+		m_prompts = false;
+		m_on = true;
+		while (m_on && getline(istr, m_buffer))
+		{
+			parse(m_buffer);
+			if (error())
+			{
+				results.append(errorText, sizeof(errorText) - 1);
+				clearError();
+			}
+			else if (!empty())
+			{
+				char number[NUMBERSIZE];
+				results.append(number,
+					formatNumber(top(), number, sizeof(number)));
+			}
+			results.push_back('\n');
+			if (results.size() >= BATCHFLUSHSIZE)
+			{
+				ostr.write(results.data(), results.size());
+				results.clear();
+			}
 		}
+		ostr.write(results.data(), results.size());
+		ostr.flush();
+		m_in = savedIn;
+		m_prompts = savedPrompts;
+		m_on = false;
 	}
 	//-------------------------------------------------------------------------
 	//		method:			print(ostream& ostr)
 	//		description:	prints out authors and help menu and top number of 
 	//						the stack
-	//		calls:			n/a
+	//		calls:			formatNumber()
 	//		called by:		run()
 	//
 	//		parameters:		ostream& ostr -- ostream to print to.
@@ -126,668 +185,215 @@ namespace PB_CALC
 	//		returns:		n/a
 	//		History Log:
 	//					5/31/2017 HJ completed version 1.0
+	//					10/17/2026 HJ writes only to ostr
+	//					10/17/2026 HJ shortest round trip formatting
 	// -------------------------------------------------------------------------
 	void CRPNCalc::print(ostream& ostr)
 	{
-		double d = 0.0;
 		ostr << "[RPN Programmable Calculator] by Han Jung, Cheuk Chi Chow and "
 			<< "Hui Nguyen" << endl;
 		if (m_helpOn)
-			cout << helpMenu;
+			ostr << helpMenu;
 		else
-			cout << endl << endl << endl;
-		cout << line;
-		if (!m_stack.empty())
+			ostr << endl << endl << endl;
+		ostr << line;
+		if (!empty())
 		{
-			d = m_stack.front();
-			ostr << d;
+			char number[NUMBERSIZE];
+			ostr.write(number, formatNumber(top(), number, sizeof(number)));
 		}
 		ostr << endl << endl;
-		if (m_error)
+		if (error())
 		{
 			ostr << "<<error>>" << endl;
-			m_error = false;
-		}
-	}
-	//-------------------------------------------------------------------------
-	//		method:			parse()
-	//		description:	parses the next command from m_instrStream
-	//		calls:			add()
-	//						clearEntry()
-	//						clearAll()
-	//						divide()
-	//						exp()
-	//						getReg()
-	//						loadProgram()
-	//						mod()
-	//						multiply()
-	//						neg()
-	//						recordProgram()
-	//						rotateDown()
-	//						rotateUp()
-	//						runProgram()
-	//						saveToFile()
-	//
-	//		called by:		input()
-	//		parameters:		n/a
-	//		returns:		n/a
-	//		History Log:
-	//					6/10/2017 HN completed version 1.0
-	// -------------------------------------------------------------------------
-	void CRPNCalc::parse()
-	{
-		double number = 0;
-		while (m_buffer.length() != 0)
-		{
-			bool delDecimal = false;
-			//erase the spaces at the beginning of the string
-			while (m_buffer[0] == ' ')
-				m_buffer.erase(m_buffer.begin());
-			number = atof(m_buffer.c_str());
-			//if it is a number
-			if ((number != 0 && m_buffer[0] != '+') || m_buffer[0] == '0')
-			{
-				if (m_buffer[0] == '-')
-					m_buffer.erase(m_buffer.begin());
-				while ((m_buffer[0] >= '0' && m_buffer[0] <= '9')
-					|| m_buffer[0] == '.')
-				{
-					if (m_buffer[0] == '.')
-						if (delDecimal == false)
-							delDecimal = true;
-						else
-							break;
-					m_buffer.erase(m_buffer.begin());
-					if (m_buffer.length() == 0)
-						break;
-				}
-				m_stack.push_front(number);
-			}
-			else
-			{
-				string token;
-				//if the beginning is a character
-				if (m_buffer.length() >= 2)
-				{
-					//special situation with CE
-					if (toupper(m_buffer[0]) == 'C'
-						&& toupper(m_buffer[1]) == 'E')
-					{
-						m_buffer.erase(m_buffer.begin(), m_buffer.begin() + 2);
-						clearAll();
-						continue;
-					}
-					//special situation with -0
-					else if (m_buffer[0] == '-' && m_buffer[1] == '0')
-					{
-						m_buffer.erase(m_buffer.begin());
-						while (m_buffer[0] == '0')
-						{
-							m_buffer.erase(m_buffer.begin());
-							if (m_buffer.length() == 0)
-								break;
-						}
-						m_stack.push_front(number);
-						neg();
-						continue;
-					}
-					//special situation with S0-9
-					else if (toupper(m_buffer[0]) == 'S' &&
-						m_buffer[1] >= '0' && m_buffer[1] <= '9')
-					{
-						m_buffer.erase(m_buffer.begin()); // delete the 'S' to get the number
-						char index = m_buffer[0];
-						setReg(static_cast<int>(index) - ZEROINASCII);
-						m_buffer.erase(m_buffer.begin()); // delete the number
-						continue;
-					}
-					//special situation with G0-9
-					else if (toupper(m_buffer[0]) == 'G' &&
-						m_buffer[1] >= '0' && m_buffer[1] <= '9')
-					{
-						m_buffer.erase(m_buffer.begin()); // delete the 'G' to get the number
-						char index = m_buffer[0];
-						getReg(static_cast<int>(index) - ZEROINASCII);
-						m_buffer.erase(m_buffer.begin()); // delete the number
-						continue;
-					}
-				}
-				if (m_buffer.length() != 0)
-				{
-					token = m_buffer[0];
-					if (0 == token.compare("+"))
-						add();
-					else if (0 == token.compare("-"))
-						subtract();
-					else if (0 == token.compare("*"))
-						multiply();
-					else if (0 == token.compare("/"))
-						divide();
-					else if (0 == token.compare("^"))
-						exp();
-					else if (0 == token.compare("%"))
-						mod();
-					else if (0 == token.compare("c") || 0 == token.compare("C"))
-						clearEntry();
-					else if (0 == token.compare("d") || 0 == token.compare("D"))
-						rotateDown();
-					else if (0 == token.compare("f") || 0 == token.compare("F"))
-						saveToFile();
-					else if (0 == token.compare("h") || 0 == token.compare("H"))
-						m_helpOn = !m_helpOn;
-					else if (0 == token.compare("l") || 0 == token.compare("L"))
-						loadProgram();
-					else if (0 == token.compare("m") || 0 == token.compare("M"))
-						neg();
-					else if (0 == token.compare("p") || 0 == token.compare("P"))
-						recordProgram();
-					else if (0 == token.compare("r") || 0 == token.compare("R"))
-					{
-						//the application only do this method and ignore other methods
-						//if they are inputed at the same line
-						runProgram();
-						return;
-					}
-					else if (0 == token.compare("u") || 0 == token.compare("U"))
-						rotateUp();
-					else if (0 == token.compare("x") || 0 == token.compare("X"))
-						m_on = false;
-					else
-						m_error = true;
-					m_buffer.erase(m_buffer.begin());
-				}
-			}
-		}
-	}
-	//-------------------------------------------------------------------------
-	//		method:			add()
-	//		description:	if possible, pops top 2 elements from the stack,
-	//						adds them and pushes the result onto the stack
-	//		calls:			binary_prep()
-	//		called by:		parse()
-	//		parameters:		n/a
-	//		returns:		n/a
-	//		History Log:
-	//					6/10/2017 HN completed version 1.1
-	//					6/8/2017  HJ completed version 1.0
-	// -------------------------------------------------------------------------
-	void CRPNCalc::add()
-	{
-		double d1 = 0.0;
-		double d2 = 0.0;
-		binary_prep(d1, d2);
-		if (m_error)
-			return;
-		m_stack.push_front(d1 + d2);
-	}
-	//-------------------------------------------------------------------------
-	//		method:			binary_prep()
-	//		description:	Check if operation requiring two number from stack
-	//						is possible and save the popped value to argument's
-	//						address if it is possible
-	//		calls:			n/a
-	//		called by:		add()
-	//						subtract()
-	//						multiply()
-	//						divide()
-	//						exp()
-	//						mod()			
-	//						
-	//		parameters:		double& d1 -- address of operand 1
-	//						double& d2 -- address of operand 2
-	//		returns:		n/a
-	//		History Log:
-	//					6/10/2017 HN completed version 1.0
-	// -------------------------------------------------------------------------
-	void CRPNCalc::binary_prep(double& d1, double& d2)
-	{
-
-		if (m_stack.size() >= 2)
-		{
-			d1 = m_stack.front();
-			m_stack.pop_front();
-			d2 = m_stack.front();
-			m_stack.pop_front();
-		}
-		else
-		{
-			m_error = true;
-		}
-	}
-	//-------------------------------------------------------------------------
-	//		method:			clearEntry()
-	//		description:	Clear the last entered number
-	//		calls:			n/a
-	//		called by:		parse()	
-	//						
-	//		parameters:		n/a
-	//		returns:		n/a
-	//		History Log:
-	//					6/10/2017 HJ completed version 1.0
-	// -------------------------------------------------------------------------
-	void CRPNCalc::clearEntry()
-	{
-		if (!m_stack.empty())
-			m_stack.pop_front();
-	}
-	//-------------------------------------------------------------------------
-	//		method:			clearAll()
-	//		description:	Clear all the values stored in the stack
-	//		calls:			n/a
-	//		called by:		parse()	
-	//						
-	//		parameters:		n/a
-	//		returns:		n/a
-	//		History Log:
-	//					6/10/2017 HJ completed version 1.0
-	// -------------------------------------------------------------------------
-	void CRPNCalc::clearAll()
-	{
-		while (!m_stack.empty())
-			m_stack.pop_front();
-	}
-	//-------------------------------------------------------------------------
-	//		method:			divide()
-	//		description:	if possible, pops top 2 elements from the stack, 
-	//						divides them and pushes the result onto the stack
-	//		calls:			binary_prep()
-	//		called by:		parse()
-	//		parameters:		n/a
-	//		returns:		n/a
-	//		History Log:
-	//					6/10/2017 HN completed version 1.1
-	//					6/8/2017  HJ completed version 1.0
-	// -------------------------------------------------------------------------
-	void CRPNCalc::divide()
-	{
-		double d1 = 0.0;
-		double d2 = 0.0;
-		binary_prep(d1, d2);
-		if (m_error)
-			return;
-		if (d2 == 0)
-		{
-			//do nothing, push the numbers back
-			m_error = true;
-			m_stack.push_front(d1);
-			m_stack.push_front(d2);
-		}
-		else
-			m_stack.push_front(d1 / d2);
-	}
-	//-------------------------------------------------------------------------
-	//		method:			exp()
-	//		description:	if possible, pops top 2 elements from the stack, 
-	//						and exponentiate top value by the next value and 
-	//						pushes result back to the top
-	//		calls:			binary_prep()
-	//		called by:		parse()
-	//		parameters:		n/a
-	//		returns:		n/a
-	//		History Log:
-	//					6/10/2017 HN completed version 1.1
-	//					6/8/2017  CC completed version 1.0
-	// -------------------------------------------------------------------------
-	void CRPNCalc::exp()
-	{
-		double d1 = 0.0;
-		double d2 = 0.0;
-		binary_prep(d1, d2);
-		if (m_error)
-			return;
-		if (d1 == 0 && d2 == 0)
-		{
-			//do nothing, push the numbers back
-			m_error = true;
-			m_stack.push_front(d1);
-			m_stack.push_front(d2);
+			clearError();
 		}
-		else
-			m_stack.push_front(pow(d1, d2));
-	}
-	//-------------------------------------------------------------------------
-	//		method:			getReg()
-	//		description:	pushes the given register's value onto the stack
-	//		calls:			n/a
-	//		called by:		parse()
-	//		parameters:		int reg -- size of the register
-	//		returns:		n/a
-	//		History Log:
-	//					6/10/2017 HN completed version 1.0
-	// -------------------------------------------------------------------------
-	void CRPNCalc::getReg(int reg)
-	{
-		if (reg >= 0 && reg <= 9)
-			m_stack.push_front(m_registers[reg]);
-		else
-			m_error = true;
 	}
 	//-------------------------------------------------------------------------
 	//		method:			loadProgram()
 	//		description:	retrieves the filename from the user and loads it 
 	//						into m_program
-	//		calls:			n/a
-	//		called by:		parse()
+	//		calls:			prompt()
+	//						CRPNEngine::loadProgramFile()
+	//		called by:		CRPNEngine::parse()
+	//						CRPNEngine::execute()
 	//		parameters:		n/a
 	//		returns:		n/a
 	//		History Log:
 	//					6/10/2017 HN completed version 1.0
+	//					10/17/2026 HJ file reading moved to the engine
 	// -------------------------------------------------------------------------
 	void CRPNCalc::loadProgram()
 	{
-		ifstream fin;
 		string filename;
-		cout << "Please enter the name for the file: ";
-		cin >> filename;
-		cin.ignore(BUFFERSIZE, '\n');
-		filename = filename;
-		fin.open(filename);
-		if (fin.is_open())
-		{
-			while (!m_program.empty())
-				m_program.pop_front();
-			string input;
-			while (!fin.eof())
-			{
-				getline(fin, input);
-				m_program.push_back(input);
-			}
-			fin.close();
-		}
-	}
-	//-------------------------------------------------------------------------
-	//		method:			mod()
-	//		description:	if possible, pops top 2 elements from the stack, 
-	//						and mod top value by the next value and pushes
-	//						result back to the top
-	//		calls:			binary_prep()
-	//		called by:		parse()
-	//		parameters:		n/a
-	//		returns:		n/a
-	//		History Log:
-	//					6/10/2017 HN completed version 1.1
-	//					6/8/2017  HJ completed version 1.0
-	// -------------------------------------------------------------------------
-	void CRPNCalc::mod()
-	{
-		double d1 = 0.0;
-		double d2 = 0.0;
-		binary_prep(d1, d2);
-		if (m_error)
-			return;
-		if (d2 == 0)
-		{
-			//do nothing, push the numbers back
-			m_error = true;
-			m_stack.push_front(d1);
-			m_stack.push_front(d2);
-		}
-		else
-			m_stack.push_front(fmod(d1, d2));
-	}
-	//-------------------------------------------------------------------------
-	//		method:			multiply()
-	//		description:	if possible, pops top 2 elements from the stack, 
-	//						and multiply top value by the next value and pushes
-	//						result back to the top
-	//		calls:			binary_prep()
-	//		called by:		parse()
-	//		parameters:		n/a
-	//		returns:		n/a
-	//		History Log:
-	//					6/10/2017 HN completed version 1.1
-	//					6/8/2017  CC completed version 1.0
-	// -------------------------------------------------------------------------
-	void CRPNCalc::multiply()
-	{
-		double d1 = 0.0;
-		double d2 = 0.0;
-		binary_prep(d1, d2);
-		if (m_error)
-			return;
-		m_stack.push_front(d1 * d2);
-	}
-	//-------------------------------------------------------------------------
-	//		method:			neg()
-	//		description:	if possible, pops the first value then multiply it
-	//						by negative 1 and pushes the returned value back
-	//		calls:			binary_prep()
-	//		called by:		parse()
-	//		parameters:		n/a
-	//		returns:		n/a
-	//		History Log:
-	//					6/10/2017 HN completed version 1.1
-	//					6/8/2017  HJ completed version 1.0
-	// -------------------------------------------------------------------------
-	void CRPNCalc::neg()
-	{
-		double d = 0;
-		unary_prep(d);
-		if (m_error)
-			return;
-		d *= -1.0;
-		m_stack.push_front(d);
-	}
-	//-------------------------------------------------------------------------
-	//		method:			unary_prep(double& d)
-	//		description:	if possible, pops the first value of the stack then
-	//						assign it to the address of the argument.
-	//		calls:			n/a
-	//		called by:		neg()
-	//		parameters:		double& d --address of the variable assigning to
-	//		returns:		n/a
-	//		History Log:
-	//					6/10/2017 HN completed version 1.1
-	//					6/8/2017  HJ completed version 1.0
-	// -------------------------------------------------------------------------
-	void CRPNCalc::unary_prep(double& d)
-	{
-		if (!m_stack.empty())
-		{
-			d = m_stack.front();
-			m_stack.pop_front();
-		}
-		else
-		{
-			m_error = true;
-		}
+		prompt("Please enter the name for the file: ");
+		*m_in >> filename;
+		m_in->ignore(BUFFERSIZE, '\n');
+		loadProgramFile(filename);
 	}
 	//-------------------------------------------------------------------------
 	//		method:			recordProgram()
-	//		description:	takes command-line input and loads it into m_program 
-	//		calls:			n/a
-	//		called by:		parse()
+	//		description:	takes command-line input and loads it into m_program;
+	//						the end of input also ends the recording.  The
+	//						lines are gathered in m_recording, which keeps its
+	//						capacity, so recording again does not allocate.
+	//						Only a P operator token ends the recording, so
+	//						a name or label with a p in it is recorded.
+	//		calls:			CRPNTokenizer::next()
+	//						CRPNOperators::find()
+	//						CRPNEngine::setProgramText()
+	//		called by:		CRPNEngine::parse()
+	//						CRPNEngine::execute()
 	//		parameters:		n/a
 	//		returns:		n/a
 	//		History Log:
 	//					6/10/2017 HN completed version 1.0
+	//					10/17/2026 HJ reuse the recording buffers, version 1.1
+	//					10/17/2026 HJ ends at a P token, version 1.2
 	// -------------------------------------------------------------------------
 	void CRPNCalc::recordProgram()
 	{
+		m_recording.clear();
 		m_programRunning = true;
 		int j = 0;
-		while (!m_program.empty())
-			m_program.pop_front();
 		while (m_programRunning)
 		{
-			string token;
-			int i = 0;
-			cout << j << "> ";
+			if (m_prompts)
+				*m_out << j << "> ";
 			j++;
-			getline(cin, token);
-			for (; i < token.length(); i++)
-				if (toupper(token[i]) == 'P')
-					break;
-			if (i != token.length())
+			if (!getline(*m_in, m_recordLine))
 			{
 				m_programRunning = false;
-				token.erase(token.begin() + i, token.end());
+				break;
 			}
-			m_program.push_back(token);
-		}
-	}
-	//-------------------------------------------------------------------------
-	//		method:			rotateDown()
-	//		description:	removes the bottom of the stack and adds it to the
-	//						top
-	//		calls:			n/a
-	//		called by:		parse()
-	//		parameters:		n/a
-	//		returns:		n/a
-	//		History Log:
-	//					6/8/2017 HJ completed version 1.0
-	//-------------------------------------------------------------------------
-	void CRPNCalc::rotateDown()
-	{
-		if (!m_stack.empty())
-		{
-			double temp = m_stack.back();
-			m_stack.pop_front();
-			m_stack.push_back(temp);
-		}
-		else
-			m_error = true;
-	}
-	//-------------------------------------------------------------------------
-	//		method:			rotateDown()
-	//		description:	removes the top of the stack and adds it to the
-	//						bottom
-	//		calls:			n/a
-	//		called by:		parse()
-	//		parameters:		n/a
-	//		returns:		n/a
-	//		History Log:
-	//					6/8/2017 HJ completed version 1.0
-	//-------------------------------------------------------------------------
-	void CRPNCalc::rotateUp()
-	{
-		if (!m_stack.empty()) {
-			double temp = m_stack.front();
-			m_stack.pop_front();
-			m_stack.push_back(temp);
-		}
-		else
-		{
-			m_error = true;
-		}
-	}
-	//-------------------------------------------------------------------------
-	//		method:			runProgram()
-	//		description:	runs the program in m_program 
-	//		calls:			n/a
-	//		called by:		parse()
-	//		parameters:		n/a
-	//		returns:		n/a
-	//		History Log:
-	//					6/8/2017 HN completed version 1.0
-	//-------------------------------------------------------------------------
-	void CRPNCalc::runProgram()
-	{
-		list<string>::const_iterator sit = m_program.begin();
-		while (sit != m_program.end())
-		{
-			m_buffer = *sit;
-			parse();
-			sit++;
+			// the line is recorded up to the P, and the rest dropped
+			size_t end = m_recordLine.length();
+			CRPNTokenizer tokenizer(m_recordLine);
+			SToken token;
+			while (tokenizer.next(token))
+				if (token.type == TOK_OPERATOR
+					&& CRPNOperators::find(token.op).op == OP_RECORD)
+				{
+					end = tokenizer.position() - 1;
+					m_programRunning = false;
+					break;
+				}
+			m_recording.append(m_recordLine, 0, end);
+			m_recording += '\n';
 		}
+		setProgramText(m_recording);
 	}
 	//-------------------------------------------------------------------------
 	//		method:			saveToFile()
 	//		description:	asks the user for a filename and saves m_program
-	//						to that file
-	//		calls:			n/a
-	//		called by:		parse()
+	//						to that file; as a program file if the name ends
+	//						in PROGRAMFILEEXTENSION, otherwise as text
+	//		calls:			prompt()
+	//						CRPNEngine::saveProgramFile()
+	//						CRPNEngine::saveProgramBinary()
+	//		called by:		CRPNEngine::parse()
+	//						CRPNEngine::execute()
 	//		parameters:		n/a
 	//		returns:		n/a
 	//		History Log:
 	//					6/8/2017 HN completed version 1.0
+	//					10/17/2026 HJ file writing moved to the engine
+	//					10/17/2026 HJ program files, version 1.1
 	//-------------------------------------------------------------------------
 	void CRPNCalc::saveToFile()
 	{
-		ofstream fout;
 		string filename;
-		cout << "Please enter the name for the file: ";
-		cin >> filename;
-		cin.ignore(BUFFERSIZE, '\n');
-		filename = filename;
-		fout.open(filename, 'w');
-		if (fout.is_open())
-		{
-			list<string>::const_iterator sit = m_program.begin();
-			while (sit != m_program.end())
-			{
-				fout << *sit;
-				fout << endl;
-				sit++;
-			}
-			fout.close();
-		}
+		prompt("Please enter the name for the file: ");
+		*m_in >> filename;
+		m_in->ignore(BUFFERSIZE, '\n');
+		const size_t extension = sizeof(PROGRAMFILEEXTENSION) - 1;
+		if (filename.size() > extension && filename.compare(
+			filename.size() - extension, extension, PROGRAMFILEEXTENSION) == 0)
+			saveProgramBinary(filename);
+		else
+			saveProgramFile(filename);
 	}
 	//-------------------------------------------------------------------------
-	//		method:			setReg()
-	//		description:	if the index of register is within limits of 0 
-	//						and 10 take the top of the stack and asign it to 
-	//						given index
+	//		method:			toggleHelp()
+	//		description:	H command; shows or hides the help menu
 	//		calls:			n/a
-	//		called by:		parse()
-	//		parameters:		int reg --index of the register
+	//		called by:		CRPNEngine::parse()
+	//						CRPNEngine::execute()
+	//		parameters:		n/a
 	//		returns:		n/a
 	//		History Log:
-	//					6/8/2017 HN completed version 1.0
-	//-------------------------------------------------------------------------
-	void CRPNCalc::setReg(int reg)
+	//					10/17/2026 HJ completed version 1.0
+	// -------------------------------------------------------------------------
+	void CRPNCalc::toggleHelp()
 	{
-		if (reg >= 0 && reg <= 9 && !m_stack.empty())
-			m_registers[reg] = m_stack.front();
-		else
-			m_error = true;
+		m_helpOn = !m_helpOn;
 	}
 	//-------------------------------------------------------------------------
-	//		method:			subtract()
-	//		description:	Take two values from the stack, subtract them 
-	//						then push it back to the register
+	//		method:			turnOff()
+	//		description:	X command; ends run() or runBatch()
 	//		calls:			n/a
-	//		called by:		parse()
+	//		called by:		CRPNEngine::parse()
+	//						CRPNEngine::execute()
 	//		parameters:		n/a
 	//		returns:		n/a
 	//		History Log:
-	//					6/11/2016 HJ completed version 1.1
-	//					6/8/2017 HN completed version 1.0
-	//-------------------------------------------------------------------------
-	void CRPNCalc::subtract()
+	//					10/17/2026 HJ completed version 1.0
+	// -------------------------------------------------------------------------
+	void CRPNCalc::turnOff()
 	{
-		double d1 = 0.0;
-		double d2 = 0.0;
-		binary_prep(d1, d2);
-		if (m_error)
-			return;
-		m_stack.push_front(d1 - d2);
+		m_on = false;
 	}
 	//-------------------------------------------------------------------------
 	//		method:			input(istream &istr)
-	//		description:	get line from std::cin and parse input
+	//		description:	get line from istr and parse input; commands
+	//						that need more input (P, L, F) read it from istr
+	//						too.  At the end of istr the calculator turns off.
 	//		calls:			parse()
-	//		called by:		loadProgram()
+	//		called by:		run()
 	//						operator>> () 
 	//		parameters:		istream &istr address of the stream to load it to
 	//		returns:		n/a
 	//		History Log:
 	//					6/11/2016 HJ completed version 1.1
 	//					6/8/2017 HN completed version 1.0
+	//					10/17/2026 HJ reads istr, version 1.2
 	//-------------------------------------------------------------------------
 	void CRPNCalc::input(istream &istr)
 	{
+		istream* savedIn = m_in;
+		m_in = &istr;
 		try
 		{
-			if (getline(cin, m_buffer))
-				parse();
+			if (getline(istr, m_buffer))
+				parse(m_buffer);
 			else
+			{
+				m_on = false;
 				throw invalid_argument("Could not read input.");
+			}
 		}
-		catch (invalid_argument e)
+		catch (const invalid_argument& e)
 		{
-			cout << e.what() << endl;
+			*m_out << e.what() << endl;
 		}
+		m_in = savedIn;
+	}
+	//-------------------------------------------------------------------------
+	//		method:			prompt(const char* text)
+	//		description:	shows text on the output stream unless prompts
+	//						are off (batch mode)
+	//		calls:			n/a
+	//		called by:		loadProgram()
+	//						saveToFile()
+	//		parameters:		const char* text -- the prompt
+	//		returns:		n/a
+	//		History Log:
+	//					10/17/2026 HJ completed version 1.0
+	//-------------------------------------------------------------------------
+	void CRPNCalc::prompt(const char* text)
+	{
+		if (m_prompts)
+			*m_out << text;
 	}
 	//-------------------------------------------------------------------------
 	//		method:			operator <<(ostream &ostr, CRPNCalc &calc)
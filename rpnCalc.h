@@ -7,18 +7,14 @@
 #ifndef RPNCALC_H
 #define RPNCALC_H
 
-#include <algorithm>
-#include <cmath>
-#include <cstdlib>
+#include <cstdio>
 #include <exception>
-#include <fstream>
 #include <iostream>
-#include <iterator>
 #include <list>
+#include <stdexcept>
 #include <string>
-#include <new>
-#include <sstream>
-#include <stack>
+#include <string_view>
+#include "rpnEngine.h"
 //----------------------------------------------------------------------------
 //
 //    Title:		RPNCalc Class
@@ -36,17 +32,18 @@
 //       Software: Windows 7
 //       Compiles under Microsoft Visual Studio 2010
 // 
-//	  class CRPNCalc:
+//	  class CRPNCalc : public CRPNEngine:
 //
 //	  Properties:
-//		double m_registers[10] -- 
-//		string m_buffer -- 
-//		stack<string> m_stack -- 
-//		vector<list<string>> m_programs(NUMPROGRAMS) -- 
-//		istringstream m_inStrStream -- 
-//		m_on -- 
-//		bool m_error --
-//		bool m_helpOn --  
+//		string m_buffer -- the line being parsed
+//		bool m_helpOn -- show the help menu
+//		bool m_on -- run() keeps going while set
+//		bool m_programRunning -- P is recording
+//		istream* m_in -- commands and P/L/F answers
+//		ostream* m_out -- display and prompts
+//		bool m_prompts -- false in batch mode
+//		string m_recording -- the program P is recording
+//		string m_recordLine -- the line P is reading
 //
 //	  Methods:
 //	
@@ -54,38 +51,30 @@
 //
 //		non-inline:
 //		public:
-//			CRPNCalc(bool on);
+//			CRPNCalc(istream& istr, ostream& ostr);
 //			void run();                                        
+//			void runBatch(istream& istr, ostream& ostr);
 //			void print(ostream& ostr);
 //			void input(istream& istr);
-//		private:
-//				
-//			void add() -- 
-//			void bin_prep(double& d1, double& d2) -- 
-//			void clear() -- 
-//			void clearAll() -- 
-//			void divide() -- 
-//			void exp() -- 
-//			void getReg(int reg) -- 
+//		protected:
 //			void loadProgram() -- 
-//			void mod() -- 
-//			void multiply() -- 
-//			void neg() -- 
-//			void parse() -- 
 //			void recordProgram() -- 
-//			void rotateUp() -- 
-//			void rotateDown() -- 
-//			void runProgram() -- 
 //			void saveToFile() -- 
-//			void setReg(int reg) -- 
-//			void subtract() -- 
-//			void unary_prep(double& d) -- 		   
+//			void toggleHelp() -- 
+//			void turnOff() -- 
+//		private:
+//			void prompt(const char* text) -- 
 //
 //    History Log:
 //			4/20/03	PB  completed version 1.0
 //			5/27/05	PB  minor modifications 1.01
 //			5/3/11	PB  minor modifications 1.02
 //			6/3/12  PB  minor modifications 1.03
+//			10/17/26 HJ evaluation moved to CRPNEngine 2.0
+//			10/17/26 HJ recording buffers kept 2.01
+//			10/17/26 HJ U:k and D:k in the help menu 2.02
+//			10/17/26 HJ labels and branches in the help menu 2.03
+//			10/17/26 HJ R:name in the help menu 2.04
 // ----------------------------------------------------------------------------
 
 using namespace std;
@@ -96,56 +85,46 @@ namespace PB_CALC
 	const char helpMenu[] = "C clear stack   | CE clear entry  | D rotate down"
 		"  | F save program to file\nG0-G9 get reg n | H help on/off   | "
 		"L load program | M +/- | P program on/off\nR run program   | "
-		"S0-S9 set reg n | U rotate up    | X exit\n";
+		"S0-S9 set reg n | U rotate up    | X exit\n"
+		"S:name set, G:name get a named register | U:k, D:k rotate by k\n"
+		"R:name run a library program\n"
+		"in programs: :name label | J:name jump | <: >: =: !:name compare and "
+		"branch\nK0:name-K9:name count down reg n, loop | @:name call | ; "
+		"return\n";
 
 	const char line[] = "____________________________________________________"
 		"________________________\n";
 
-	const unsigned short NUMREGS = 10;
 	const unsigned short BUFFERSIZE = 256;
-	const unsigned short ZEROINASCII = 48;
 
-	class CRPNCalc
+	class CRPNCalc : public CRPNEngine
 	{
 	public:
-		CRPNCalc(bool on = true);
+		CRPNCalc(istream& istr = cin, ostream& ostr = cout);
 		void run();
+		void runBatch(istream& istr, ostream& ostr);
 		void print(ostream& ostr);  // changes m_error on error, so not const
 		void input(istream& istr);
 
-	private:
-		// private methods
-		void add();
-		void binary_prep(double& d1, double& d2);
-		void clearEntry();
-		void clearAll();
-		void divide();
-		void exp();
-		void getReg(int reg);
+	protected:
 		void loadProgram();
-		void mod();
-		void multiply();
-		void neg();
-		void parse();
 		void recordProgram();
-		void rotateUp();
-		void rotateDown();
-		void runProgram();
 		void saveToFile();
-		void setReg(int reg);
-		void subtract();
-		void unary_prep(double& d);
+		void toggleHelp();
+		void turnOff();
+
+	private:
+		void prompt(const char* text);
 
-		// private properties
-		double m_registers[NUMREGS];
 		string m_buffer;
-		deque<double> m_stack;
-		list<string> m_program;
-		istringstream m_instrStream;
-		bool m_error;
 		bool m_helpOn;
 		bool m_on;
 		bool m_programRunning;
+		istream* m_in;			// commands and P/L/F answers
+		ostream* m_out;			// display and prompts
+		bool m_prompts;			// false in batch mode
+		string m_recording;
+		string m_recordLine;
 	};
 
 	ostream &operator <<(ostream &ostr, CRPNCalc &calc);
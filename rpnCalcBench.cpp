@@ -0,0 +1,3190 @@
+//----------------------------------------------------------------------------
+// rpnCalcBench.cpp
+//
+// functions: main()
+//----------------------------------------------------------------------------
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <cstdio>
+#include <deque>
+#include <fstream>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <list>
+#include <new>
+#include <random>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+#if defined(__linux__)
+#include <cerrno>
+#include <fcntl.h>
+#include <sys/epoll.h>
+#include <sys/socket.h>
+#include <sys/time.h>
+#include <sys/un.h>
+#include <unistd.h>
+#endif
+#include "rpnBatch.h"
+#include "rpnCalc.h"
+#include "rpnMappedFile.h"
+#include "rpnNumeric.h"
+#include "rpnServer.h"
+#include "rpnVector.h"
+
+using namespace std;
+using namespace PB_CALC;
+//----------------------------------------------------------------------------
+//	Title:			Benchmarks for RPN Calculator
+//	Description:	This file contains function main() and the benchmark
+//					workloads.  Every workload is deterministic so runs can
+//					be compared against each other.  Most groups also
+//					check the results they time, and main() reports each
+//					group's checks.
+//	Programmer:		Han Jung
+//	Version:		2.5
+//	Environment:	Intel Xeon PC
+//					Software:   MS Windows 10 for execution;
+//					Compiles under Microsoft Visual C++ 2017 (/std:c++17)
+//	History Log:
+//					10/17/2026  HJ  tokenizer benchmarks, version 1.0
+//					10/17/2026  HJ  operator, rotation and save costs;
+//									JSON/CSV reports, version 1.1
+//					10/17/2026  HJ  numeric modes, version 1.2
+//					10/17/2026  HJ  heap allocation counts, version 1.3
+//					10/17/2026  HJ  named registers, version 1.4
+//					10/17/2026  HJ  branches, loops and calls, version 1.5
+//					10/17/2026  HJ  library programs, version 1.6
+//					10/17/2026  HJ  binary program files, version 1.7
+//					10/17/2026  HJ  server load generator, version 1.8
+//					10/17/2026  HJ  custom operators added before any
+//									engine, version 1.9
+//					10/17/2026  HJ  results by group, --check, version 2.0
+//					10/17/2026  HJ  operator costs from registers, checked,
+//									version 2.1
+//					10/17/2026  HJ  typed engine conformance, version 2.2
+//					10/17/2026  HJ  a loop recorded through P, version 2.3
+//					10/17/2026  HJ  server sessions copy a compiled library,
+//									version 2.4
+//					10/17/2026  HJ  a looping server session, version 2.5
+//----------------------------------------------------------------------------
+
+// heap allocations made by this thread; operator new below counts them so
+// the alloc benchmark can check that steady-state work allocates nothing
+thread_local uint64_t g_allocations = 0;
+
+// GCC pairs the inlined delete below with the new it came from and, seeing
+// free() on memory from operator new, warns although the pair matches
+#if defined(__GNUC__) && !defined(__clang__) && __GNUC__ >= 11
+#pragma GCC diagnostic ignored "-Wmismatched-new-delete"
+#endif
+
+//----------------------------------------------------------------------------
+//	Function:		operator new(size_t size)
+//	Description:	malloc() with a count in g_allocations; the other
+//					forms of new and delete forward here and to free()
+//	Returns:		the memory; throws bad_alloc when there is none
+//----------------------------------------------------------------------------
+void* operator new(size_t size)
+{
+	g_allocations++;
+	if (void* p = malloc(size > 0 ? size : 1))
+		return p;
+	throw bad_alloc();
+}
+
+void* operator new[](size_t size)
+{
+	return operator new(size);
+}
+
+void operator delete(void* p) noexcept
+{
+	free(p);
+}
+
+void operator delete[](void* p) noexcept
+{
+	operator delete(p);
+}
+
+void operator delete(void* p, size_t) noexcept
+{
+	operator delete(p);
+}
+
+void operator delete[](void* p, size_t) noexcept
+{
+	operator delete(p);
+}
+namespace
+{
+	typedef chrono::steady_clock benchClock;
+
+	// one repetition of the tokenizer workload; covers numbers, "-0",
+	// "CE", registers and single character operators
+	const char tokenizerPattern[] = "12.5 3 + 4 * -7 - S1 G1 / -0 .25 ^ CE ";
+
+	// a small register-driven program whose lines leave the stack empty,
+	// so it can be run any number of times
+	const char* const programLines[] =
+	{
+		"G0 1 + 1000 % S0 C",
+		"G0 3 * 2 + G0 * 1 - S1 C",
+		"G1 2 / 7 % S2 C",
+		"G2 2 ^ G1 - S3 C CE"
+	};
+	const size_t programRuns = 200000;
+
+	// the same kind of program written with constant subexpressions,
+	// M M pairs and push-then-op runs for the optimizer to remove
+	const char* const foldLines[] =
+	{
+		"G0 2 3 * 4 + + 1000 % S0 C",
+		"G0 M M 0.5 2 * * 1 2 + + S1 C",
+		"G1 8 4 / / 6 1 + % S2 C",
+		"G2 1 1 + ^ G1 - M M S3 C CE"
+	};
+
+	// operators in the stack benchmark chain; the operand pushed before
+	// each one is never zero, so every operation succeeds
+	const char chainOps[] = "+-*/^%";
+	const size_t chainLength = 6000000;
+
+	const size_t batchLines = 1000000;
+
+	const size_t threadRuns = 200000;
+
+	// default size of the parallel batch workload; --parallel-lines sets
+	// it (the full-size run is 100000000 lines)
+	const size_t defaultParallelLines = 4000000;
+
+	// the file load workload, written to loadFileName and removed after
+	const size_t loadLines = 2000000;
+	const char loadFileName[] = "rpnCalcBench.tmp";
+
+	// the program file workload: binaryLines lines of seven instructions,
+	// saved as text to loadFileName and as a program file to
+	// binaryFileName
+	const size_t binaryLines = 300000;
+	const char binaryFileName[] = "rpnCalcBench.rpnb";
+
+	// the server workload: serverConnections sessions on a Unix socket
+	// at serverSocketName, each sending serverRequests requests with up
+	// to serverDepths[i] of them unanswered.  A session's k-th request
+	// returns k, which checks both its order and that its register is
+	// its own.
+	const size_t serverConnections = 1000;
+	const size_t serverRequests = 200;
+	const size_t serverDepths[] = { 1, 16 };
+	const char serverSocketName[] = "rpnCalcBench.sock";
+	const char serverRequest[] = "G0 1 + S0\n";
+	// a session's input, ended by the client closing its side, and the
+	// results it must get: errors, an empty stack, CRLF, a shell command,
+	// a program from serverLibraryText and a last line with no line break
+	const char serverCheckInput[] =
+		"1 2 +\n0 5 /\nCE\r\nL\nG0 1 + S0\n4 R:sq\n3 4 *";
+	const char serverCheckOutput[] =
+		"3\n<<error>>\n\n<<error>>\n1\n16\n12\n";
+	// the server's library, removed before the first session opens
+	const char serverLibraryText[] = "[sq]\nS0 C G0 G0 *\n[spin]\n:a J:a\n";
+	// a session that never leaves a loop, and what it must get with
+	// the server's default jump limit: an error per request, the runs
+	// of a line sharing one budget, and the session still usable
+	const char serverLoopInput[] = "R:spin\nR:spin R:spin R:spin 1\n1 2 +\n";
+	const char serverLoopOutput[] = "<<error>>\n<<error>>\n3\n";
+
+	// a program for vector mode over two stack values and registers
+	// G0-G3; G1 and the bottom of the stack are zero in some rows, so
+	// some rows divide or mod by zero
+	const char* const vectorLines[] =
+	{
+		"G0 G1 + S4 C",
+		"G2 G3 * G1 / S5 C",
+		"G4 2 ^ G0 - S6 C",
+		"U M + G5 %",
+		"D 3 * G6 - S7"
+	};
+	const size_t vectorRows = 1000000;
+
+	// numeric I/O: numbers formatted and parsed per pass; a quarter are
+	// integers, a quarter short decimals and half random bit patterns
+	const size_t numberCount = 1000000;
+
+	// a longer program for the result cache, run from cacheStates
+	// different values of G0 in turn; the last line leaves its result
+	// on the stack
+	const char* const cacheLines[] =
+	{
+		"G0 1.5 ^ G0 3 * + 7 % S1 C",
+		"G1 G0 * 2.5 ^ 1000 % S2 C",
+		"G2 G1 / G0 + 0.75 ^ S3 C",
+		"G3 G2 * G1 - 13 % S4 C",
+		"G4 G3 + 1.25 ^ G2 % S5 C",
+		"G5 G4 * G3 / G0 1 + ^ 97 %"
+	};
+	const size_t cacheStates = 64;
+	const size_t cacheRuns = 1000000;
+	// capacities timed; the smaller one cannot hold every state, so a
+	// round-robin walk over the states never hits
+	const size_t cacheCapacities[] = { 0, 2 * cacheStates, cacheStates / 2 };
+
+	// numeric modes: a ledger of price x quantity lines added up in S0,
+	// whose exact total is known, and the same amounts with tax and a
+	// divide, whose decimal results need more than 19 digits unless the
+	// precision is small
+	const size_t numericLines = 200000;
+	const unsigned numericPrecisions[] = { 16, DEFAULTPRECISION, 100 };
+	// lines with a known exact decimal result at DEFAULTPRECISION
+	const char* const decimalChecks[][2] =
+	{
+		{ "0.2 0.1 +", "0.3" },
+		{ "1.10 2 *", "2.20" },
+		{ "2 1.05 ^", "1.1025" },
+		{ "3 1 /", "0.3333333333333333333333333333333333" },
+		{ "4 1 /", "0.25" },
+		{ "3 10 %", "1" },
+		{ "0.000001 1e30 +", "1000000000000000000000000000000.000" }
+	};
+	// the typed engines' conformance: conformanceLines random lines of
+	// 1 to 8 of conformanceTokens, every command the typed engines share
+	// with CRPNEngine, run in order on both with conformanceProgram for
+	// R.  The double engine must give CRPNEngine's result for each.
+	const size_t conformanceLines = 20000;
+	const char* const conformanceTokens[] =
+	{
+		"0", "1", "2.5", "-3", "-0", "1e3", ".5", "+", "-", "*", "/", "^",
+		"%", "M", "C", "CE", "U", "D", "U:2", "D:3", "S0", "G0", "S3",
+		"G3", "S:acc", "G:acc", "R", "H"
+	};
+	const char conformanceProgram[] = "G0 1 + S0 C\nG:acc 2 * S:acc U D:2";
+	// commands only CRPNEngine runs; every typed engine gives an error
+	const char* const doubleOnlyLines[] =
+	{
+		"1 :a", "J:a", "1 2 <:a", "1 S0 K0:a", "@:a", ";", "R:a", "L", "P",
+		"F", "1 2 |"
+	};
+
+	// allocation counts: every scenario is warmed up once, then repeated
+	// allocRuns times while g_allocations is watched
+	const size_t allocRuns = 100000;
+	// batch input sizes in lines, about; the counts for the two must be equal
+	const size_t allocBatchLines[] = { 100000, 1000000 };
+	// programs recorded through CRPNCalc's P for the batch scenario
+	const char allocRecording[] = "P\nG0 1 + S0 C\nG0 2 * 7 % P\nR\nC\n";
+
+	// operator cost: each op is timed in groups of "G0 G1 op S2 C" (or
+	// "G0 M S2 C" for M) against the same groups without the op.  The
+	// operands come from registers, opLeft in register 1 (the top) and
+	// opRight in register 0, so the optimizer cannot fold them away.
+	const char opList[] = "+-*/^%M";
+	const double opLeft = 2.5;
+	const double opRight = 1.5;
+	const size_t opGroupsPerLine = 64;
+	const size_t opLines = 16;
+	const size_t opRuns = 2000;
+	const int opRepeats = 9;		// the fastest of these is kept
+
+	// operator dispatch: a token stream of dispatchTokens operators is
+	// looked up dispatchRuns times, and lines of dispatchTokens groups of
+	// "G0 op" are parsed and run as a program with + and with a custom
+	// operator that adds as well
+	const char dispatchOps[] = "+-*/^%CDFHLMPRUX";
+	const size_t dispatchTokens = 1000;
+	const size_t dispatchRuns = 2000;
+
+	// rotation cost by stack depth: each rotation is timed in groups of
+	// "U S0" against groups of "S0", since back to back rotations are
+	// merged by the optimizer.  U:k and D:k rotate by half the depth, the
+	// most a rotation copies; the depths leave the ring part empty, as
+	// full rings rotate without copying.
+	const size_t rotateDepths[] = { 2, 16, 250, 4000 };
+	const size_t rotatesPerLine = 1000;
+	const size_t rotateRuns = 2000;
+	// rotation self-check: depths and counts tried against a deque
+	const size_t rotateCheckDepths[] = { 1, 2, 3, 7, 64, 65, 1000 };
+	const size_t rotateCheckCounts[] = { 0, 1, 2, 3, 5, 32, 63, 64, 999,
+		1000, 1001, 123456789 };
+
+	// named registers: accumulators each updated once per run, held in
+	// named registers or on the stack and brought to the top with U; the
+	// run count shrinks as the count grows so every row does
+	// registerWork updates
+	const size_t registerCounts[] = { 16, 64, 256, 1000 };
+	const size_t registerWork = 4000000;
+
+	// control flow: loops run inside one R, a counted loop of
+	// loopIterations, and a compare-and-branch loop and a loop that calls
+	// a subroutine of branchIterations, against the loop body run once
+	// per R from the host
+	const double loopIterations = 1e8;
+	const double branchIterations = 1e7;
+	const size_t drivenRuns = 1000000;
+	// loop self-check: programs, and the top and error they end with
+	const struct
+	{
+		const char* program;
+		EvalResult status;
+		double top;
+	} loopChecks[] = {
+		{ "0 S1 10 S0 :a G1 G0 + S1 C K0:a G1", EVAL_OK, 55 },
+		{ "0 S1 10 S0\n:A G1 G0 + S1 C\nk0:a G1", EVAL_OK, 55 },
+		{ "1 2 J:x 100 + :x +", EVAL_OK, 3 },
+		{ "5 3 <:x 1 J:e :x 2 :e", EVAL_OK, 2 },
+		{ "3 5 <:x 1 J:e :x 2 :e", EVAL_OK, 1 },
+		{ "3 2 >:x 1 J:e :x 2 :e", EVAL_OK, 1 },
+		{ "2 2 =:x 1 J:e :x 2 :e", EVAL_OK, 2 },
+		{ "2 3 !:x 1 J:e :x 2 :e", EVAL_OK, 2 },
+		{ "3 @:sq 1 + J:e :sq S0 G0 * ; :e", EVAL_OK, 10 },
+		{ "1 ; 2", EVAL_OK, 1 },
+		{ "1 S0 2 :x 3 + G0 1 + S0 C 3 G0 >:x", EVAL_OK, 5 },
+		{ "0 @:f 7 J:e :f 1 / ; :e", EVAL_ERROR, 7 },
+		{ "1 <:x 5 :x", EVAL_ERROR, 5 },
+		{ "J:nowhere", EVAL_ERROR, 0 },
+		{ ":a :a 1", EVAL_ERROR, 1 },
+		{ "@:r :r @:r", EVAL_ERROR, 0 },
+		{ ":a J:a", EVAL_ERROR, 0 }
+	};
+	const uint64_t loopCheckJumps = 100000;
+	// a loop recorded through CRPNCalc's P, whose label and register
+	// names have a p in them, run by the batch; only the P token ends
+	// the recording, so the loop runs 3 times
+	const char recordedLoop[] = "P\n3 S0 0 S:up\n:loop G:up 1 + S:up K0:loop\n"
+		"G:up P\nR\nG:up\n";
+	const char recordedLoopOutput[] = "\n3\n3\n";
+
+	// library programs: a library file, written to libraryFileName, whose
+	// programs call each other, some before they are defined
+	const char libraryFileName[] = "rpnCalcLibrary.tmp";
+	const char libraryText[] =
+		"[chain]\n"
+		"R:sq R:inc\n"
+		"[poly]\n"
+		"S0 C G0 G0 * 3 * G0 2 * + 1 +\n"
+		"[scale]\n"
+		"0.5 *\n"
+		"[inc]\n"
+		"1 +\n"
+		"[sq]\n"
+		"S0 C G0 G0 *\n"
+		"[cube]\n"
+		"S0 C G0 G0 G0 * *\n"
+		"[twice]\n"
+		"R:poly\n"
+		"R:scale\n"
+		"[count]\n"
+		"S1 C 0 S2 C :a G2 G1 + S2 C K1:a G2\n"
+		"[deep]\n"
+		"R:deep\n";
+	// library self-check: lines, and the top and error they end with
+	const struct
+	{
+		const char* line;
+		EvalResult status;
+		double top;
+	} libraryChecks[] = {
+		{ "3 R:chain", EVAL_OK, 10 },
+		{ "2 R:twice", EVAL_OK, 8.5 },
+		{ "10 R:count", EVAL_OK, 55 },
+		{ "2 R:cube 1 +", EVAL_OK, 9 },
+		{ "1 R:poly R:inc R:scale", EVAL_OK, 3.5 },
+		{ "2 r:Poly", EVAL_OK, 17 },
+		{ "R:deep", EVAL_ERROR, 0 },
+		{ "R:missing", EVAL_ERROR, 0 }
+	};
+	// switching: each run picks the next of these, run from the library,
+	// from text set on the engine, or from its own file
+	const char* const switchPrograms[] = { "poly", "scale", "inc", "sq",
+		"cube" };
+	const size_t librarySwitches = 100000;
+
+	//------------------------------------------------------------------------
+	//	Class:			CGeneratedLines
+	//	Description:	an input stream buffer that produces the synthetic
+	//					batch workload on the fly, so a 100M line input does
+	//					not have to exist in memory or on disk
+	//------------------------------------------------------------------------
+	class CGeneratedLines : public streambuf
+	{
+	public:
+		CGeneratedLines(size_t lines) : m_lines(lines), m_next(0) {}
+
+	protected:
+		int_type underflow()
+		{
+			if (gptr() < egptr())
+				return traits_type::to_int_type(*gptr());
+			m_buffer.clear();
+			while (m_next < m_lines && m_buffer.size() < 65536)
+			{
+				m_buffer += to_string(m_next % 97);
+				m_buffer += " 4 + ";
+				m_buffer += to_string(m_next % 13 + 1);
+				m_buffer += (m_next % 5 == 0) ? " * 0 /\n" : " * 2 ^ 7 %\n";
+				m_next++;
+			}
+			if (m_buffer.empty())
+				return traits_type::eof();
+			setg(&m_buffer[0], &m_buffer[0], &m_buffer[0] + m_buffer.size());
+			return traits_type::to_int_type(*gptr());
+		}
+
+	private:
+		size_t m_lines;
+		size_t m_next;
+		string m_buffer;
+	};
+
+	//------------------------------------------------------------------------
+	//	Class:			CHashSink
+	//	Description:	an output stream buffer that keeps only a byte count
+	//					and an FNV-1a hash of what is written to it
+	//------------------------------------------------------------------------
+	class CHashSink : public streambuf
+	{
+	public:
+		CHashSink() : m_bytes(0), m_hash(14695981039346656037ull) {}
+		size_t bytes() const { return m_bytes; }
+		uint64_t hash() const { return m_hash; }
+
+	protected:
+		int_type overflow(int_type c)
+		{
+			if (!traits_type::eq_int_type(c, traits_type::eof()))
+			{
+				char ch = traits_type::to_char_type(c);
+				xsputn(&ch, 1);
+			}
+			return traits_type::not_eof(c);
+		}
+
+		streamsize xsputn(const char* s, streamsize n)
+		{
+			for (streamsize i = 0; i < n; i++)
+			{
+				m_hash ^= static_cast<unsigned char>(s[i]);
+				m_hash *= 1099511628211ull;
+			}
+			m_bytes += static_cast<size_t>(n);
+			return n;
+		}
+
+	private:
+		size_t m_bytes;
+		uint64_t m_hash;
+	};
+
+	//------------------------------------------------------------------------
+	//	Class:			CBenchReport
+	//	Description:	collects one record per measured number so a run
+	//					can be written as JSON or CSV and compared with
+	//					other runs
+	//------------------------------------------------------------------------
+	class CBenchReport
+	{
+	public:
+		void add(const char* benchmark, const string& item,
+			const char* metric, double value)
+		{
+			SRecord record = { benchmark, item, metric, value };
+			m_records.push_back(record);
+		}
+
+		void writeCsv(ostream& ostr) const
+		{
+			ostr << "benchmark,case,metric,value\n";
+			for (const SRecord& record : m_records)
+			{
+				ostr << record.benchmark << ',' << record.item << ','
+					<< record.metric << ',';
+				writeValue(ostr, record.value, "");
+				ostr << '\n';
+			}
+		}
+
+		void writeJson(ostream& ostr, bool ok) const
+		{
+			ostr << "{\n  \"ok\": " << (ok ? "true" : "false")
+				<< ",\n  \"kernels\": \"" << vectorKernels()
+				<< "\",\n  \"results\": [";
+			for (size_t i = 0; i < m_records.size(); i++)
+			{
+				const SRecord& record = m_records[i];
+				ostr << (i == 0 ? "\n" : ",\n")
+					<< "    {\"benchmark\": \"" << record.benchmark
+					<< "\", \"case\": \"" << record.item
+					<< "\", \"metric\": \"" << record.metric
+					<< "\", \"value\": ";
+				writeValue(ostr, record.value, "null");
+				ostr << "}";
+			}
+			ostr << "\n  ]\n}\n";
+		}
+
+	private:
+		struct SRecord
+		{
+			string benchmark;
+			string item;
+			string metric;
+			double value;
+		};
+
+		// JSON has no inf or nan; they are written as missing
+		static void writeValue(ostream& ostr, double value,
+			const char* missing)
+		{
+			if (isfinite(value))
+				ostr << defaultfloat << setprecision(9) << value;
+			else
+				ostr << missing;
+		}
+
+		vector<SRecord> m_records;
+	};
+
+	CBenchReport g_report;
+
+	// keeps the optimizer from discarding benchmarked work
+	volatile double g_sink = 0.0;
+
+	// addOperators() added and refused the operators it should
+	bool g_operatorsAdded = false;
+
+	//------------------------------------------------------------------------
+	//	Function:		makeLine(size_t bytes)
+	//	Description:	repeats tokenizerPattern until the line is at least
+	//					bytes long
+	//	Returns:		the line
+	//------------------------------------------------------------------------
+	string makeLine(size_t bytes)
+	{
+		string line;
+		line.reserve(bytes + sizeof(tokenizerPattern));
+		while (line.size() < bytes)
+			line += tokenizerPattern;
+		return line;
+	}
+
+	//------------------------------------------------------------------------
+	//	Function:		benchTokenizer()
+	//	Description:	tokenizes lines from 1 KB to 10 MB and reports the
+	//					cost per byte, which stays flat when the tokenizer
+	//					is linear in the line length
+	//------------------------------------------------------------------------
+	void benchTokenizer()
+	{
+		const size_t sizes[] = { 1024, 10240, 102400, 1048576, 10485760 };
+		cout << "tokenizer" << endl;
+		cout << setw(12) << "bytes" << setw(12) << "tokens"
+			<< setw(14) << "ms" << setw(14) << "ns/byte" << endl;
+		for (size_t bytes : sizes)
+		{
+			string line = makeLine(bytes);
+			// repeat small lines so every size does about 20 MB of work
+			size_t repeats = 20 * 1048576 / line.size() + 1;
+			size_t tokens = 0;
+			double sum = 0.0;
+			benchClock::time_point start = benchClock::now();
+			for (size_t r = 0; r < repeats; r++)
+			{
+				CRPNTokenizer tokenizer(line);
+				SToken token;
+				tokens = 0;
+				while (tokenizer.next(token))
+				{
+					if (token.type == TOK_NUMBER)
+						sum += token.value;
+					tokens++;
+				}
+			}
+			chrono::duration<double, milli> elapsed = benchClock::now() - start;
+			g_sink = g_sink + sum;
+			double ms = elapsed.count() / repeats;
+			cout << setw(12) << line.size() << setw(12) << tokens
+				<< setw(14) << fixed << setprecision(3) << ms
+				<< setw(14) << ms * 1e6 / line.size() << endl;
+			g_report.add("tokenizer", to_string(line.size()), "ns_per_byte",
+				ms * 1e6 / line.size());
+		}
+	}
+
+	//------------------------------------------------------------------------
+	//	Function:		timeProgram(const char* name,
+	//						const list<string>& program)
+	//	Description:	runs program programRuns times three ways: by
+	//					parsing the text of every line on every run,
+	//					through 'R' on the optimized bytecode, and through
+	//					'R' with the JIT, which compiles the program to
+	//					native code once it is hot.  Prints the instruction
+	//					counts before and after the optimizer; ops/s counts
+	//					the instructions of the unoptimized program.
+	//------------------------------------------------------------------------
+	void timeProgram(const char* name, const list<string>& program)
+	{
+		double top = 0.0;
+		CRPNEngine textCalc;
+		benchClock::time_point start = benchClock::now();
+		for (size_t r = 0; r < programRuns; r++)
+			for (const string& line : program)
+				textCalc.evaluate(line, top);
+		chrono::duration<double, milli> text = benchClock::now() - start;
+
+		CRPNEngine compiledCalc;
+		compiledCalc.setProgram(program);
+		compiledCalc.setJit(false);
+		compiledCalc.compileProgram();
+		start = benchClock::now();
+		for (size_t r = 0; r < programRuns; r++)
+			compiledCalc.evaluate("R", top);
+		chrono::duration<double, milli> compiled = benchClock::now() - start;
+
+		CRPNEngine jitCalc;
+		jitCalc.setProgram(program);
+		start = benchClock::now();
+		for (size_t r = 0; r < programRuns; r++)
+			jitCalc.evaluate("R", top);
+		chrono::duration<double, milli> jit = benchClock::now() - start;
+
+		// every engine ran the same lines the same number of times
+		for (int reg = 0; reg < NUMREGS; reg++)
+			if (textCalc.registerValue(reg) != compiledCalc.registerValue(reg)
+				|| textCalc.registerValue(reg) != jitCalc.registerValue(reg))
+			{
+				cerr << name << ": compiled program disagrees in S"
+					<< reg << endl;
+				exit(EXIT_FAILURE);
+			}
+
+		const double ops = static_cast<double>(compiledCalc.programSize())
+			* programRuns;
+		cout << name << " (" << program.size() << " lines, "
+			<< compiledCalc.programSize() << " -> "
+			<< compiledCalc.optimizedSize() << " instructions, "
+			<< programRuns << " runs)" << endl;
+		cout << setw(12) << "engine" << setw(14) << "ms"
+			<< setw(14) << "runs/s" << setw(14) << "Mops/s" << endl;
+		const pair<const char*, double> rows[] =
+		{
+			{ "text", text.count() },
+			{ "bytecode", compiled.count() },
+			{ jitCalc.jitCompiled() ? "jit" : "jit (off)", jit.count() }
+		};
+		for (const pair<const char*, double>& row : rows)
+		{
+			cout << setw(12) << row.first << setw(14) << fixed
+				<< setprecision(3) << row.second << setw(14)
+				<< setprecision(0) << programRuns / row.second * 1000.0
+				<< setw(14) << setprecision(1)
+				<< ops / row.second / 1000.0 << endl;
+			g_report.add(name, row.first, "runs_per_s",
+				programRuns / row.second * 1000.0);
+			g_report.add(name, row.first, "ops_per_s",
+				ops / row.second * 1000.0);
+		}
+		g_report.add(name, "compiled", "instructions",
+			static_cast<double>(compiledCalc.programSize()));
+		g_report.add(name, "optimized", "instructions",
+			static_cast<double>(compiledCalc.optimizedSize()));
+	}
+
+	//------------------------------------------------------------------------
+	//	Function:		benchProgram()
+	//	Description:	times programLines and foldLines as text, as
+	//					optimized bytecode and as native code
+	//------------------------------------------------------------------------
+	void benchProgram()
+	{
+		timeProgram("program",
+			list<string>(begin(programLines), end(programLines)));
+		cout << endl;
+		timeProgram("folded",
+			list<string>(begin(foldLines), end(foldLines)));
+	}
+
+	//------------------------------------------------------------------------
+	//	Function:		applyOp(char op, double d1, double d2)
+	//	Description:	the arithmetic of add() through mod()
+	//	Returns:		the result
+	//------------------------------------------------------------------------
+	inline double applyOp(char op, double d1, double d2)
+	{
+		switch (op)
+		{
+		case '+': return d1 + d2;
+		case '-': return d1 - d2;
+		case '*': return d1 * d2;
+		case '/': return d1 / d2;
+		case '^': return pow(d1, d2);
+		default: return fmod(d1, d2);
+		}
+	}
+
+	//------------------------------------------------------------------------
+	//	Function:		chainDeque()
+	//	Description:	the operator chain on deque<double> with the top at
+	//					front(), as binary_prep() used to do it
+	//	Returns:		the value left on the stack
+	//------------------------------------------------------------------------
+	double chainDeque()
+	{
+		deque<double> stack;
+		stack.push_front(1.0);
+		for (size_t i = 0; i < chainLength; i++)
+		{
+			stack.push_front(1.0 + (i & 7) * 0.125);
+			double d1 = stack.front();
+			stack.pop_front();
+			double d2 = stack.front();
+			stack.pop_front();
+			stack.push_front(applyOp(chainOps[i % 6], d1, d2));
+		}
+		return stack.front();
+	}
+
+	//------------------------------------------------------------------------
+	//	Function:		chainStack()
+	//	Description:	the same chain on CRPNStack
+	//	Returns:		the value left on the stack
+	//------------------------------------------------------------------------
+	double chainStack()
+	{
+		CRPNStack stack;
+		stack.push(1.0);
+		for (size_t i = 0; i < chainLength; i++)
+		{
+			stack.push(1.0 + (i & 7) * 0.125);
+			double d1 = stack.top();
+			stack.pop();
+			double d2 = stack.top();
+			stack.pop();
+			stack.push(applyOp(chainOps[i % 6], d1, d2));
+		}
+		return stack.top();
+	}
+
+	//------------------------------------------------------------------------
+	//	Function:		benchStack()
+	//	Description:	compares operator chains on the old deque stack and
+	//					on CRPNStack
+	//------------------------------------------------------------------------
+	void benchStack()
+	{
+		cout << "stack (" << chainLength << " ops, + - * / ^ %)" << endl;
+		cout << setw(12) << "stack" << setw(14) << "ms"
+			<< setw(14) << "Mops/s" << endl;
+
+		benchClock::time_point start = benchClock::now();
+		double dequeResult = chainDeque();
+		chrono::duration<double, milli> dequeTime = benchClock::now() - start;
+
+		start = benchClock::now();
+		double stackResult = chainStack();
+		chrono::duration<double, milli> stackTime = benchClock::now() - start;
+
+		g_sink = g_sink + dequeResult + stackResult;
+		cout << setw(12) << "deque" << setw(14) << fixed << setprecision(3)
+			<< dequeTime.count() << setw(14)
+			<< chainLength / dequeTime.count() / 1000.0 << endl;
+		cout << setw(12) << "CRPNStack" << setw(14) << stackTime.count()
+			<< setw(14) << chainLength / stackTime.count() / 1000.0 << endl;
+		g_report.add("stack", "deque", "mops_per_s",
+			chainLength / dequeTime.count() / 1000.0);
+		g_report.add("stack", "CRPNStack", "mops_per_s",
+			chainLength / stackTime.count() / 1000.0);
+	}
+
+	//------------------------------------------------------------------------
+	//	Function:		setGroups(CRPNEngine& engine, const string& group)
+	//	Description:	sets a program of opLines lines of opGroupsPerLine
+	//					copies of group, with the operands in registers 0
+	//					and 1, and runs it once.  The JIT and the result
+	//					cache are off, so every run steps through every
+	//					instruction in the interpreter.
+	//	Returns:		false if the optimizer removed any instruction
+	//------------------------------------------------------------------------
+	bool setGroups(CRPNEngine& engine, const string& group)
+	{
+		string line;
+		for (size_t g = 0; g < opGroupsPerLine; g++)
+			line += group;
+		engine.setJit(false);
+		engine.setResultCache(0);
+		engine.setRegister(0, opRight);
+		engine.setRegister(1, opLeft);
+		engine.setProgram(list<string>(opLines, line));
+		double top = 0.0;
+		engine.evaluate("R", top);
+		return engine.optimizedSize() == engine.programSize();
+	}
+
+	//------------------------------------------------------------------------
+	//	Function:		timeGroups(CRPNEngine& engine)
+	//	Description:	runs the program setGroups() set opRuns times
+	//					through 'R'
+	//	Returns:		the time in ns
+	//------------------------------------------------------------------------
+	double timeGroups(CRPNEngine& engine)
+	{
+		double top = 0.0;
+		benchClock::time_point start = benchClock::now();
+		for (size_t r = 0; r < opRuns; r++)
+			engine.evaluate("R", top);
+		chrono::duration<double, nano> elapsed = benchClock::now() - start;
+		g_sink = g_sink + engine.registerValue(2);
+		return elapsed.count();
+	}
+
+	//------------------------------------------------------------------------
+	//	Function:		benchOps()
+	//	Description:	the cost of each operator on its own, through
+	//					binary_prep() or unary_prep(): the time of groups
+	//					with the op less the time of the same groups
+	//					without it.  The two are timed in turn opRepeats
+	//					times and the fastest of each kept, so drift in
+	//					the machine's speed affects both alike.  Checks
+	//					that the optimizer kept every instruction and
+	//					that each op gave its result.
+	//	Returns:		false on a mismatch
+	//------------------------------------------------------------------------
+	bool benchOps()
+	{
+		const size_t ops = opGroupsPerLine * opLines * opRuns;
+		bool ok = true;
+		cout << "operators (" << ops << " each, less push and pop)" << endl;
+		cout << setw(12) << "op" << setw(14) << "ns/op" << endl;
+		for (const char* op = opList; *op != '\0'; op++)
+		{
+			CRPNEngine withOp;
+			CRPNEngine base;
+			const bool kept = (*op == 'M')
+				? setGroups(withOp, "G0 M S2 C ") && setGroups(base, "G0 S2 C ")
+				: setGroups(withOp, string("G0 G1 ") + *op + " S2 C ")
+					&& setGroups(base, "G0 G1 S2 C C ");
+			const double result = withOp.registerValue(2);
+			const double expected = (*op == 'M') ? -opRight
+				: applyOp(*op, opLeft, opRight);
+			if (!kept)
+			{
+				cerr << "MISMATCH: " << *op << " was optimized away" << endl;
+				ok = false;
+			}
+			else if (result != expected)
+			{
+				cerr << "MISMATCH: " << *op << " gave " << result << endl;
+				ok = false;
+			}
+			double withOpTime = 0.0;
+			double baseTime = 0.0;
+			for (int repeat = 0; repeat < opRepeats; repeat++)
+			{
+				const double withOpRun = timeGroups(withOp);
+				const double baseRun = timeGroups(base);
+				if (repeat == 0 || withOpRun < withOpTime)
+					withOpTime = withOpRun;
+				if (repeat == 0 || baseRun < baseTime)
+					baseTime = baseRun;
+			}
+			const double ns = (withOpTime - baseTime) / ops;
+			cout << setw(12) << *op << setw(14) << fixed << setprecision(2)
+				<< ns << endl;
+			g_report.add("ops", string(1, *op), "ns_per_op", ns);
+		}
+		return ok;
+	}
+
+	//------------------------------------------------------------------------
+	//	Function:		customAdd(double d1, double d2, double& result)
+	//	Description:	the kernel of the custom operator benchDispatch()
+	//					adds: the same arithmetic as +
+	//	Returns:		true
+	//------------------------------------------------------------------------
+	bool customAdd(double d1, double d2, double& result)
+	{
+		result = d1 + d2;
+		return true;
+	}
+
+	//------------------------------------------------------------------------
+	//	Function:		customHalf(double d1, double d2, double& result)
+	//	Description:	a one operand kernel that fails on zero
+	//	Returns:		false if d1 is 0
+	//------------------------------------------------------------------------
+	bool customHalf(double d1, double, double& result)
+	{
+		if (d1 == 0)
+			return false;
+		result = d1 / 2;
+		return true;
+	}
+
+	//------------------------------------------------------------------------
+	//	Function:		compareChain(char c)
+	//	Description:	operator lookup as parse() once did it: the token
+	//					copied into a string and compared with each
+	//					operator in turn
+	//	Returns:		the operator's position in dispatchOps, or -1
+	//------------------------------------------------------------------------
+	int compareChain(char c)
+	{
+		static const char* const names[] = { "+", "-", "*", "/", "^", "%",
+			"C", "D", "F", "H", "L", "M", "P", "R", "U", "X" };
+		string token(1, static_cast<char>(toupper(
+			static_cast<unsigned char>(c))));
+		for (int i = 0; i < 16; i++)
+			if (token.compare(names[i]) == 0)
+				return i;
+		return -1;
+	}
+
+	//------------------------------------------------------------------------
+	//	Function:		timeDispatch(const string& line, int way,
+	//						double& result)
+	//	Description:	parses line dispatchRuns times (way 0), or runs it
+	//					as a program that many times on the interpreter
+	//					(1) or the JIT (2), with G0 = 1.5
+	//	Returns:		the time in ns; result receives the top
+	//------------------------------------------------------------------------
+	double timeDispatch(const string& line, int way, double& result)
+	{
+		CRPNEngine engine;
+		engine.setRegister(0, 1.5);
+		engine.setProgram(list<string>(1, line));
+		engine.setJit(way == 2);
+		double top = 0.0;
+		const string run = (way > 0) ? "CE R" : "CE " + line;
+		// past JITTHRESHOLD, so a JIT run is compiled before timing
+		for (unsigned i = 0; i <= JITTHRESHOLD; i++)
+			engine.evaluate(run, top);
+		benchClock::time_point start = benchClock::now();
+		for (size_t r = 0; r < dispatchRuns; r++)
+			engine.evaluate(run, top);
+		chrono::duration<double, nano> elapsed = benchClock::now() - start;
+		result = top;
+		return elapsed.count();
+	}
+
+	//------------------------------------------------------------------------
+	//	Function:		addOperators()
+	//	Description:	adds the custom operators benchDispatch() uses,
+	//					'|' that adds and 'Q' that halves and fails on 0,
+	//					and tries names add() must refuse.  main() calls
+	//					it before any engine is constructed, since the
+	//					first engine freezes the table.
+	//	Returns:		false if add() took or refused the wrong operators
+	//------------------------------------------------------------------------
+	bool addOperators()
+	{
+		return !CRPNOperators::frozen()
+			&& CRPNOperators::add('|', 2, customAdd)
+			&& CRPNOperators::add('q', 1, customHalf)
+			&& !CRPNOperators::add('+', 2, customAdd)
+			&& !CRPNOperators::add('Q', 1, customHalf)
+			&& !CRPNOperators::add('s', 1, customHalf)
+			&& !CRPNOperators::add('7', 1, customHalf)
+			&& !CRPNOperators::add('#', 3, customAdd)
+			&& !CRPNOperators::add('#', 1, nullptr);
+	}
+
+	//------------------------------------------------------------------------
+	//	Function:		benchDispatch()
+	//	Description:	the cost of finding an operator: the old string
+	//					compare chain against the operator table, then
+	//					+ against a custom operator with the same kernel,
+	//					parsed and compiled.  Checks that the custom
+	//					operator gives the same results, that add()
+	//					refused the names it should and fails once an
+	//					engine exists, and that a failing kernel behaves
+	//					as divide by zero does.
+	//	Returns:		false on a mismatch
+	//------------------------------------------------------------------------
+	bool benchDispatch()
+	{
+		bool ok = true;
+		CRPNEngine first;
+		if (!g_operatorsAdded || !CRPNOperators::frozen()
+			|| CRPNOperators::add('#', 2, customAdd))
+		{
+			cerr << "MISMATCH: CRPNOperators::add() took or refused the"
+				<< " wrong operators" << endl;
+			ok = false;
+		}
+		const struct
+		{
+			const char* line;
+			EvalResult status;
+			double top;
+		} checks[] = {
+			{ "1 2 |", EVAL_OK, 3 }, { "5 q", EVAL_OK, 2.5 },
+			{ "5 Q Q", EVAL_OK, 1.25 }, { "3 0 q", EVAL_ERROR, 0 },
+			{ "1 |", EVAL_ERROR, 1 }
+		};
+		for (const auto& check : checks)
+		{
+			CRPNEngine engine;
+			double top = 0.0;
+			const EvalResult status = engine.evaluate(check.line, top);
+			CRPNEngine compiled;
+			compiled.setProgram(list<string>(1, check.line));
+			double compiledTop = 0.0;
+			const EvalResult compiledStatus = compiled.evaluate("R",
+				compiledTop);
+			if (status != check.status || compiledStatus != check.status
+				|| (status == EVAL_OK && (top != check.top
+					|| compiledTop != check.top)))
+			{
+				cerr << "MISMATCH: \"" << check.line << "\"" << endl;
+				ok = false;
+			}
+		}
+		string typedTop;
+		if (createNumericEngine(NUM_DOUBLE)->evaluate("1 2 |", typedTop)
+			== EVAL_OK)
+		{
+			cerr << "MISMATCH: a typed engine ran a custom operator" << endl;
+			ok = false;
+		}
+
+		const size_t lookups = dispatchTokens * dispatchRuns;
+		cout << "operator dispatch (" << lookups << " tokens each)" << endl;
+		cout << setw(16) << "way" << setw(14) << "ns/token" << endl;
+		string tokens;
+		mt19937 random(1);
+		for (size_t i = 0; i < dispatchTokens; i++)
+			tokens += dispatchOps[random() % (sizeof(dispatchOps) - 1)];
+
+		int sum = 0;
+		benchClock::time_point start = benchClock::now();
+		for (size_t r = 0; r < dispatchRuns; r++)
+			for (char c : tokens)
+				sum += compareChain(c);
+		chrono::duration<double, nano> chainTime = benchClock::now() - start;
+		start = benchClock::now();
+		for (size_t r = 0; r < dispatchRuns; r++)
+			for (char c : tokens)
+				sum += CRPNOperators::find(c).op;
+		chrono::duration<double, nano> tableTime = benchClock::now() - start;
+		g_sink = g_sink + sum;
+
+		const struct
+		{
+			const char* name;
+			double ns;
+		} lookup[] = {
+			{ "compare chain", chainTime.count() },
+			{ "table", tableTime.count() }
+		};
+		for (const auto& way : lookup)
+		{
+			cout << setw(16) << way.name << setw(14) << fixed
+				<< setprecision(2) << way.ns / lookups << endl;
+			g_report.add("dispatch", way.name, "ns_per_token",
+				way.ns / lookups);
+		}
+
+		string builtIn = "G0";
+		string custom = "G0";
+		for (size_t i = 0; i < dispatchTokens; i++)
+		{
+			builtIn += " G0 +";
+			custom += " G0 |";
+		}
+		const char* const ways[] = { "parse ", "run ", "jit " };
+		for (int way = 0; way < 3; way++)
+		{
+			double builtInTop = 0.0;
+			double customTop = 0.0;
+			const double builtInNs = timeDispatch(builtIn, way,
+				builtInTop) / (2 * lookups);
+			const double customNs = timeDispatch(custom, way,
+				customTop) / (2 * lookups);
+			if (builtInTop != customTop)
+			{
+				cerr << "MISMATCH: + gave " << builtInTop << " and | gave "
+					<< customTop << endl;
+				ok = false;
+			}
+			const string name = ways[way];
+			cout << setw(16) << name + "+" << setw(14) << builtInNs << endl;
+			cout << setw(16) << name + "custom" << setw(14) << customNs
+				<< endl;
+			g_report.add("dispatch", name + "+", "ns_per_token", builtInNs);
+			g_report.add("dispatch", name + "custom", "ns_per_token",
+				customNs);
+		}
+		return ok;
+	}
+
+	//------------------------------------------------------------------------
+	//	Function:		timeRotation(const string& group, size_t depth)
+	//	Description:	runs rotatesPerLine copies of group rotateRuns times
+	//					through 'R' on a stack of depth values
+	//	Returns:		the time in ns
+	//------------------------------------------------------------------------
+	double timeRotation(const string& group, size_t depth)
+	{
+		string line;
+		for (size_t i = 0; i < rotatesPerLine; i++)
+			line += group;
+		string fill;
+		for (size_t i = 0; i < depth; i++)
+			fill += to_string(i % 10) + " ";
+		CRPNEngine engine;
+		engine.setProgram(list<string>(1, line));
+		double top = 0.0;
+		engine.evaluate(fill, top);
+		engine.evaluate("R", top);
+		benchClock::time_point start = benchClock::now();
+		for (size_t r = 0; r < rotateRuns; r++)
+			engine.evaluate("R", top);
+		chrono::duration<double, nano> elapsed = benchClock::now() - start;
+		g_sink = g_sink + top + engine.registerValue(0);
+		return elapsed.count();
+	}
+
+	//------------------------------------------------------------------------
+	//	Function:		stackValues(CRPNEngine& engine)
+	//	Description:	empties the engine's stack with C
+	//	Returns:		the values, top first
+	//------------------------------------------------------------------------
+	vector<double> stackValues(CRPNEngine& engine)
+	{
+		vector<double> values;
+		double top = 0.0;
+		while (!engine.empty())
+		{
+			values.push_back(engine.top());
+			engine.evaluate("C", top);
+		}
+		return values;
+	}
+
+	//------------------------------------------------------------------------
+	//	Function:		checkRotation()
+	//	Description:	runs U:k, D:k and k single U's on stacks of
+	//					rotateCheckDepths distinct values, parsed and as a
+	//					program, against a deque rotated one value at a
+	//					time.  U:k D:k must leave the stack as it was.
+	//	Returns:		false on a mismatch
+	//------------------------------------------------------------------------
+	bool checkRotation()
+	{
+		size_t mismatches = 0;
+		size_t checks = 0;
+		for (size_t depth : rotateCheckDepths)
+		{
+			string fill;
+			deque<double> start;
+			for (size_t i = 0; i < depth; i++)
+			{
+				fill += to_string(i + 1) + " ";
+				start.push_front(static_cast<double>(i + 1));	// top first
+			}
+			for (size_t k : rotateCheckCounts)
+			{
+				deque<double> up = start;
+				for (size_t i = 0; i < k % depth; i++)
+				{
+					up.push_back(up.front());
+					up.pop_front();
+				}
+				deque<double> down = start;
+				for (size_t i = 0; i < k % depth; i++)
+				{
+					down.push_front(down.back());
+					down.pop_back();
+				}
+				const string count = to_string(k);
+				string singles;
+				for (size_t i = 0; i < k % depth + depth; i++)
+					singles += "U ";
+				// the first program rotates values it pushed itself, so
+				// the optimizer merges its rotations into one U:k
+				const struct
+				{
+					string program;
+					string line;
+					const deque<double>* expected;
+				} cases[] = {
+					{ "", fill + "U:" + count, &up },
+					{ "", fill + "D:" + count, &down },
+					{ "", fill + "U:" + count + " D:" + count, &start },
+					{ "", fill + singles, &up },
+					{ fill + "U:" + count + " D:" + count + " U:" + count
+						+ " U D", "R", &up },
+					{ "U:" + count + " S0 D:" + count, fill + "R", &start }
+				};
+				for (const auto& test : cases)
+				{
+					CRPNEngine engine;
+					engine.setProgram(list<string>(1, test.program));
+					double top = 0.0;
+					const bool error = engine.evaluate(test.line, top)
+						!= EVAL_OK;
+					const vector<double> values = stackValues(engine);
+					checks++;
+					if (error || values.size() != depth
+						|| !equal(values.begin(), values.end(),
+							test.expected->begin()))
+					{
+						if (mismatches == 0)
+							cerr << "MISMATCH: case " << (&test - cases)
+								<< " with k = " << k << " at depth " << depth
+								<< endl;
+						mismatches++;
+					}
+				}
+			}
+		}
+		if (mismatches > 0)
+			cerr << "MISMATCH: " << mismatches << " of " << checks
+				<< " rotations" << endl;
+		return mismatches == 0;
+	}
+
+	//------------------------------------------------------------------------
+	//	Function:		benchRotate()
+	//	Description:	the cost of U, D, U:k and D:k by stack depth, with
+	//					k half the depth, after checkRotation()
+	//	Returns:		false on a mismatch
+	//------------------------------------------------------------------------
+	bool benchRotate()
+	{
+		const bool ok = checkRotation();
+		cout << "rotation (" << rotatesPerLine * rotateRuns
+			<< " each, less S0)" << endl;
+		cout << setw(12) << "op" << setw(12) << "depth" << setw(14) << "ns/op"
+			<< endl;
+		for (const char* op : { "U", "D", "U:", "D:" })
+			for (size_t depth : rotateDepths)
+			{
+				string group = op;
+				if (group.size() > 1)
+					group += to_string(depth / 2);
+				const double ns = (timeRotation(group + " S0 ", depth)
+					- timeRotation("S0 ", depth))
+					/ (rotatesPerLine * rotateRuns);
+				cout << setw(12) << op << setw(12) << depth << setw(14)
+					<< fixed << setprecision(2) << ns << endl;
+				g_report.add("rotate", string(op) + "/" + to_string(depth),
+					"ns_per_op", ns);
+			}
+		return ok;
+	}
+
+	//------------------------------------------------------------------------
+	//	Function:		benchBatch()
+	//	Description:	pushes batchLines simple expressions through
+	//					runBatch(), from memory to memory
+	//------------------------------------------------------------------------
+	void benchBatch()
+	{
+		string input;
+		for (size_t i = 0; i < batchLines; i++)
+		{
+			input += "CE ";
+			input += to_string(i % 97);
+			input += " 4 + ";
+			input += to_string(i % 13 + 1);
+			input += " *\n";
+		}
+		istringstream in(input);
+		ostringstream out;
+		CRPNCalc calc;
+		benchClock::time_point start = benchClock::now();
+		calc.runBatch(in, out);
+		chrono::duration<double, milli> elapsed = benchClock::now() - start;
+
+		cout << "batch (" << batchLines << " lines, " << input.size()
+			<< " bytes in, " << out.str().size() << " bytes out)" << endl;
+		cout << setw(14) << "ms" << setw(14) << "lines/s" << endl;
+		cout << setw(14) << fixed << setprecision(3) << elapsed.count()
+			<< setw(14) << setprecision(0)
+			<< batchLines / elapsed.count() * 1000.0 << endl;
+		g_report.add("batch", "runBatch", "lines_per_s",
+			batchLines / elapsed.count() * 1000.0);
+	}
+
+	//------------------------------------------------------------------------
+	//	Function:		engineWorkload(double& checksum)
+	//	Description:	one thread's share of the thread benchmark: its own
+	//					engine runs programLines threadRuns times
+	//	Returns:		checksum -- registers 0-3 summed at the end
+	//------------------------------------------------------------------------
+	void engineWorkload(double& checksum)
+	{
+		CRPNEngine engine;
+		double top = 0.0;
+		engine.setProgram(list<string>(begin(programLines), end(programLines)));
+		for (size_t r = 0; r < threadRuns; r++)
+			engine.evaluate("R", top);
+		checksum = 0.0;
+		for (int reg = 0; reg < 4; reg++)
+			checksum += engine.registerValue(reg);
+	}
+
+	//------------------------------------------------------------------------
+	//	Function:		benchThreads()
+	//	Description:	runs one engine per thread for 1, 2, 4, ... up to the
+	//					hardware thread count and reports the throughput.
+	//					Every engine must end with the single thread
+	//					result; engines share nothing, so a mismatch means
+	//					hidden shared state.
+	//	Returns:		false on a mismatch
+	//------------------------------------------------------------------------
+	bool benchThreads()
+	{
+		unsigned maxThreads = thread::hardware_concurrency();
+		if (maxThreads == 0)
+			maxThreads = 1;
+		double expected = 0.0;
+		engineWorkload(expected);
+
+		bool ok = true;
+		double singleRate = 0.0;
+		cout << "threads (" << threadRuns << " runs per engine)" << endl;
+		cout << setw(12) << "threads" << setw(14) << "ms"
+			<< setw(14) << "runs/s" << setw(14) << "speedup" << endl;
+		vector<unsigned> threadCounts;
+		for (unsigned n = 1; n < maxThreads; n *= 2)
+			threadCounts.push_back(n);
+		threadCounts.push_back(maxThreads);
+		for (unsigned n : threadCounts)
+		{
+			vector<double> checksums(n, 0.0);
+			vector<thread> workers;
+			benchClock::time_point start = benchClock::now();
+			for (unsigned t = 0; t < n; t++)
+				workers.push_back(thread(engineWorkload, ref(checksums[t])));
+			for (thread& worker : workers)
+				worker.join();
+			chrono::duration<double, milli> elapsed = benchClock::now() - start;
+
+			for (double checksum : checksums)
+				if (checksum != expected)
+					ok = false;
+			double rate = n * threadRuns / elapsed.count() * 1000.0;
+			if (n == 1)
+				singleRate = rate;
+			cout << setw(12) << n << setw(14) << fixed << setprecision(3)
+				<< elapsed.count() << setw(14) << setprecision(0) << rate
+				<< setw(14) << setprecision(2) << rate / singleRate << endl;
+			g_report.add("threads", to_string(n), "runs_per_s", rate);
+		}
+		if (!ok)
+			cerr << "MISMATCH: engines on different threads disagree" << endl;
+		return ok;
+	}
+
+	//------------------------------------------------------------------------
+	//	Function:		benchParallel(size_t lines)
+	//	Description:	runs the generated workload through CRPNBatch on
+	//					1, 2, 4, ... up to the hardware thread count.  The
+	//					output hash must be the same for every thread count.
+	//	Returns:		false on a mismatch
+	//------------------------------------------------------------------------
+	bool benchParallel(size_t lines)
+	{
+		unsigned maxThreads = thread::hardware_concurrency();
+		if (maxThreads == 0)
+			maxThreads = 1;
+		vector<unsigned> threadCounts;
+		for (unsigned n = 1; n < maxThreads; n *= 2)
+			threadCounts.push_back(n);
+		threadCounts.push_back(maxThreads);
+
+		bool ok = true;
+		uint64_t expected = 0;
+		double singleRate = 0.0;
+		cout << "parallel batch (" << lines << " lines)" << endl;
+		cout << setw(12) << "threads" << setw(14) << "ms"
+			<< setw(14) << "lines/s" << setw(14) << "speedup" << endl;
+		for (unsigned n : threadCounts)
+		{
+			CGeneratedLines input(lines);
+			CHashSink output;
+			istream in(&input);
+			ostream out(&output);
+			CRPNBatch batch(n);
+			benchClock::time_point start = benchClock::now();
+			batch.run(in, out);
+			chrono::duration<double, milli> elapsed = benchClock::now() - start;
+
+			if (n == 1)
+				expected = output.hash();
+			else if (output.hash() != expected)
+				ok = false;
+			double rate = lines / elapsed.count() * 1000.0;
+			if (n == 1)
+				singleRate = rate;
+			cout << setw(12) << n << setw(14) << fixed << setprecision(3)
+				<< elapsed.count() << setw(14) << setprecision(0) << rate
+				<< setw(14) << setprecision(2) << rate / singleRate << endl;
+			g_report.add("parallel", to_string(n), "lines_per_s", rate);
+		}
+		if (!ok)
+			cerr << "MISMATCH: output depends on the thread count" << endl;
+		return ok;
+	}
+
+	//------------------------------------------------------------------------
+	//	Function:		loadByLines(const char* filename, list<string>& lines)
+	//	Description:	the old program loader: getline() until eof(), one
+	//					string per line, which adds an empty line after a
+	//					final newline
+	//------------------------------------------------------------------------
+	void loadByLines(const char* filename, list<string>& lines)
+	{
+		ifstream fin(filename);
+		string input;
+		lines.clear();
+		while (!fin.eof())
+		{
+			getline(fin, input);
+			lines.push_back(input);
+		}
+	}
+
+	//------------------------------------------------------------------------
+	//	Function:		benchLoad()
+	//	Description:	writes a loadLines program file, then loads it with
+	//					the old getline() loader and with the mapped
+	//					loadProgramFile(), runs it through CRPNBatch from
+	//					a stream and from the mapping, and saves it back
+	//					over the mapped file with saveProgramFile().  The
+	//					loaders must give the same lines, less the old
+	//					spurious last one, both batch runs the same
+	//					output, and the saved file the same lines.
+	//	Returns:		false on a mismatch
+	//------------------------------------------------------------------------
+	bool benchLoad()
+	{
+		{
+			ofstream fout(loadFileName, ios::out | ios::trunc | ios::binary);
+			for (size_t i = 0; i < loadLines; i++)
+				fout << "CE " << i % 97 << " 4 + " << i % 13 + 1 << " *\n";
+		}
+
+		list<string> oldLines;
+		benchClock::time_point start = benchClock::now();
+		loadByLines(loadFileName, oldLines);
+		chrono::duration<double, milli> oldLoad = benchClock::now() - start;
+
+		CRPNEngine engine;
+		start = benchClock::now();
+		bool ok = engine.loadProgramFile(loadFileName);
+		chrono::duration<double, milli> mappedLoad = benchClock::now() - start;
+
+		const vector<string_view>& newLines = engine.program();
+		ok = ok && !oldLines.empty() && oldLines.back().empty()
+			&& newLines.size() == oldLines.size() - 1;
+		list<string>::const_iterator sit = oldLines.begin();
+		for (size_t i = 0; ok && i < newLines.size(); i++, sit++)
+			ok = (newLines[i] == *sit);
+
+		CRPNBatch batch(1);
+		CHashSink streamed;
+		CHashSink mapped;
+		{
+			ifstream fin(loadFileName);
+			ostream out(&streamed);
+			start = benchClock::now();
+			batch.run(fin, out);
+		}
+		chrono::duration<double, milli> streamRun = benchClock::now() - start;
+		{
+			CRPNMappedFile file;
+			ostream out(&mapped);
+			start = benchClock::now();
+			ok = file.open(loadFileName) && ok;
+			batch.run(file.data(), out);
+		}
+		chrono::duration<double, milli> mappedRun = benchClock::now() - start;
+		ok = ok && streamed.hash() == mapped.hash();
+
+		start = benchClock::now();
+		ok = engine.saveProgramFile(loadFileName) && ok;
+		chrono::duration<double, milli> save = benchClock::now() - start;
+		CRPNEngine reloaded;
+		ok = reloaded.loadProgramFile(loadFileName)
+			&& reloaded.program() == engine.program() && ok;
+		remove(loadFileName);
+
+		cout << "file load (" << loadLines << " lines)" << endl;
+		cout << setw(22) << "" << setw(14) << "ms" << setw(14) << "lines/s"
+			<< endl;
+		const char* const labels[] =
+		{
+			"getline list", "mapped views", "batch stream", "batch mapped",
+			"save"
+		};
+		const double times[] =
+		{
+			oldLoad.count(), mappedLoad.count(), streamRun.count(),
+			mappedRun.count(), save.count()
+		};
+		for (int i = 0; i < 5; i++)
+		{
+			cout << setw(22) << labels[i] << setw(14) << fixed
+				<< setprecision(3) << times[i] << setw(14) << setprecision(0)
+				<< loadLines / times[i] * 1000.0 << endl;
+			g_report.add("file", labels[i], "lines_per_s",
+				loadLines / times[i] * 1000.0);
+		}
+		if (!ok)
+			cerr << "MISMATCH: loaded, run or saved lines disagree" << endl;
+		return ok;
+	}
+
+	//------------------------------------------------------------------------
+	//	Function:		benchBinary()
+	//	Description:	saves a program of binaryLines lines as text and as
+	//					a program file, then times loading each and
+	//					getting it ready to run: the text is compiled and
+	//					optimized, the program file is mapped and checked.
+	//					Both must run to the same result, and so must the
+	//					program file in an engine whose names have other
+	//					slots, where it is compiled from its text.  A
+	//					program file with a byte changed must not load,
+	//					and saving one as text must give back its lines.
+	//	Returns:		false on a mismatch
+	//------------------------------------------------------------------------
+	bool benchBinary()
+	{
+		string text;
+		for (size_t i = 0; i < binaryLines; i++)
+			text += "G:acc " + to_string(i % 97) + " + 0." + to_string(i % 9
+				+ 1) + " * S:acc CE\n";
+		bool ok = true;
+		{
+			CRPNEngine engine;
+			engine.setProgramText(text);
+			ok = engine.saveProgramFile(loadFileName)
+				&& engine.saveProgramBinary(binaryFileName);
+		}
+
+		const char* const labels[] = { "text", "program file" };
+		const char* const files[] = { loadFileName, binaryFileName };
+		double times[2] = { 0.0, 0.0 };
+		double results[2] = { 0.0, 0.0 };
+		size_t instructions = 0;
+		for (int way = 0; way < 2; way++)
+		{
+			CRPNEngine engine;
+			benchClock::time_point start = benchClock::now();
+			ok = engine.loadProgramFile(files[way]) && ok;
+			engine.compileProgram();
+			chrono::duration<double, milli> load = benchClock::now() - start;
+			times[way] = load.count();
+			instructions = engine.programSize();
+			double top = 0.0;
+			ok = engine.evaluate("R", top) == EVAL_EMPTY && ok;
+			results[way] = engine.registerValue(
+				engine.registerNames().find("acc"));
+			if (way == 1)
+			{
+				// the text it holds is the text it was saved from
+				ok = engine.saveProgramFile(loadFileName) && ok;
+				CRPNEngine reloaded;
+				ok = reloaded.loadProgramFile(loadFileName)
+					&& reloaded.program() == engine.program()
+					&& engine.program().size() == binaryLines && ok;
+			}
+		}
+		{
+			// a name that takes acc's slot: the code cannot be used
+			CRPNEngine engine;
+			double top = 0.0;
+			engine.evaluate("0 S:first", top);
+			ok = engine.loadProgramFile(binaryFileName)
+				&& engine.evaluate("R", top) == EVAL_EMPTY
+				&& engine.registerValue(engine.registerNames().find("acc"))
+				== results[1] && ok;
+		}
+		{
+			string damaged;
+			{
+				CRPNMappedFile file;
+				ok = file.open(binaryFileName) && ok;
+				damaged = string(file.data());
+			}
+			damaged[damaged.size() / 2] ^= 0x10;
+			ofstream fout(binaryFileName, ios::out | ios::trunc
+				| ios::binary);
+			fout << damaged;
+		}
+		CRPNEngine damaged;
+		damaged.setProgramText("1\n");
+		ok = !damaged.loadProgramFile(binaryFileName)
+			&& damaged.program().size() == 1 && ok;
+		remove(loadFileName);
+		remove(binaryFileName);
+		ok = ok && results[0] == results[1];
+
+		cout << "program files (" << binaryLines << " lines, "
+			<< instructions << " instructions)" << endl;
+		cout << setw(22) << "load" << setw(14) << "ms" << setw(14)
+			<< "Minstr/s" << endl;
+		for (int way = 0; way < 2; way++)
+		{
+			cout << setw(22) << labels[way] << setw(14) << fixed
+				<< setprecision(3) << times[way] << setw(14)
+				<< setprecision(1) << instructions / times[way] / 1000.0
+				<< endl;
+			g_report.add("binary", labels[way], "load_ms", times[way]);
+		}
+		if (!ok)
+			cerr << "MISMATCH: program file and text disagree" << endl;
+		return ok;
+	}
+
+#if defined(__linux__)
+	//------------------------------------------------------------------------
+	//	Function:		connectServer()
+	//	Description:	opens a connection to the server at
+	//					serverSocketName
+	//	Returns:		the socket, or -1
+	//------------------------------------------------------------------------
+	int connectServer()
+	{
+		sockaddr_un name;
+		memset(&name, 0, sizeof(name));
+		name.sun_family = AF_UNIX;
+		memcpy(name.sun_path, serverSocketName, sizeof(serverSocketName));
+		const int fd = socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0);
+		if (fd >= 0 && connect(fd, reinterpret_cast<sockaddr*>(&name),
+			sizeof(name)) != 0)
+		{
+			close(fd);
+			return -1;
+		}
+		return fd;
+	}
+
+	//------------------------------------------------------------------------
+	//	Function:		sendAll(int fd, const char* input)
+	//	Description:	sends input on a connection and closes its sending
+	//					side
+	//	Returns:		false if either failed
+	//------------------------------------------------------------------------
+	bool sendAll(int fd, const char* input)
+	{
+		const size_t size = strlen(input);
+		return send(fd, input, size, MSG_NOSIGNAL)
+			== static_cast<ssize_t>(size) && shutdown(fd, SHUT_WR) == 0;
+	}
+
+	//------------------------------------------------------------------------
+	//	Function:		receiveAll(int fd, string& results)
+	//	Description:	reads a connection until the server closes it,
+	//					giving up if nothing comes for 10 s, and closes it
+	//	Returns:		false unless the server closed it
+	//------------------------------------------------------------------------
+	bool receiveAll(int fd, string& results)
+	{
+		timeval wait;
+		wait.tv_sec = 10;
+		wait.tv_usec = 0;
+		bool ok = setsockopt(fd, SOL_SOCKET, SO_RCVTIMEO, &wait,
+			sizeof(wait)) == 0;
+		char buffer[256];
+		ssize_t count = 0;
+		while (ok && (count = recv(fd, buffer, sizeof(buffer), 0)) > 0)
+			results.append(buffer, static_cast<size_t>(count));
+		close(fd);
+		return ok && count == 0;
+	}
+
+	//------------------------------------------------------------------------
+	//	Function:		checkServer()
+	//	Description:	sends serverCheckInput on one connection, closes
+	//					the sending side and reads until the server
+	//					closes
+	//	Returns:		false unless the results are serverCheckOutput
+	//------------------------------------------------------------------------
+	bool checkServer()
+	{
+		const int fd = connectServer();
+		if (fd < 0)
+			return false;
+		string results;
+		const bool ok = sendAll(fd, serverCheckInput);
+		return receiveAll(fd, results) && ok && results == serverCheckOutput;
+	}
+
+	//------------------------------------------------------------------------
+	//	Function:		checkServerLoop()
+	//	Description:	sends serverLoopInput on one connection, then a
+	//					request on a second, and reads the second before
+	//					the first: the looping session must not keep the
+	//					other waiting
+	//	Returns:		false unless both get the results they should
+	//------------------------------------------------------------------------
+	bool checkServerLoop()
+	{
+		const int looping = connectServer();
+		const int other = connectServer();
+		bool ok = looping >= 0 && other >= 0
+			&& sendAll(looping, serverLoopInput) && sendAll(other, "1 2 +\n");
+		string results;
+		if (other >= 0)
+			ok = receiveAll(other, results) && ok && results == "3\n";
+		results.clear();
+		if (looping >= 0)
+			ok = receiveAll(looping, results) && ok
+				&& results == serverLoopOutput;
+		return ok;
+	}
+
+	//------------------------------------------------------------------------
+	//	Function:		loadServer(size_t depth, vector<double>& latencies,
+	//						double& seconds)
+	//	Description:	the load generator: opens serverConnections
+	//					sessions and drives them from one epoll loop, each
+	//					sending serverRequests requests and keeping depth
+	//					of them unanswered, with no wait between a result
+	//					and the next request.  A request's latency runs
+	//					from its send to the read that brings its result.
+	//	Returns:		false if a connection failed, a result was wrong
+	//					or the server stopped answering for 10 s
+	//------------------------------------------------------------------------
+	bool loadServer(size_t depth, vector<double>& latencies, double& seconds)
+	{
+		struct SClient
+		{
+			int fd;
+			size_t sent;
+			size_t received;
+			string input;
+			vector<benchClock::time_point> sentAt;	// by request % depth
+		};
+		vector<SClient> clients(serverConnections);
+		const int epoll = epoll_create1(EPOLL_CLOEXEC);
+		bool ok = epoll >= 0;
+		for (size_t c = 0; c < clients.size(); c++)
+		{
+			clients[c].fd = ok ? connectServer() : -1;
+			clients[c].sent = 0;
+			clients[c].received = 0;
+			clients[c].sentAt.resize(depth);
+			epoll_event event;
+			memset(&event, 0, sizeof(event));
+			event.events = EPOLLIN;
+			event.data.u64 = c;
+			ok = ok && clients[c].fd >= 0
+				&& fcntl(clients[c].fd, F_SETFL, O_NONBLOCK) == 0
+				&& epoll_ctl(epoll, EPOLL_CTL_ADD, clients[c].fd, &event) == 0;
+		}
+		latencies.clear();
+		latencies.reserve(serverConnections * serverRequests);
+		const size_t requestSize = sizeof(serverRequest) - 1;
+		string burst;
+		// sends requests until depth are unanswered or all are sent
+		auto refill = [&](SClient& client, benchClock::time_point now)
+		{
+			burst.clear();
+			while (client.sent < serverRequests
+				&& client.sent - client.received < depth)
+			{
+				burst.append(serverRequest, requestSize);
+				client.sentAt[client.sent++ % depth] = now;
+			}
+			return burst.empty() || send(client.fd, burst.data(),
+				burst.size(), MSG_NOSIGNAL)
+				== static_cast<ssize_t>(burst.size());
+		};
+
+		benchClock::time_point start = benchClock::now();
+		for (size_t c = 0; ok && c < clients.size(); c++)
+			ok = refill(clients[c], benchClock::now());
+		size_t done = 0;
+		epoll_event events[256];
+		char buffer[65536];
+		while (ok && done < clients.size())
+		{
+			const int count = epoll_wait(epoll, events, 256, 10000);
+			ok = count > 0 || (count < 0 && errno == EINTR);
+			for (int i = 0; ok && i < count; i++)
+			{
+				SClient& client = clients[events[i].data.u64];
+				const ssize_t size = recv(client.fd, buffer, sizeof(buffer),
+					0);
+				if (size < 0 && (errno == EAGAIN || errno == EINTR))
+					continue;
+				ok = size > 0;
+				if (!ok)
+					break;
+				const benchClock::time_point now = benchClock::now();
+				client.input.append(buffer, static_cast<size_t>(size));
+				size_t first = 0;
+				size_t newline;
+				while ((newline = client.input.find('\n', first))
+					!= string::npos)
+				{
+					const double result = strtod(client.input.c_str() + first,
+						nullptr);
+					ok = ok && result == client.received + 1.0;
+					chrono::duration<double, micro> latency = now
+						- client.sentAt[client.received++ % depth];
+					latencies.push_back(latency.count());
+					first = newline + 1;
+				}
+				client.input.erase(0, first);
+				ok = ok && refill(client, now);
+				if (client.received == serverRequests)
+				{
+					close(client.fd);
+					client.fd = -1;
+					done++;
+				}
+			}
+		}
+		chrono::duration<double> elapsed = benchClock::now() - start;
+		seconds = elapsed.count();
+		for (SClient& client : clients)
+			if (client.fd >= 0)
+				close(client.fd);
+		if (epoll >= 0)
+			close(epoll);
+		return ok;
+	}
+
+	//------------------------------------------------------------------------
+	//	Function:		percentile(vector<double>& samples, double p)
+	//	Description:	the sample below which a fraction p of them lie;
+	//					reorders samples
+	//	Returns:		the percentile, or 0 with no samples
+	//------------------------------------------------------------------------
+	double percentile(vector<double>& samples, double p)
+	{
+		if (samples.empty())
+			return 0.0;
+		const size_t k = min(samples.size() - 1,
+			static_cast<size_t>(p * samples.size()));
+		nth_element(samples.begin(), samples.begin() + k, samples.end());
+		return samples[k];
+	}
+#endif
+
+	//------------------------------------------------------------------------
+	//	Function:		benchServer()
+	//	Description:	runs a CRPNServer on a thread and checks one
+	//					session's results on serverCheckInput, with the
+	//					library file gone before the session opens, so
+	//					it must run the server's compiled copy, and that
+	//					a session stuck in a loop gets errors while
+	//					another is answered; then loads
+	//					it from serverConnections sessions with one
+	//					request in flight on each, and with requests
+	//					pipelined, and reports requests per second and
+	//					the median and 99th percentile latency.  Every
+	//					session's results must count its requests.
+	//	Returns:		false on a mismatch
+	//------------------------------------------------------------------------
+	bool benchServer()
+	{
+#if defined(__linux__)
+		CRPNServer server;
+		{
+			ofstream fout(libraryFileName, ios::out | ios::trunc
+				| ios::binary);
+			fout << serverLibraryText;
+		}
+		const bool loaded = server.loadLibrary(libraryFileName);
+		remove(libraryFileName);
+		if (!loaded)
+		{
+			cerr << "MISMATCH: the server did not load its library" << endl;
+			return false;
+		}
+		if (!server.listen(serverSocketName))
+		{
+			cerr << "MISMATCH: the server did not listen on "
+				<< serverSocketName << endl;
+			return false;
+		}
+		thread loop([&server]() { server.run(); });
+		bool ok = checkServer();
+		if (!ok)
+			cerr << "MISMATCH: a session's results" << endl;
+		if (!checkServerLoop())
+		{
+			cerr << "MISMATCH: a looping session's results" << endl;
+			ok = false;
+		}
+
+		cout << "server (" << serverConnections << " sessions, "
+			<< serverRequests << " requests each, Unix socket)" << endl;
+		cout << setw(22) << "in flight" << setw(14) << "requests/s"
+			<< setw(14) << "p50 us" << setw(14) << "p99 us" << endl;
+		vector<double> latencies;
+		for (size_t depth : serverDepths)
+		{
+			double seconds = 0.0;
+			if (!loadServer(depth, latencies, seconds))
+			{
+				cerr << "MISMATCH: load with " << depth
+					<< " in flight failed" << endl;
+				ok = false;
+				break;
+			}
+			const double rate = latencies.size() / seconds;
+			const double p50 = percentile(latencies, 0.50);
+			const double p99 = percentile(latencies, 0.99);
+			cout << setw(22) << depth << setw(14) << fixed
+				<< setprecision(0) << rate << setw(14) << setprecision(1)
+				<< p50 << setw(14) << p99 << endl;
+			const string name = to_string(depth) + " in flight";
+			g_report.add("server", name, "requests_per_s", rate);
+			g_report.add("server", name, "p50_us", p50);
+			g_report.add("server", name, "p99_us", p99);
+		}
+		server.stop();
+		loop.join();
+		return ok;
+#else
+		cout << "server: needs epoll (Linux), skipped" << endl;
+		return true;
+#endif
+	}
+
+	//------------------------------------------------------------------------
+	//	Function:		sameValue(double a, double b)
+	//	Description:	compares results bit for bit, so NaNs compare
+	//					equal to themselves and -0 differs from 0
+	//	Returns:		true if a and b are the same value
+	//------------------------------------------------------------------------
+	bool sameValue(double a, double b)
+	{
+		return memcmp(&a, &b, sizeof(double)) == 0;
+	}
+
+	//------------------------------------------------------------------------
+	//	Function:		benchVector()
+	//	Description:	runs vectorLines over vectorRows rows in vector mode
+	//					and row by row on a CRPNEngine.  Every row must
+	//					agree on the status, the top of the stack and the
+	//					registers.
+	//	Returns:		false on a mismatch
+	//------------------------------------------------------------------------
+	bool benchVector()
+	{
+		const list<string> program(begin(vectorLines), end(vectorLines));
+		const size_t depth = 2;
+		CRPNVector columns;
+		columns.setProgram(program);
+		columns.setRows(vectorRows, depth);
+		for (size_t i = 0; i < vectorRows; i++)
+		{
+			columns.stackColumn(0)[i] = static_cast<double>(i % 61);
+			columns.stackColumn(1)[i] = (i % 11) * 0.5 - 2.0;
+			columns.registerColumn(0)[i] = i * 0.25;
+			columns.registerColumn(1)[i] = static_cast<double>(i % 97);
+			columns.registerColumn(2)[i] = (i % 13) - 6.0;
+			columns.registerColumn(3)[i] = 1.0 / (i % 7 + 1);
+		}
+		benchClock::time_point start = benchClock::now();
+		columns.run();
+		chrono::duration<double, milli> vectorTime = benchClock::now() - start;
+
+		CRPNEngine engine;
+		engine.setProgram(program);
+		vector<unsigned char> status(vectorRows);
+		vector<double> results(vectorRows);
+		vector<double> registers(vectorRows * NUMREGS);
+		start = benchClock::now();
+		for (size_t i = 0; i < vectorRows; i++)
+		{
+			engine.reset();
+			for (size_t s = 0; s < depth; s++)
+				engine.push(columns.stackColumn(s)[i]);
+			for (int reg = 0; reg < NUMREGS; reg++)
+				engine.setRegister(reg, columns.registerColumn(reg)[i]);
+			double top = 0.0;
+			EvalResult result = engine.evaluate("R", top);
+			status[i] = static_cast<unsigned char>(result);
+			results[i] = (result == EVAL_OK) ? top : 0.0;
+			for (int reg = 0; reg < NUMREGS; reg++)
+				registers[i * NUMREGS + reg] = engine.registerValue(reg);
+		}
+		chrono::duration<double, milli> scalarTime = benchClock::now() - start;
+
+		bool ok = columns.vectorized();
+		size_t errors = 0;
+		for (size_t i = 0; ok && i < vectorRows; i++)
+		{
+			ok = status[i] == columns.status()[i]
+				&& sameValue(results[i], columns.results()[i]);
+			for (int reg = 0; ok && reg < NUMREGS; reg++)
+				ok = sameValue(registers[i * NUMREGS + reg],
+					columns.registerResults(reg)[i]);
+			if (status[i] == EVAL_ERROR)
+				errors++;
+		}
+
+		cout << "vector mode (" << vectorRows << " rows, " << errors
+			<< " errors, " << vectorKernels() << " kernels)" << endl;
+		cout << setw(12) << "" << setw(14) << "ms" << setw(14) << "rows/s"
+			<< endl;
+		cout << setw(12) << "engine" << setw(14) << fixed << setprecision(3)
+			<< scalarTime.count() << setw(14) << setprecision(0)
+			<< vectorRows / scalarTime.count() * 1000.0 << endl;
+		cout << setw(12) << "vector" << setw(14) << setprecision(3)
+			<< vectorTime.count() << setw(14) << setprecision(0)
+			<< vectorRows / vectorTime.count() * 1000.0 << endl;
+		cout << setw(12) << "speedup" << setw(14) << setprecision(2)
+			<< scalarTime.count() / vectorTime.count() << endl;
+		g_report.add("vector", "engine", "rows_per_s",
+			vectorRows / scalarTime.count() * 1000.0);
+		g_report.add("vector", "vector", "rows_per_s",
+			vectorRows / vectorTime.count() * 1000.0);
+		if (!ok)
+			cerr << "MISMATCH: vector mode and the engine disagree" << endl;
+		return ok;
+	}
+
+	//------------------------------------------------------------------------
+	//	Function:		makeNumbers()
+	//	Description:	numberCount finite doubles from a fixed seed
+	//	Returns:		the numbers
+	//------------------------------------------------------------------------
+	vector<double> makeNumbers()
+	{
+		mt19937_64 generator(20261017);
+		vector<double> numbers;
+		numbers.reserve(numberCount);
+		while (numbers.size() < numberCount)
+		{
+			const uint64_t bits = generator();
+			double d = 0.0;
+			switch (numbers.size() % 4)
+			{
+			case 0:
+				d = static_cast<double>(bits % 2000001) - 1000000.0;
+				break;
+			case 1:
+				d = static_cast<double>(bits % 100000) / 1000.0;
+				break;
+			default:
+				memcpy(&d, &bits, sizeof d);
+				if (!isfinite(d))
+					continue;
+			}
+			numbers.push_back(d);
+		}
+		return numbers;
+	}
+
+	//------------------------------------------------------------------------
+	//	Function:		benchNumbers()
+	//	Description:	times formatNumber() against ostream << double and
+	//					snprintf("%.17g"), and the tokenizer against
+	//					strtod(), over makeNumbers().  Every number must
+	//					read back from formatNumber()'s text bit for bit.
+	//	Returns:		false on a mismatch
+	//------------------------------------------------------------------------
+	bool benchNumbers()
+	{
+		const vector<double> numbers = makeNumbers();
+		char number[NUMBERSIZE];
+
+		string text;
+		text.reserve(numberCount * 16);
+		benchClock::time_point start = benchClock::now();
+		for (double d : numbers)
+		{
+			text.append(number, formatNumber(d, number, sizeof(number)));
+			text.push_back(' ');
+		}
+		chrono::duration<double, milli> shortest = benchClock::now() - start;
+
+		ostringstream sout;
+		start = benchClock::now();
+		for (double d : numbers)
+			sout << d << ' ';
+		chrono::duration<double, milli> streamed = benchClock::now() - start;
+
+		size_t printed = 0;
+		start = benchClock::now();
+		for (double d : numbers)
+			printed += snprintf(number, sizeof(number), "%.17g", d);
+		chrono::duration<double, milli> printf17 = benchClock::now() - start;
+		g_sink = g_sink + static_cast<double>(printed + sout.str().size());
+
+		// the tokenizer reads "-0" as 0 negated
+		vector<double> parsed;
+		parsed.reserve(numberCount);
+		start = benchClock::now();
+		CRPNTokenizer tokenizer(text);
+		SToken token;
+		while (tokenizer.next(token))
+			parsed.push_back(token.type == TOK_NEGZERO ? -token.value
+				: token.type == TOK_NUMBER ? token.value : NAN);
+		chrono::duration<double, milli> tokenized = benchClock::now() - start;
+
+		double sum = 0.0;
+		start = benchClock::now();
+		for (const char* p = text.c_str(); *p != '\0'; p++)
+		{
+			char* end = nullptr;
+			sum += strtod(p, &end);
+			p = end;
+		}
+		chrono::duration<double, milli> strtodTime = benchClock::now() - start;
+		g_sink = g_sink + sum;
+
+		size_t mismatches = 0;
+		if (parsed.size() != numbers.size())
+			mismatches = numberCount;
+		else
+			for (size_t i = 0; i < numbers.size(); i++)
+				if (!sameValue(parsed[i], numbers[i]))
+					mismatches++;
+
+		cout << "numbers (" << numberCount << " values, "
+			<< text.size() / numberCount << " bytes each)" << endl;
+		cout << setw(20) << "" << setw(14) << "ms" << setw(14) << "Mnum/s"
+			<< endl;
+		const pair<const char*, double> rows[] =
+		{
+			{ "format shortest", shortest.count() },
+			{ "format ostream", streamed.count() },
+			{ "format %.17g", printf17.count() },
+			{ "parse tokenizer", tokenized.count() },
+			{ "parse strtod", strtodTime.count() }
+		};
+		for (const pair<const char*, double>& row : rows)
+		{
+			cout << setw(20) << row.first << setw(14) << fixed
+				<< setprecision(3) << row.second << setw(14)
+				<< setprecision(2) << numberCount / row.second / 1000.0
+				<< endl;
+			g_report.add("numbers", row.first, "numbers_per_s",
+				numberCount / row.second * 1000.0);
+		}
+		if (mismatches > 0)
+			cerr << "MISMATCH: " << mismatches << " numbers did not read "
+				<< "back from their text" << endl;
+		return mismatches == 0;
+	}
+
+	//------------------------------------------------------------------------
+	//	Function:		timeLoop(CRPNEngine& engine, const string& program,
+	//						const string& setup, size_t runs)
+	//	Description:	gives engine program and evaluates setup, then
+	//					evaluates "R" runs times with the clock running
+	//	Returns:		the time in s
+	//------------------------------------------------------------------------
+	double timeLoop(CRPNEngine& engine, const string& program,
+		const string& setup, size_t runs)
+	{
+		engine.setProgramText(program);
+		engine.compileProgram();
+		double top = 0.0;
+		engine.evaluate(setup, top);
+		benchClock::time_point start = benchClock::now();
+		for (size_t r = 0; r < runs; r++)
+			engine.evaluate("R", top);
+		chrono::duration<double> elapsed = benchClock::now() - start;
+		return elapsed.count();
+	}
+
+	//------------------------------------------------------------------------
+	//	Function:		benchLoops()
+	//	Description:	checks labels, branches, loops and calls on
+	//					loopChecks and recordedLoop, then times loops run
+	//					inside one R against the same body run from the
+	//					host, one R per iteration.  Each loop's sum is checked against
+	//					the same arithmetic in C++.
+	//	Returns:		false on a mismatch
+	//------------------------------------------------------------------------
+	bool benchLoops()
+	{
+		bool ok = true;
+		for (const auto& check : loopChecks)
+		{
+			CRPNEngine engine;
+			engine.setJumpLimit(loopCheckJumps);
+			engine.setProgramText(check.program);
+			// twice: the second run starts from the first one's state
+			for (int run = 0; run < 2; run++)
+			{
+				engine.reset();
+				double top = 0.0;
+				const EvalResult status = engine.evaluate("R", top);
+				const double end = engine.empty() ? 0.0 : engine.top();
+				if (status != check.status || end != check.top)
+				{
+					cerr << "MISMATCH: \"" << check.program << "\" gave "
+						<< end << endl;
+					ok = false;
+					break;
+				}
+			}
+		}
+		double top = 0.0;
+		if (CRPNEngine().evaluate(":a 1", top) != EVAL_ERROR
+			|| CRPNEngine().evaluate("1 J:a", top) != EVAL_ERROR)
+		{
+			cerr << "MISMATCH: a label or branch was taken outside a program"
+				<< endl;
+			ok = false;
+		}
+		{
+			CRPNCalc calc;
+			istringstream in(recordedLoop);
+			ostringstream out;
+			calc.runBatch(in, out);
+			if (out.str() != recordedLoopOutput)
+			{
+				cerr << "MISMATCH: the loop recorded through P gave \""
+					<< out.str() << "\"" << endl;
+				ok = false;
+			}
+		}
+
+		cout << "loops" << endl;
+		cout << setw(16) << "way" << setw(14) << "iterations" << setw(12)
+			<< "s" << setw(14) << "ns/iter" << endl;
+		const struct
+		{
+			const char* name;
+			const char* body;	// S0 counts down from the iterations
+			double iterations;
+			bool squares;		// sums the squares of S0, not S0
+		} ways[] = {
+			{ "counted (K)", ":a G1 G0 + S1 C K0:a", loopIterations,
+				false },
+			{ "compare (>)", ":a G1 G0 + S1 C 1 G0 - S0 C 0 G0 >:a",
+				branchIterations, false },
+			{ "call (@)", ":a G0 @:sq G1 + S1 C K0:a J:e :sq S2 G2 * ; :e",
+				branchIterations, true },
+			{ "driven (R)", "G1 G0 + S1 C 1 G0 - S0 C",
+				static_cast<double>(drivenRuns), false }
+		};
+		for (const auto& way : ways)
+		{
+			const bool driven = (way.body[0] != ':');
+			double want = 0.0;
+			for (double i = way.iterations; i > 0; i--)
+				want = want + (way.squares ? i * i : i);
+			CRPNEngine engine;
+			const string setup = "0 S1 " + to_string(static_cast<long long>(
+				way.iterations)) + " S0 CE";
+			const double seconds = timeLoop(engine, way.body, setup,
+				driven ? drivenRuns : 1);
+			if (engine.registerValue(1) != want || engine.error())
+			{
+				cerr << "MISMATCH: " << way.name << " summed to "
+					<< engine.registerValue(1) << ", not " << want << endl;
+				ok = false;
+			}
+			const double ns = seconds * 1e9 / way.iterations;
+			cout << setw(16) << way.name << setw(14) << fixed
+				<< setprecision(0) << way.iterations << setw(12)
+				<< setprecision(3) << seconds << setw(14) << setprecision(2)
+				<< ns << endl;
+			g_report.add("loops", way.name, "ns_per_iteration", ns);
+		}
+		return ok;
+	}
+
+	//------------------------------------------------------------------------
+	//	Function:		libraryProgramText(const string& name)
+	//	Description:	the text of one program in libraryText
+	//	Returns:		the lines after "[name]" up to the next program
+	//------------------------------------------------------------------------
+	string libraryProgramText(const string& name)
+	{
+		const string text = libraryText;
+		size_t first = text.find("[" + name + "]\n");
+		if (first == string::npos)
+			return string();
+		first += name.size() + 3;
+		const size_t last = text.find('[', first);
+		return text.substr(first, last == string::npos ? string::npos
+			: last - first);
+	}
+
+	//------------------------------------------------------------------------
+	//	Function:		benchLibrary()
+	//	Description:	loads libraryText from a file and checks its
+	//					programs on libraryChecks, a redefinition, a
+	//					recorded program that runs them and a file that is
+	//					not a library.  Then times librarySwitches runs
+	//					that switch program every time: R:name from the
+	//					library, the text set with setProgramText() and
+	//					run with R, and the program loaded from its own
+	//					file and run with R.  All three must give the same
+	//					results.
+	//	Returns:		false on a mismatch
+	//------------------------------------------------------------------------
+	bool benchLibrary()
+	{
+		{
+			ofstream fout(libraryFileName, ios::out | ios::trunc
+				| ios::binary);
+			fout << libraryText;
+		}
+		bool ok = true;
+		CRPNEngine engine;
+		if (!engine.loadLibrary(libraryFileName))
+		{
+			cerr << "MISMATCH: the library file did not load" << endl;
+			ok = false;
+		}
+		// a copy of the compiled library must run just as the original
+		CRPNEngine copy;
+		copy.copyLibrary(engine);
+		double top = 0.0;
+		for (CRPNEngine* target : { &engine, &copy })
+			for (const auto& check : libraryChecks)
+			{
+				target->reset();
+				const EvalResult status = target->evaluate(check.line, top);
+				const double end = target->empty() ? 0.0 : target->top();
+				if (status != check.status || end != check.top)
+				{
+					cerr << "MISMATCH: \"" << check.line << "\" gave " << end
+						<< (target == &copy ? " from the copy" : "") << endl;
+					ok = false;
+				}
+			}
+		// programs that call inc run the new code
+		engine.reset();
+		engine.defineProgram("inc", "2 +\n");
+		ok = engine.evaluate("3 R:chain", top) == EVAL_OK && top == 11 && ok;
+		engine.reset();
+		engine.setProgramText("R:twice 1 +\n");
+		ok = engine.evaluate("2 R", top) == EVAL_OK && top == 9.5 && ok;
+		{
+			ofstream fout(libraryFileName, ios::out | ios::trunc
+				| ios::binary);
+			fout << "1 2 +\n[late]\n1 +\n";
+		}
+		const size_t programs = engine.library().size();
+		if (engine.loadLibrary(libraryFileName)
+			|| engine.library().size() != programs)
+		{
+			cerr << "MISMATCH: text before the first program loaded" << endl;
+			ok = false;
+		}
+		remove(libraryFileName);
+		if (!ok)
+			cerr << "MISMATCH: library programs" << endl;
+
+		const size_t count = sizeof(switchPrograms) / sizeof(switchPrograms[0]);
+		vector<string> libraryLines;
+		vector<string> texts;
+		vector<string> files;
+		CRPNEngine library;
+		for (size_t k = 0; k < count; k++)
+		{
+			libraryLines.push_back(string("C 1.25 R:") + switchPrograms[k]);
+			texts.push_back(libraryProgramText(switchPrograms[k]));
+			library.defineProgram(switchPrograms[k], texts.back());
+			files.push_back(string("rpnCalcRoutine") + to_string(k)
+				+ ".tmp");
+			ofstream fout(files.back(), ios::out | ios::trunc | ios::binary);
+			fout << texts.back();
+		}
+
+		cout << "library (" << librarySwitches << " runs, " << count
+			<< " programs, a switch every run)" << endl;
+		cout << setw(22) << "way" << setw(14) << "ms" << setw(14)
+			<< "ns/run" << endl;
+		double sums[3] = { 0.0, 0.0, 0.0 };
+		double times[3] = { 0.0, 0.0, 0.0 };
+		const char* const names[] =
+		{
+			"library (R:name)", "setProgramText + R", "file load + R"
+		};
+		CRPNEngine recorded;
+		CRPNEngine loaded;
+		for (int way = 0; way < 3; way++)
+		{
+			benchClock::time_point start = benchClock::now();
+			for (size_t r = 0; r < librarySwitches; r++)
+			{
+				const size_t k = r % count;
+				EvalResult status;
+				if (way == 0)
+					status = library.evaluate(libraryLines[k], top);
+				else if (way == 1)
+				{
+					recorded.setProgramText(texts[k]);
+					status = recorded.evaluate("C 1.25 R", top);
+				}
+				else
+				{
+					loaded.loadProgramFile(files[k]);
+					status = loaded.evaluate("C 1.25 R", top);
+				}
+				sums[way] += (status == EVAL_OK) ? top : -1.0;
+			}
+			chrono::duration<double, milli> elapsed = benchClock::now()
+				- start;
+			times[way] = elapsed.count();
+			cout << setw(22) << names[way] << setw(14) << fixed
+				<< setprecision(3) << times[way] << setw(14)
+				<< setprecision(0) << times[way] * 1e6 / librarySwitches
+				<< endl;
+			g_report.add("library", names[way], "ns_per_run",
+				times[way] * 1e6 / librarySwitches);
+		}
+		for (const string& file : files)
+			remove(file.c_str());
+		if (sums[0] != sums[1] || sums[0] != sums[2])
+		{
+			cerr << "MISMATCH: switched runs disagree (" << sums[0] << ", "
+				<< sums[1] << ", " << sums[2] << ")" << endl;
+			ok = false;
+		}
+		return ok;
+	}
+
+	//------------------------------------------------------------------------
+	//	Function:		benchRegisters()
+	//	Description:	runs registerCounts accumulators (x = 0.5x + k) held
+	//					in named registers, with and without the JIT, and
+	//					held on the stack, where each update ends with U
+	//					to bring the next one to the top, as programs did
+	//					before there were more than ten registers.  Every
+	//					way must end with the same values.
+	//	Returns:		false on a mismatch
+	//------------------------------------------------------------------------
+	bool benchRegisters()
+	{
+		cout << "named registers (" << registerWork << " updates per row)"
+			<< endl;
+		cout << setw(12) << "count" << setw(14) << "rotate ms" << setw(14)
+			<< "named ms" << setw(14) << "jit ms" << setw(14) << "speedup"
+			<< endl;
+		bool ok = true;
+		for (size_t count : registerCounts)
+		{
+			list<string> named;
+			list<string> rotated;
+			string fill;
+			for (size_t k = 0; k < count; k++)
+			{
+				const string name = "acc" + to_string(k);
+				named.push_back("G:" + name + " 0.5 * " + to_string(k)
+					+ " + S:" + name + " C");
+				rotated.push_back("0.5 * " + to_string(k) + " + U");
+				fill += "0 ";
+			}
+			const size_t runs = registerWork / count;
+
+			// the stack form: acc0 on top, acc(count - 1) at the bottom
+			CRPNEngine rotate;
+			rotate.setProgram(rotated);
+			double top = 0.0;
+			rotate.evaluate(fill, top);
+			benchClock::time_point start = benchClock::now();
+			for (size_t r = 0; r < runs; r++)
+				rotate.evaluate("R", top);
+			chrono::duration<double, milli> rotateTime =
+				benchClock::now() - start;
+
+			double times[2] = { 0.0, 0.0 };
+			for (int jit = 0; jit < 2; jit++)
+			{
+				CRPNEngine engine;
+				engine.setProgram(named);
+				engine.setJit(jit == 1);
+				start = benchClock::now();
+				for (size_t r = 0; r < runs; r++)
+					engine.evaluate("R", top);
+				chrono::duration<double, milli> time =
+					benchClock::now() - start;
+				times[jit] = time.count();
+
+				size_t mismatches = 0;
+				for (size_t k = 0; k < count; k++)
+				{
+					const int slot = engine.registerNames().find(
+						"acc" + to_string(k));
+					// U walks the stack form back to acc0 on top
+					if (!sameValue(engine.registerValue(slot), rotate.top()))
+						mismatches++;
+					rotate.evaluate("U", top);
+				}
+				if (mismatches > 0)
+				{
+					cerr << "MISMATCH: " << mismatches << " of " << count
+						<< " named registers disagree with the stack form"
+						<< (jit == 1 ? " (jit)" : "") << endl;
+					ok = false;
+				}
+			}
+
+			cout << setw(12) << count << setw(14) << fixed << setprecision(3)
+				<< rotateTime.count() << setw(14) << times[0] << setw(14)
+				<< times[1] << setw(14) << setprecision(2)
+				<< rotateTime.count() / min(times[0], times[1]) << endl;
+			g_report.add("registers", to_string(count) + " rotate",
+				"updates_per_s", registerWork / rotateTime.count() * 1000.0);
+			g_report.add("registers", to_string(count) + " named",
+				"updates_per_s", registerWork / times[0] * 1000.0);
+			g_report.add("registers", to_string(count) + " jit",
+				"updates_per_s", registerWork / times[1] * 1000.0);
+		}
+		return ok;
+	}
+
+	//------------------------------------------------------------------------
+	//	Function:		benchCache()
+	//	Description:	runs cacheLines cacheRuns times, cycling through
+	//					cacheStates starting states, with the result cache
+	//					off and at each of cacheCapacities.  Every run must
+	//					agree with the uncached run from the same state on
+	//					the status, the top of the stack and the registers.
+	//	Returns:		false on a mismatch
+	//------------------------------------------------------------------------
+	bool benchCache()
+	{
+		const list<string> program(begin(cacheLines), end(cacheLines));
+		vector<double> expected(cacheStates * (NUMREGS + 2));
+		bool ok = true;
+		double baseline = 0.0;
+		cout << "result cache (" << program.size() << " lines, "
+			<< cacheStates << " states, " << cacheRuns << " runs)" << endl;
+		cout << setw(12) << "capacity" << setw(14) << "ms" << setw(14)
+			<< "runs/s" << setw(14) << "hit %" << setw(14) << "speedup"
+			<< endl;
+		for (size_t capacity : cacheCapacities)
+		{
+			CRPNEngine engine;
+			engine.setProgram(program);
+			engine.setResultCache(capacity);
+			size_t mismatches = 0;
+			benchClock::time_point start = benchClock::now();
+			for (size_t r = 0; r < cacheRuns; r++)
+			{
+				const size_t state = r % cacheStates;
+				engine.reset();
+				engine.setRegister(0, static_cast<double>(state + 1));
+				double top = 0.0;
+				EvalResult result = engine.evaluate("R", top);
+				double* row = &expected[state * (NUMREGS + 2)];
+				// the first pass without the cache records the answers
+				if (capacity == 0 && r < cacheStates)
+				{
+					row[0] = result;
+					row[1] = (result == EVAL_OK) ? top : 0.0;
+					for (int reg = 0; reg < NUMREGS; reg++)
+						row[2 + reg] = engine.registerValue(reg);
+					continue;
+				}
+				bool same = row[0] == result
+					&& sameValue(row[1], (result == EVAL_OK) ? top : 0.0);
+				for (int reg = 0; same && reg < NUMREGS; reg++)
+					same = sameValue(row[2 + reg], engine.registerValue(reg));
+				if (!same)
+					mismatches++;
+			}
+			chrono::duration<double, milli> time = benchClock::now() - start;
+			if (capacity == 0)
+				baseline = time.count();
+
+			const CRPNResultCache& cache = engine.resultCache();
+			const uint64_t lookups = cache.hits() + cache.misses();
+			const double hitRate = lookups == 0 ? 0.0
+				: 100.0 * cache.hits() / lookups;
+			const string name = capacity == 0 ? "off" : to_string(capacity);
+			cout << setw(12) << name << setw(14) << fixed << setprecision(3)
+				<< time.count() << setw(14) << setprecision(0)
+				<< cacheRuns / time.count() * 1000.0 << setw(14)
+				<< setprecision(1) << hitRate << setw(14) << setprecision(2)
+				<< baseline / time.count() << endl;
+			g_report.add("cache", name, "runs_per_s",
+				cacheRuns / time.count() * 1000.0);
+			g_report.add("cache", name, "hit_rate", hitRate);
+			if (mismatches > 0)
+			{
+				cerr << "MISMATCH: " << mismatches << " cached runs with "
+					<< "capacity " << name << " disagree" << endl;
+				ok = false;
+			}
+		}
+		return ok;
+	}
+
+	//------------------------------------------------------------------------
+	//	Function:		makeLedger(vector<string>& ledger,
+	//						vector<string>& rates, int64_t& totalCents)
+	//	Description:	numericLines ledger lines ("G0 19.99 3 * + S0 C")
+	//					and as many rate lines ("CE 12 19.99 3 * 1.0825 *
+	//					/") from a fixed seed
+	//	Returns:		n/a; totalCents receives the exact ledger total
+	//------------------------------------------------------------------------
+	void makeLedger(vector<string>& ledger, vector<string>& rates,
+		int64_t& totalCents)
+	{
+		mt19937_64 generator(20261017);
+		totalCents = 0;
+		char line[64];
+		for (size_t i = 0; i < numericLines; i++)
+		{
+			const int cents = static_cast<int>(generator() % 100000);
+			const int quantity = static_cast<int>(generator() % 12) + 1;
+			snprintf(line, sizeof line, "G0 %d.%02d %d * + S0 C",
+				cents / 100, cents % 100, quantity);
+			ledger.push_back(line);
+			snprintf(line, sizeof line, "CE 12 %d.%02d %d * 1.0825 * /",
+				cents / 100, cents % 100, quantity);
+			rates.push_back(line);
+			totalCents += static_cast<int64_t>(cents) * quantity;
+		}
+		ledger.push_back("G0");
+	}
+
+	//------------------------------------------------------------------------
+	//	Function:		evaluateText(CRPNEngine& engine, string_view line,
+	//						string& top)
+	//	Description:	CRPNEngine::evaluate() with the top formatted, as
+	//					CRPNNumericEngine::evaluate() returns it
+	//	Returns:		the EvalResult
+	//------------------------------------------------------------------------
+	EvalResult evaluateText(CRPNEngine& engine, string_view line, string& top)
+	{
+		double d = 0.0;
+		EvalResult result = engine.evaluate(line, d);
+		if (result == EVAL_OK)
+		{
+			char number[NUMBERSIZE];
+			top.assign(number, formatNumber(d, number, sizeof(number)));
+		}
+		return result;
+	}
+
+	EvalResult evaluateText(CRPNNumericEngine& engine, string_view line,
+		string& top)
+	{
+		return engine.evaluate(line, top);
+	}
+
+	//------------------------------------------------------------------------
+	//	Function:		runNumeric(E& engine, const vector<string>& lines,
+	//						vector<string>& results)
+	//	Description:	evaluates lines in order on one engine, keeping
+	//					the formatted result of each
+	//	Returns:		the time taken in milliseconds
+	//------------------------------------------------------------------------
+	template <class E>
+	double runNumeric(E& engine, const vector<string>& lines,
+		vector<string>& results)
+	{
+		results.resize(lines.size());
+		benchClock::time_point start = benchClock::now();
+		for (size_t i = 0; i < lines.size(); i++)
+			if (evaluateText(engine, lines[i], results[i]) != EVAL_OK)
+				results[i].clear();
+		chrono::duration<double, milli> time = benchClock::now() - start;
+		return time.count();
+	}
+
+	//------------------------------------------------------------------------
+	//	Function:		checkConformance()
+	//	Description:	runs the conformanceLines random lines on CRPNEngine
+	//					and on CRPNTypedEngine<double>, and each of
+	//					doubleOnlyLines on every typed engine.  A command
+	//					added to CRPNEngine belongs in conformanceTokens
+	//					once the typed engines run it, or in
+	//					doubleOnlyLines if they reject it.
+	//	Returns:		false if the two disagree on a line, or a typed
+	//					engine runs a line it should reject
+	//------------------------------------------------------------------------
+	bool checkConformance()
+	{
+		CRPNEngine engine;
+		CRPNTypedEngine<double> typed;
+		const list<string> program(1, conformanceProgram);
+		engine.setProgram(program);
+		typed.setProgram(program);
+		mt19937 random(17);
+		const size_t tokenCount = sizeof(conformanceTokens)
+			/ sizeof(conformanceTokens[0]);
+		size_t mismatches = 0;
+		for (size_t i = 0; i < conformanceLines; i++)
+		{
+			string line;
+			const size_t tokens = 1 + random() % 8;
+			for (size_t t = 0; t < tokens; t++)
+			{
+				line += conformanceTokens[random() % tokenCount];
+				line += ' ';
+			}
+			string expected;
+			string top;
+			const EvalResult expectedStatus = evaluateText(engine, line,
+				expected);
+			const EvalResult status = typed.evaluate(line, top);
+			if (status != expectedStatus
+				|| (status == EVAL_OK && top != expected))
+			{
+				if (mismatches == 0)
+					cerr << "MISMATCH: \"" << line << "\" gave " << top
+						<< " on the double engine and " << expected
+						<< " on CRPNEngine" << endl;
+				mismatches++;
+			}
+		}
+		if (mismatches > 0)
+			cerr << "MISMATCH: " << mismatches << " of " << conformanceLines
+				<< " lines differ between the engines" << endl;
+
+		bool ok = mismatches == 0;
+		const NumericMode modes[] = { NUM_DOUBLE, NUM_LONGDOUBLE,
+			NUM_DECIMAL };
+		for (NumericMode mode : modes)
+			for (const char* line : doubleOnlyLines)
+			{
+				string top;
+				if (createNumericEngine(mode)->evaluate(line, top)
+					!= EVAL_ERROR)
+				{
+					cerr << "MISMATCH: a typed engine ran \"" << line << "\""
+						<< endl;
+					ok = false;
+				}
+			}
+		return ok;
+	}
+
+	//------------------------------------------------------------------------
+	//	Function:		benchNumeric()
+	//	Description:	runs the ledger and rate lines on CRPNEngine and on
+	//					a CRPNTypedEngine for double, long double and
+	//					CRPNDecimal at each of numericPrecisions.  The
+	//					double engine must match CRPNEngine line for line,
+	//					the decimal ledger total must be exact, and
+	//					decimalChecks must give their results.  First
+	//					checks the typed engines' conformance.
+	//	Returns:		false on a mismatch
+	//------------------------------------------------------------------------
+	bool benchNumeric()
+	{
+		vector<string> ledger;
+		vector<string> rates;
+		int64_t totalCents = 0;
+		makeLedger(ledger, rates, totalCents);
+		bool ok = checkConformance();
+		char exact[32];
+		snprintf(exact, sizeof exact, "%lld.%02lld",
+			static_cast<long long>(totalCents / 100),
+			static_cast<long long>(totalCents % 100));
+
+		cout << "numeric modes (" << numericLines << " lines per workload, "
+			<< "ledger total " << exact << ")" << endl;
+		cout << setw(14) << "" << setw(12) << "ledger ms" << setw(14)
+			<< "lines/s" << setw(12) << "rates ms" << setw(14) << "lines/s"
+			<< setw(12) << "inline %" << "  total" << endl;
+		vector<string> ledgerResults;
+		vector<string> rateResults;
+		vector<string> expectedLedger;
+		vector<string> expectedRates;
+		auto report = [&](const string& name, double ledgerTime,
+			double rateTime, double inlined)
+		{
+			cout << setw(14) << name << setw(12) << fixed << setprecision(3)
+				<< ledgerTime << setw(14) << setprecision(0)
+				<< numericLines / ledgerTime * 1000.0 << setw(12)
+				<< setprecision(3) << rateTime << setw(14) << setprecision(0)
+				<< numericLines / rateTime * 1000.0 << setw(12);
+			if (inlined < 0)
+				cout << "";
+			else
+				cout << setprecision(1) << inlined;
+			cout << "  " << ledgerResults.back() << endl;
+			g_report.add("numeric", name + " ledger", "lines_per_s",
+				numericLines / ledgerTime * 1000.0);
+			g_report.add("numeric", name + " rates", "lines_per_s",
+				numericLines / rateTime * 1000.0);
+		};
+
+		{
+			CRPNEngine engine;
+			const double ledgerTime = runNumeric(engine, ledger,
+				expectedLedger);
+			engine.reset();
+			const double rateTime = runNumeric(engine, rates, expectedRates);
+			ledgerResults = expectedLedger;
+			report("engine", ledgerTime, rateTime, -1.0);
+		}
+		{
+			CRPNTypedEngine<double> engine;
+			const double ledgerTime = runNumeric(engine, ledger,
+				ledgerResults);
+			engine.reset();
+			const double rateTime = runNumeric(engine, rates, rateResults);
+			report("double", ledgerTime, rateTime, -1.0);
+			if (ledgerResults != expectedLedger || rateResults != expectedRates)
+			{
+				cerr << "MISMATCH: the double engine and CRPNEngine disagree"
+					<< endl;
+				ok = false;
+			}
+		}
+		{
+			CRPNTypedEngine<long double> engine;
+			const double ledgerTime = runNumeric(engine, ledger,
+				ledgerResults);
+			engine.reset();
+			const double rateTime = runNumeric(engine, rates, rateResults);
+			report("long double", ledgerTime, rateTime, -1.0);
+		}
+		for (unsigned precision : numericPrecisions)
+		{
+			CRPNTypedEngine<CRPNDecimal> engine(precision);
+			const double ledgerTime = runNumeric(engine, ledger,
+				ledgerResults);
+			engine.reset();
+			const double rateTime = runNumeric(engine, rates, rateResults);
+			// how many rate results fit in 64 bits, on a second pass
+			size_t inlined = 0;
+			for (const string& line : rates)
+			{
+				string top;
+				if (engine.evaluate(line, top) == EVAL_OK
+					&& engine.top().inlined())
+					inlined++;
+			}
+			const string name = "decimal:" + to_string(precision);
+			report(name, ledgerTime, rateTime,
+				100.0 * inlined / rates.size());
+			if (ledgerResults.back() != exact)
+			{
+				cerr << "MISMATCH: " << name << " ledger total is "
+					<< ledgerResults.back() << endl;
+				ok = false;
+			}
+		}
+
+		CRPNTypedEngine<CRPNDecimal> checker;
+		for (const auto& check : decimalChecks)
+		{
+			string top;
+			checker.reset();
+			if (checker.evaluate(check[0], top) != EVAL_OK || top != check[1])
+			{
+				cerr << "MISMATCH: \"" << check[0] << "\" gave " << top
+					<< " in decimal, not " << check[1] << endl;
+				ok = false;
+			}
+		}
+		return ok;
+	}
+
+	//------------------------------------------------------------------------
+	//	Function:		countAllocations(F work, size_t runs)
+	//	Description:	calls work once to warm it up, then runs more times
+	//	Returns:		the heap allocations made by the measured runs
+	//------------------------------------------------------------------------
+	template <class F>
+	uint64_t countAllocations(F work, size_t runs)
+	{
+		work();
+		const uint64_t before = g_allocations;
+		for (size_t r = 0; r < runs; r++)
+			work();
+		return g_allocations - before;
+	}
+
+	//------------------------------------------------------------------------
+	//	Function:		benchAlloc()
+	//	Description:	counts heap allocations in steady-state work:
+	//					evaluating lines, running a program with and
+	//					without the JIT and from the result cache,
+	//					recording a program again and running it, batch
+	//					input through CRPNCalc and the decimal ledger.
+	//					Each of these must make no allocation once warmed
+	//					up.  Decimal rates at the default precision, which
+	//					need more than 64 bits, are reported but not
+	//					checked.
+	//	Returns:		false when a checked scenario allocates
+	//------------------------------------------------------------------------
+	bool benchAlloc()
+	{
+		const list<string> program(begin(programLines), end(programLines));
+		const list<string> cached(begin(cacheLines), end(cacheLines));
+		vector<string> ledger;
+		vector<string> rates;
+		int64_t totalCents = 0;
+		makeLedger(ledger, rates, totalCents);
+
+		cout << "heap allocations (" << allocRuns << " runs after a "
+			<< "warm-up)" << endl;
+		cout << setw(24) << "" << setw(14) << "allocations" << setw(14)
+			<< "per run" << endl;
+		bool ok = true;
+		auto report = [&ok](const char* name, uint64_t allocations,
+			size_t runs, bool checked)
+		{
+			cout << setw(24) << name << setw(14) << allocations << setw(14)
+				<< fixed << setprecision(4)
+				<< static_cast<double>(allocations) / runs
+				<< (checked ? "" : "  (not checked)") << endl;
+			g_report.add("alloc", name, "allocations",
+				static_cast<double>(allocations));
+			if (checked && allocations > 0)
+			{
+				cerr << "MISMATCH: " << name << " allocates in steady state"
+					<< endl;
+				ok = false;
+			}
+		};
+
+		{
+			CRPNEngine engine;
+			size_t i = 0;
+			report("evaluate", countAllocations([&]()
+			{
+				double top = 0.0;
+				engine.evaluate(rates[i++ % rates.size()], top);
+				g_sink = top;
+			}, allocRuns), allocRuns, true);
+		}
+		for (bool jit : { false, true })
+		{
+			CRPNEngine engine;
+			engine.setProgram(program);
+			engine.setJit(jit);
+			double top = 0.0;
+			// past the JIT threshold, so the measured runs are native
+			for (unsigned r = 0; r < JITTHRESHOLD; r++)
+				engine.evaluate("R", top);
+			report(jit ? "run (jit)" : "run (interpreter)",
+				countAllocations([&]()
+			{
+				engine.evaluate("R", top);
+			}, allocRuns), allocRuns, true);
+		}
+		{
+			CRPNEngine engine;
+			engine.setProgram(cached);
+			engine.setResultCache(2 * cacheStates);
+			size_t r = 0;
+			// one pass over the states fills the cache
+			double top = 0.0;
+			for (size_t state = 0; state < cacheStates; state++)
+			{
+				engine.reset();
+				engine.setRegister(0, static_cast<double>(state));
+				engine.evaluate("R", top);
+			}
+			report("run (cache hit)", countAllocations([&]()
+			{
+				engine.reset();
+				engine.setRegister(0, static_cast<double>(r++ % cacheStates));
+				engine.evaluate("R", top);
+				g_sink = top;
+			}, allocRuns), allocRuns, true);
+		}
+		{
+			CRPNEngine engine;
+			report("record and run", countAllocations([&]()
+			{
+				double top = 0.0;
+				engine.setProgram(program);
+				engine.evaluate("R", top);
+			}, allocRuns), allocRuns, true);
+			cout << setw(24) << "" << "program arena: "
+				<< engine.programArena().used() << " bytes used, "
+				<< engine.programArena().capacity() << " reserved in "
+				<< engine.programArena().blocks() << " block(s), "
+				<< engine.programArena().heapAllocations()
+				<< " allocation(s)" << endl;
+		}
+		{
+			// the same calculator reads the small input to warm up, then
+			// the small and the large one; work that grows with the input
+			// shows as a difference.  Each result is cleared so the stack
+			// does not grow.
+			CRPNCalc calc;
+			uint64_t counts[3] = { 0, 0, 0 };
+			for (int pass = 0; pass < 3; pass++)
+			{
+				const size_t size = allocBatchLines[pass == 2 ? 1 : 0];
+				string text;
+				char line[64];
+				for (size_t r = 0; r < size; r += 100)
+				{
+					text += allocRecording;
+					for (size_t i = 0; i < 95; i += 2)
+					{
+						snprintf(line, sizeof line, "%zu 4 + %zu * 2 ^ 7 %%\nC\n",
+							(r + i) % 97, (r + i) % 13 + 1);
+						text += line;
+					}
+				}
+				istringstream in(text);
+				CHashSink sink;
+				ostream out(&sink);
+				const uint64_t before = g_allocations;
+				calc.runBatch(in, out);
+				counts[pass] = g_allocations - before;
+			}
+			report("batch", counts[2] - counts[1],
+				allocBatchLines[1] - allocBatchLines[0], true);
+		}
+		{
+			CRPNTypedEngine<CRPNDecimal> engine;
+			size_t i = 0;
+			report("decimal ledger", countAllocations([&]()
+			{
+				string top;
+				engine.evaluate(ledger[i++ % (ledger.size() - 1)], top);
+			}, allocRuns), allocRuns, true);
+			engine.reset();
+			i = 0;
+			string top;
+			report("decimal rates", countAllocations([&]()
+			{
+				engine.evaluate(rates[i++ % rates.size()], top);
+			}, allocRuns), allocRuns, false);
+		}
+		return ok;
+	}
+}
+//----------------------------------------------------------------------------
+//	Function:		main()
+//	Description:	runs every benchmark and prints the results, then
+//					whether each group's self-checks passed.  A failed
+//					check prints a MISMATCH line on cerr.
+//					Options:
+//						--check             run only the groups that have
+//						                    self-checks, print PASS or
+//						                    FAIL for each and no tables
+//						--parallel-lines n  size of the parallel workload
+//						--only a,b,...      run only the named benchmarks
+//						--json file         also write the results as JSON
+//						--csv file          also write the results as CSV
+//	Returns:		EXIT_SUCCESS  = successful
+//					EXIT_FAILURE  = a self-check failed, or a report
+//									could not be written
+//----------------------------------------------------------------------------
+int main(int argc, char* argv[])
+{
+	size_t parallelLines = defaultParallelLines;
+	bool checkOnly = false;
+	string only;
+	const char* jsonFile = nullptr;
+	const char* csvFile = nullptr;
+	for (int arg = 1; arg < argc; arg++)
+	{
+		if (strcmp(argv[arg], "--parallel-lines") == 0 && arg + 1 < argc)
+			parallelLines = strtoull(argv[++arg], nullptr, 10);
+		else if (strcmp(argv[arg], "--check") == 0)
+			checkOnly = true;
+		else if (strcmp(argv[arg], "--only") == 0 && arg + 1 < argc)
+			only = string(",") + argv[++arg] + ",";
+		else if (strcmp(argv[arg], "--json") == 0 && arg + 1 < argc)
+			jsonFile = argv[++arg];
+		else if (strcmp(argv[arg], "--csv") == 0 && arg + 1 < argc)
+			csvFile = argv[++arg];
+		else
+		{
+			cerr << "usage: " << argv[0] << " [--check] [--parallel-lines n]"
+				<< " [--only tokenizer,program,ops,dispatch,rotate,registers,"
+				<< "loops,library,stack,batch,threads,parallel,file,binary,"
+				<< "server,vector,"
+				<< "cache,numbers,numeric,alloc]"
+				<< " [--json file]"
+				<< " [--csv file]"
+				<< endl;
+			return EXIT_FAILURE;
+		}
+	}
+	auto selected = [&only](const char* name)
+	{
+		return only.empty() || only.find(string(",") + name + ",")
+			!= string::npos;
+	};
+
+	g_operatorsAdded = addOperators();
+	if (CRPNEngine().stats() != nullptr)
+		cout << "note: built with RPNCALC_STATS; timings include the cost"
+			<< " of collecting statistics" << endl << endl;
+
+	// each group's self-check result, or none for timings alone
+	const struct
+	{
+		const char* name;
+		function<bool()> run;
+		bool checks;
+	} groups[] = {
+		{ "tokenizer", []() { benchTokenizer(); return true; }, false },
+		{ "program", []() { benchProgram(); return true; }, false },
+		{ "ops", benchOps, true },
+		{ "dispatch", benchDispatch, true },
+		{ "rotate", benchRotate, true },
+		{ "registers", benchRegisters, true },
+		{ "loops", benchLoops, true },
+		{ "library", benchLibrary, true },
+		{ "stack", []() { benchStack(); return true; }, false },
+		{ "batch", []() { benchBatch(); return true; }, false },
+		{ "threads", benchThreads, true },
+		{ "parallel", [parallelLines]() { return benchParallel(parallelLines); },
+			true },
+		{ "file", benchLoad, true },
+		{ "binary", benchBinary, true },
+		{ "server", benchServer, true },
+		{ "vector", benchVector, true },
+		{ "cache", benchCache, true },
+		{ "numbers", benchNumbers, true },
+		{ "numeric", benchNumeric, true },
+		{ "alloc", benchAlloc, true }
+	};
+
+	bool ok = true;
+	vector<pair<string, bool>> results;
+	CHashSink discard;
+	for (const auto& group : groups)
+	{
+		if (!selected(group.name) || (checkOnly && !group.checks))
+			continue;
+		// --check keeps the MISMATCH lines, on cerr, and drops the tables
+		streambuf* const tables = cout.rdbuf();
+		if (checkOnly)
+			cout.rdbuf(&discard);
+		const bool passed = group.run();
+		cout.rdbuf(tables);
+		ok = passed && ok;
+		if (group.checks)
+			results.emplace_back(group.name, passed);
+		if (checkOnly)
+			cout << (passed ? "PASS " : "FAIL ") << group.name << endl;
+	}
+	if (!checkOnly && !results.empty())
+	{
+		cout << "self-checks" << endl;
+		for (const auto& result : results)
+			cout << setw(16) << result.first << setw(14)
+				<< (result.second ? "passed" : "FAILED") << endl;
+	}
+
+	if (jsonFile != nullptr)
+	{
+		ofstream fout(jsonFile, ios::out | ios::trunc);
+		g_report.writeJson(fout, ok);
+		if (!fout)
+			ok = false;
+	}
+	if (csvFile != nullptr)
+	{
+		ofstream fout(csvFile, ios::out | ios::trunc);
+		g_report.writeCsv(fout);
+		if (!fout)
+			ok = false;
+	}
+	return ok ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -1,18 +1,212 @@
 //----------------------------------------------------------------------------
 // CalcDriver.cpp
 //
-// functions: main()
+// functions: parseCount()
+//            writeStats()
+//            loadLibrary()
+//            runNumericBatch()
+//            stopServer()
+//            runServer()
+//            main()
 //----------------------------------------------------------------------------
+#include <cerrno>
+#include <csignal>
 #include <iostream>
 #include <cstdlib>
-#include "RPNCalc.h"
+#include <cstring>
+#include <fstream>
+#include <memory>
+#include <string>
+#include "rpnBatch.h"
+#include "rpnCalc.h"
+#include "rpnNumeric.h"
+#include "rpnServer.h"
 
 using namespace std;
+//----------------------------------------------------------------------------
+//	Function:		parseCount(const char* text, unsigned long long max,
+//						unsigned long long& value)
+//	Description:	reads a whole decimal count: digits only, no sign,
+//					spaces or trailing characters, and at most max
+//	Returns:		bool -- false if text is not such a count
+//----------------------------------------------------------------------------
+bool parseCount(const char* text, unsigned long long max,
+	unsigned long long& value)
+{
+	if (*text < '0' || *text > '9')
+		return false;
+	char* end = nullptr;
+	errno = 0;
+	value = strtoull(text, &end, 10);
+	return *end == '\0' && errno == 0 && value <= max;
+}
+
+//----------------------------------------------------------------------------
+//	Function:		writeStats(const PB_CALC::CRPNStats* stats, bool json)
+//	Description:	writes engine statistics to stderr
+//	Returns:		n/a
+//----------------------------------------------------------------------------
+void writeStats(const PB_CALC::CRPNStats* stats, bool json)
+{
+	if (stats == nullptr)
+		cerr << "statistics are not collected in this build"
+			<< " (define RPNCALC_STATS)" << endl;
+	else if (json)
+		stats->writeJson(cerr);
+	else
+		stats->writeText(cerr);
+}
+
+//----------------------------------------------------------------------------
+//	Function:		loadLibrary(T& target, const char* filename)
+//	Description:	loads a library file into an engine or a batch, and
+//					says so on stderr if it cannot
+//	Returns:		bool -- false if filename is not null and could not be
+//					loaded
+//----------------------------------------------------------------------------
+template <class T>
+bool loadLibrary(T& target, const char* filename)
+{
+	if (filename == nullptr || target.loadLibrary(filename))
+		return true;
+	cerr << "could not load library " << filename << endl;
+	return false;
+}
+
+//----------------------------------------------------------------------------
+//	Function:		runNumericBatch(PB_CALC::CRPNNumericEngine& engine,
+//						istream& istr, ostream& ostr)
+//	Description:	batch mode on an engine of another number type: one
+//					result per input line, written as CRPNCalc::runBatch()
+//					writes them, with the state kept from line to line
+//	Returns:		n/a
+//----------------------------------------------------------------------------
+void runNumericBatch(PB_CALC::CRPNNumericEngine& engine, istream& istr,
+	ostream& ostr)
+{
+	const size_t flushSize = 65536;	// as CRPNCalc::runBatch()
+	string line;
+	string top;
+	string results;
+	while (getline(istr, line))
+	{
+		switch (engine.evaluate(line, top))
+		{
+		case PB_CALC::EVAL_OK:
+			results += top;
+			break;
+		case PB_CALC::EVAL_ERROR:
+			results += PB_CALC::errorText;
+			break;
+		default:
+			break;
+		}
+		results += '\n';
+		if (results.size() >= flushSize)
+		{
+			ostr.write(results.data(), results.size());
+			results.clear();
+		}
+	}
+	ostr.write(results.data(), results.size());
+	ostr.flush();
+}
+
+// the most worker threads -j takes
+const unsigned long long maxThreads = 1024;
+
+// the server runServer() is running, for stopServer()
+PB_CALC::CRPNServer* g_server = nullptr;
+
+//----------------------------------------------------------------------------
+//	Function:		stopServer(int signal)
+//	Description:	SIGINT and SIGTERM handler: stops the server, which
+//					closes its sessions and removes its socket file
+//	Returns:		n/a
+//----------------------------------------------------------------------------
+extern "C" void stopServer(int)
+{
+	if (g_server != nullptr)
+		g_server->stop();
+}
+
+//----------------------------------------------------------------------------
+//	Function:		runServer(const char* address, const char* library,
+//						unsigned long long jumps, bool stats,
+//						bool statsJson)
+//	Description:	server mode: serves evaluation sessions on address,
+//					a Unix domain socket path or a loopback TCP port,
+//					until SIGINT or SIGTERM, each request held to jumps
+//					jumps
+//	Returns:		EXIT_SUCCESS  = stopped by a signal
+//					EXIT_FAILURE  = could not listen, or epoll failed
+//----------------------------------------------------------------------------
+int runServer(const char* address, const char* library,
+	unsigned long long jumps, bool stats, bool statsJson)
+{
+	PB_CALC::CRPNServer server;
+	if (!PB_CALC::CRPNServer::supported())
+	{
+		cerr << "server mode needs epoll (Linux)" << endl;
+		return EXIT_FAILURE;
+	}
+	server.setJumpLimit(jumps);
+	if (library != nullptr && !server.loadLibrary(library))
+	{
+		cerr << "could not load library " << library << endl;
+		return EXIT_FAILURE;
+	}
+	if (!server.listen(address))
+	{
+		cerr << "could not listen on " << address << endl;
+		return EXIT_FAILURE;
+	}
+	g_server = &server;
+	signal(SIGINT, stopServer);
+	signal(SIGTERM, stopServer);
+	const bool ok = server.run();
+	g_server = nullptr;
+	if (stats)
+	{
+		PB_CALC::CRPNStats total;
+		writeStats(server.mergeStats(total) ? &total : nullptr, statsJson);
+	}
+	return ok ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
 //----------------------------------------------------------------------------
 //	Function:		main()
 //	Title:			Driver for RPN Calculator
 //	Description:	This file contains function main()
-//					which creates and starts a calculator
+//					which creates and starts a calculator.
+//					Usage:
+//						RPN_Calculator_2017            interactive
+//						RPN_Calculator_2017 -b [file]  batch: one result
+//						                               per input line
+//						RPN_Calculator_2017 -b -j n [file]
+//						                               parallel batch on n
+//						                               threads (0: all,
+//						                               at most 1024);
+//						                               lines independent;
+//						                               a regular file is
+//						                               mapped, not read
+//						RPN_Calculator_2017 -b -n mode [file]
+//						                               batch in another
+//						                               number type: double,
+//						                               long, decimal or
+//						                               decimal:digits
+//						RPN_Calculator_2017 --serve address [jumps]
+//						                               server: a session
+//						                               per connection,
+//						                               on a Unix socket
+//						                               path or a loopback
+//						                               TCP port; a request
+//						                               may take jumps
+//						                               jumps (1000000)
+//					--stats or --stats-json before any of these writes
+//					the engine statistics to stderr at the end, and
+//					--library file, after it, preloads the programs of a
+//					library file for R:name
 //	Programmer:		Han S. Jung
 //					Chi Cheuk Chow
 //					Huy Nguyen
@@ -21,14 +215,165 @@ using namespace std;
 //					Software:   MS Windows 7 for execution; 
 //					Compiles under Microsoft Visual C++.Net 2012
 //	Calls:			CRPNCalc constructor
+//					CRPNCalc::run()
+//					CRPNCalc::runBatch()
+//					CRPNBatch::run()
+//					CRPNBatch::mergeStats()
+//					CRPNMappedFile::open()
+//					createNumericEngine()
+//					loadLibrary()
+//					runNumericBatch()
+//					runServer()
+//					writeStats()
 //	Returns:		EXIT_SUCCESS  = successful 
+//					EXIT_FAILURE  = bad arguments or unreadable file
 //	History Log:
 //					6/10/17  HJ  completed version 1.0
+//					10/17/26 HJ  batch mode, version 1.1
+//					10/17/26 HJ  parallel batch mode, version 1.2
+//					10/17/26 HJ  map parallel batch files, version 1.3
+//					10/17/26 HJ  statistics, version 1.4
+//					10/17/26 HJ  numeric modes, version 1.5
+//					10/17/26 HJ  library files, version 1.6
+//					10/17/26 HJ  server mode, version 1.7
+//					10/17/26 HJ  -j rejects a count that is not a number,
+//								 version 1.8
+//					10/17/26 HJ  --serve takes a jump limit, version 1.9
 //----------------------------------------------------------------------------
-int main(void)
+int main(int argc, char* argv[])
 {
+	using PB_CALC::CRPNBatch;
 	using PB_CALC::CRPNCalc;
+	using PB_CALC::CRPNMappedFile;
+	using PB_CALC::CRPNStats;
+	int first = 1;
+	bool stats = false;
+	bool statsJson = false;
+	if (argc > 1 && (strcmp(argv[1], "--stats") == 0
+		|| strcmp(argv[1], "--stats-json") == 0))
+	{
+		stats = true;
+		statsJson = strcmp(argv[1], "--stats-json") == 0;
+		first = 2;
+	}
+	const char* library = nullptr;
+	if (argc > first + 1 && strcmp(argv[first], "--library") == 0)
+	{
+		library = argv[first + 1];
+		first += 2;
+	}
+	unsigned long long jumps = PB_CALC::SERVERJUMPLIMIT;
+	if ((argc == first + 2 || argc == first + 3)
+		&& strcmp(argv[first], "--serve") == 0
+		&& (argc == first + 2
+		|| parseCount(argv[first + 2], PB_CALC::MAXJUMPS, jumps)))
+		return runServer(argv[first + 1], library, jumps, stats, statsJson);
+	if (argc > first)
+	{
+		int arg = first + 1;
+		bool parallel = false;
+		unsigned long long threads = 0;
+		bool numeric = false;
+		bool badMode = false;
+		PB_CALC::NumericMode mode = PB_CALC::NUM_DOUBLE;
+		unsigned precision = PB_CALC::DEFAULTPRECISION;
+		if (arg + 1 < argc && strcmp(argv[arg], "-j") == 0)
+		{
+			parallel = true;
+			badMode = !parseCount(argv[arg + 1], maxThreads, threads);
+			arg += 2;
+		}
+		else if (arg + 1 < argc && strcmp(argv[arg], "-n") == 0)
+		{
+			numeric = true;
+			badMode = !PB_CALC::parseNumericMode(argv[arg + 1], mode,
+				precision);
+			arg += 2;
+		}
+		if ((strcmp(argv[first], "-b") != 0
+			&& strcmp(argv[first], "--batch") != 0)
+			|| argc > arg + 1 || badMode)
+		{
+			cerr << "usage: " << argv[0] << " [--stats | --stats-json]"
+				<< " [--library file]"
+				<< " [-b [-j threads | -n double|long|decimal[:digits]]"
+				<< " [file] | --serve socket|port [jumps]]" << endl;
+			return EXIT_FAILURE;
+		}
+		ios::sync_with_stdio(false);
+		if (parallel && arg < argc)
+		{
+			// a file that cannot be mapped (a pipe, say) is read below
+			CRPNMappedFile file;
+			if (file.open(argv[arg]))
+			{
+				CRPNBatch batch(static_cast<unsigned>(threads));
+				if (!loadLibrary(batch, library))
+					return EXIT_FAILURE;
+				batch.run(file.data(), cout);
+				if (stats)
+				{
+					CRPNStats total;
+					writeStats(batch.mergeStats(total) ? &total : nullptr,
+						statsJson);
+				}
+				return EXIT_SUCCESS;
+			}
+		}
+		ifstream fin;
+		if (arg < argc)
+		{
+			fin.open(argv[arg]);
+			if (!fin.is_open())
+			{
+				cerr << "could not open " << argv[arg] << endl;
+				return EXIT_FAILURE;
+			}
+		}
+		istream& istr = fin.is_open() ? static_cast<istream&>(fin) : cin;
+		if (numeric)
+		{
+			unique_ptr<PB_CALC::CRPNNumericEngine> engine =
+				PB_CALC::createNumericEngine(mode, precision);
+			if (library != nullptr)
+				cerr << "library programs are not run in numeric modes"
+					<< endl;
+			runNumericBatch(*engine, istr, cout);
+			if (stats)
+				cerr << "statistics are not collected in numeric modes"
+					<< endl;
+		}
+		else if (parallel)
+		{
+			CRPNBatch batch(static_cast<unsigned>(threads));
+			if (!loadLibrary(batch, library))
+				return EXIT_FAILURE;
+			batch.run(istr, cout);
+			if (stats)
+			{
+				CRPNStats total;
+				writeStats(batch.mergeStats(total) ? &total : nullptr,
+					statsJson);
+			}
+		}
+		else
+		{
+			CRPNCalc batchCalc;
+			if (!loadLibrary(batchCalc, library))
+				return EXIT_FAILURE;
+			batchCalc.runBatch(istr, cout);
+			if (stats)
+				writeStats(batchCalc.stats(), statsJson);
+		}
+		return EXIT_SUCCESS;
+	}
+
 	CRPNCalc myCalc;
+	if (!loadLibrary(myCalc, library))
+		return EXIT_FAILURE;
+	myCalc.run();
+	if (stats)
+		writeStats(myCalc.stats(), statsJson);
 	cout << endl << "Press \"enter\" to continue";
 	cin.get();
 
@@ -0,0 +1,1160 @@
+#include "rpnDecimal.h"
+#include <cfloat>
+#include <charconv>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <utility>
+//-------------------------------------------------------------------------------------------
+//    Class:		CRPNDecimal
+//
+//    File:			rpnDecimal.cpp
+//
+//    Description:	This file contains the function definitions for
+//					CRPNDecimal.  Each operation first tries the inline
+//					path, where both coefficients fit in 64 bits and so
+//					does the result; anything else goes through base 10^9
+//					limbs and is rounded back to the precision.
+//
+//    Programmer:	Han Jung
+//
+//    Date:			10/17/2026
+//
+//    Version:		1.0
+//
+//    Environment:	Intel Xeon PC
+//                  Software:   MS Windows 10 for execution;
+//                  Compiles under Microsoft Visual C++ 2017 (/std:c++17)
+//
+//	  class:		CRPNDecimal
+//
+//	  Properties:
+//				uint64_t m_small;
+//				vector<uint32_t> m_big;
+//				int32_t m_exponent;
+//				bool m_negative;
+//
+//	  Non-inline Methods:
+//				bool isZero() const;
+//				size_t digits() const;
+//				void format(string& text) const;
+//				long double toLongDouble() const;
+//				static bool parse(string_view text, unsigned precision,
+//					CRPNDecimal& result);
+//				static bool fromLongDouble(long double d, unsigned precision,
+//					CRPNDecimal& result);
+//				static bool add(const CRPNDecimal& a, const CRPNDecimal& b,
+//					unsigned precision, CRPNDecimal& result);
+//				static bool subtract(const CRPNDecimal& a,
+//					const CRPNDecimal& b, unsigned precision,
+//					CRPNDecimal& result);
+//				static bool multiply(const CRPNDecimal& a,
+//					const CRPNDecimal& b, unsigned precision,
+//					CRPNDecimal& result);
+//				static bool divide(const CRPNDecimal& a, const CRPNDecimal& b,
+//					unsigned precision, CRPNDecimal& result);
+//				static bool mod(const CRPNDecimal& a, const CRPNDecimal& b,
+//					unsigned precision, CRPNDecimal& result);
+//				static bool power(const CRPNDecimal& a, const CRPNDecimal& b,
+//					unsigned precision, CRPNDecimal& result);
+//
+//				private:
+//					static bool sum(const CRPNDecimal& a,
+//						const CRPNDecimal& b, bool flip, unsigned precision,
+//						CRPNDecimal& result);
+//					bool round(unsigned precision);
+//					void magnitude(vector<uint32_t>& limbs) const;
+//					bool setMagnitude(vector<uint32_t>& limbs,
+//						int64_t exponent, bool negative,
+//						unsigned precision, bool sticky);
+//					bool setSmall(uint64_t coefficient, int64_t exponent,
+//						bool negative, unsigned precision);
+//
+//    History Log:
+//				10/17/2026	HJ arbitrary-precision decimal numbers, version 1.0
+// ----------------------------------------------------------------------------
+namespace PB_CALC
+{
+	namespace
+	{
+		typedef vector<uint32_t> Limbs;
+
+		const uint32_t LIMBBASE = 1000000000;
+		const unsigned LIMBDIGITS = 9;
+
+		const uint64_t powersOfTen[] =
+		{
+			1ULL, 10ULL, 100ULL, 1000ULL, 10000ULL, 100000ULL, 1000000ULL,
+			10000000ULL, 100000000ULL, 1000000000ULL, 10000000000ULL,
+			100000000000ULL, 1000000000000ULL, 10000000000000ULL,
+			100000000000000ULL, 1000000000000000ULL, 10000000000000000ULL,
+			100000000000000000ULL, 1000000000000000000ULL,
+			10000000000000000000ULL
+		};
+		const unsigned MAXPOWER = 19;
+
+		//--------------------------------------------------------------------
+		//	Function:		countDigits(uint64_t v)
+		//	Returns:		the decimal digits in v; 1 for 0
+		//--------------------------------------------------------------------
+		unsigned countDigits(uint64_t v)
+		{
+			unsigned digits = 1;
+			while (digits <= MAXPOWER && v >= powersOfTen[digits])
+				digits++;
+			return digits;
+		}
+
+		//--------------------------------------------------------------------
+		//	Function:		scale(uint64_t& v, int64_t k)
+		//	Description:	multiplies v by 10^k if the product fits
+		//	Returns:		false if it does not
+		//--------------------------------------------------------------------
+		bool scale(uint64_t& v, int64_t k)
+		{
+			if (k == 0)
+				return true;
+			if (k > MAXPOWER || v > UINT64_MAX / powersOfTen[k])
+				return false;
+			v *= powersOfTen[k];
+			return true;
+		}
+
+		//--------------------------------------------------------------------
+		//	Function:		multiply64(uint64_t a, uint64_t b, uint64_t& high)
+		//	Description:	the full 128-bit product of a and b, in 32-bit
+		//					halves so it needs no compiler extension
+		//	Returns:		the low 64 bits; high receives the rest
+		//--------------------------------------------------------------------
+		uint64_t multiply64(uint64_t a, uint64_t b, uint64_t& high)
+		{
+			const uint64_t mask = 0xFFFFFFFFULL;
+			const uint64_t p0 = (a & mask) * (b & mask);
+			const uint64_t p1 = (a & mask) * (b >> 32);
+			const uint64_t p2 = (a >> 32) * (b & mask);
+			const uint64_t p3 = (a >> 32) * (b >> 32);
+			const uint64_t middle = (p0 >> 32) + (p1 & mask) + (p2 & mask);
+			high = p3 + (p1 >> 32) + (p2 >> 32) + (middle >> 32);
+			return (p0 & mask) | (middle << 32);
+		}
+
+		void trim(Limbs& a)
+		{
+			while (!a.empty() && a.back() == 0)
+				a.pop_back();
+		}
+
+		void fromU64(uint64_t v, Limbs& a)
+		{
+			a.clear();
+			while (v != 0)
+			{
+				a.push_back(static_cast<uint32_t>(v % LIMBBASE));
+				v /= LIMBBASE;
+			}
+		}
+
+		bool toU64(const Limbs& a, uint64_t& v)
+		{
+			v = 0;
+			for (size_t i = a.size(); i-- > 0;)
+			{
+				if (v > (UINT64_MAX - a[i]) / LIMBBASE)
+					return false;
+				v = v * LIMBBASE + a[i];
+			}
+			return true;
+		}
+
+		size_t digitCount(const Limbs& a)
+		{
+			return a.empty() ? 1
+				: (a.size() - 1) * LIMBDIGITS + countDigits(a.back());
+		}
+
+		int compare(const Limbs& a, const Limbs& b)
+		{
+			if (a.size() != b.size())
+				return a.size() < b.size() ? -1 : 1;
+			for (size_t i = a.size(); i-- > 0;)
+				if (a[i] != b[i])
+					return a[i] < b[i] ? -1 : 1;
+			return 0;
+		}
+
+		// a += b
+		void addTo(Limbs& a, const Limbs& b)
+		{
+			if (a.size() < b.size())
+				a.resize(b.size(), 0);
+			uint32_t carry = 0;
+			for (size_t i = 0; i < a.size(); i++)
+			{
+				uint32_t sum = a[i] + carry + (i < b.size() ? b[i] : 0);
+				carry = sum >= LIMBBASE;
+				a[i] = carry ? sum - LIMBBASE : sum;
+				if (!carry && i >= b.size())
+					break;
+			}
+			if (carry)
+				a.push_back(1);
+		}
+
+		// a -= b, where a >= b
+		void subtractFrom(Limbs& a, const Limbs& b)
+		{
+			uint32_t borrow = 0;
+			for (size_t i = 0; i < a.size(); i++)
+			{
+				const uint32_t sub = borrow + (i < b.size() ? b[i] : 0);
+				borrow = a[i] < sub;
+				a[i] = borrow ? a[i] + LIMBBASE - sub : a[i] - sub;
+				if (!borrow && i >= b.size())
+					break;
+			}
+			trim(a);
+		}
+
+		// a = a * m + add, m and add below LIMBBASE
+		void multiplySmall(Limbs& a, uint32_t m, uint32_t add)
+		{
+			uint64_t carry = add;
+			for (uint32_t& limb : a)
+			{
+				carry += static_cast<uint64_t>(limb) * m;
+				limb = static_cast<uint32_t>(carry % LIMBBASE);
+				carry /= LIMBBASE;
+			}
+			if (carry != 0)
+				a.push_back(static_cast<uint32_t>(carry));
+			trim(a);
+		}
+
+		// a /= d, d below LIMBBASE; returns the remainder
+		uint32_t divideSmall(Limbs& a, uint32_t d)
+		{
+			uint64_t remainder = 0;
+			for (size_t i = a.size(); i-- > 0;)
+			{
+				remainder = remainder * LIMBBASE + a[i];
+				a[i] = static_cast<uint32_t>(remainder / d);
+				remainder %= d;
+			}
+			trim(a);
+			return static_cast<uint32_t>(remainder);
+		}
+
+		void multiplyLimbs(const Limbs& a, const Limbs& b, Limbs& product)
+		{
+			product.assign(a.size() + b.size(), 0);
+			for (size_t i = 0; i < a.size(); i++)
+			{
+				uint64_t carry = 0;
+				for (size_t j = 0; j < b.size(); j++)
+				{
+					carry += product[i + j]
+						+ static_cast<uint64_t>(a[i]) * b[j];
+					product[i + j] = static_cast<uint32_t>(carry % LIMBBASE);
+					carry /= LIMBBASE;
+				}
+				for (size_t k = i + b.size(); carry != 0; k++)
+				{
+					carry += product[k];
+					product[k] = static_cast<uint32_t>(carry % LIMBBASE);
+					carry /= LIMBBASE;
+				}
+			}
+			trim(product);
+		}
+
+		// a *= 10^k
+		void shiftUp(Limbs& a, size_t k)
+		{
+			if (a.empty())
+				return;
+			a.insert(a.begin(), k / LIMBDIGITS, 0);
+			multiplySmall(a, static_cast<uint32_t>(powersOfTen[k % LIMBDIGITS]),
+				0);
+		}
+
+		void limbsToDigits(const Limbs& a, string& digits)
+		{
+			digits.clear();
+			if (a.empty())
+			{
+				digits.push_back('0');
+				return;
+			}
+			char buffer[16];
+			int length = snprintf(buffer, sizeof buffer, "%u", a.back());
+			digits.append(buffer, length);
+			for (size_t i = a.size() - 1; i-- > 0;)
+			{
+				length = snprintf(buffer, sizeof buffer, "%09u", a[i]);
+				digits.append(buffer, length);
+			}
+		}
+
+		void digitsToLimbs(const char* first, const char* last, Limbs& a)
+		{
+			a.clear();
+			while (last > first)
+			{
+				const char* start = (last - first > LIMBDIGITS)
+					? last - LIMBDIGITS : first;
+				uint32_t limb = 0;
+				for (const char* p = start; p < last; p++)
+					limb = limb * 10 + (*p - '0');
+				a.push_back(limb);
+				last = start;
+			}
+			trim(a);
+		}
+
+		//--------------------------------------------------------------------
+		//	Function:		roundOff(Limbs& a, size_t drop, bool sticky)
+		//	Description:	divides a by 10^drop, rounding half to even;
+		//					sticky says non-zero digits were already
+		//					dropped below a.  drop must be at least 1.
+		//--------------------------------------------------------------------
+		void roundOff(Limbs& a, size_t drop, bool sticky)
+		{
+			const size_t whole = (drop - 1) / LIMBDIGITS;
+			for (size_t i = 0; i < whole && i < a.size(); i++)
+				sticky = sticky || a[i] != 0;
+			a.erase(a.begin(), a.begin() + min(whole, a.size()));
+			const size_t rest = (drop - 1) % LIMBDIGITS;
+			if (rest > 0 && divideSmall(a, static_cast<uint32_t>(
+				powersOfTen[rest])) != 0)
+				sticky = true;
+			const uint32_t digit = divideSmall(a, 10);
+			const bool odd = !a.empty() && (a[0] & 1) != 0;
+			if (digit > 5 || (digit == 5 && (sticky || odd)))
+				multiplySmall(a, 1, 1);
+		}
+
+		//--------------------------------------------------------------------
+		//	Function:		divideLimbs(const Limbs& numerator,
+		//						const Limbs& denominator, Limbs& quotient,
+		//						Limbs& remainder)
+		//	Description:	integer division.  A one-limb denominator is a
+		//					single pass; otherwise the quotient is found a
+		//					decimal digit at a time.
+		//--------------------------------------------------------------------
+		void divideLimbs(const Limbs& numerator, const Limbs& denominator,
+			Limbs& quotient, Limbs& remainder)
+		{
+			if (denominator.size() == 1)
+			{
+				quotient = numerator;
+				fromU64(divideSmall(quotient, denominator[0]), remainder);
+				return;
+			}
+			string digits;
+			limbsToDigits(numerator, digits);
+			string quotientDigits;
+			remainder.clear();
+			for (char c : digits)
+			{
+				multiplySmall(remainder, 10, static_cast<uint32_t>(c - '0'));
+				char q = '0';
+				while (compare(remainder, denominator) >= 0)
+				{
+					subtractFrom(remainder, denominator);
+					q++;
+				}
+				quotientDigits.push_back(q);
+			}
+			digitsToLimbs(quotientDigits.data(),
+				quotientDigits.data() + quotientDigits.size(), quotient);
+		}
+	}
+
+	//-------------------------------------------------------------------------
+	//		method:			isZero() const
+	//		description:	tests for zero of either sign
+	//		calls:			n/a
+	//		called by:		CRPNTypedEngine<CRPNDecimal>
+	//						divide()
+	//						mod()
+	//						power()
+	//		parameters:		n/a
+	//		returns:		bool -- true if the value is zero
+	//		History Log:
+	//					10/17/2026 HJ completed version 1.0
+	// -------------------------------------------------------------------------
+	bool CRPNDecimal::isZero() const
+	{
+		return m_big.empty() && m_small == 0;
+	}
+	//-------------------------------------------------------------------------
+	//		method:			digits() const
+	//		description:	counts the digits of the coefficient
+	//		calls:			countDigits()
+	//						digitCount()
+	//		called by:		mod()
+	//						add()
+	//		parameters:		n/a
+	//		returns:		size_t -- the digits; 1 for zero
+	//		History Log:
+	//					10/17/2026 HJ completed version 1.0
+	// -------------------------------------------------------------------------
+	size_t CRPNDecimal::digits() const
+	{
+		return m_big.empty() ? countDigits(m_small) : digitCount(m_big);
+	}
+	//-------------------------------------------------------------------------
+	//		method:			format(string& text) const
+	//		description:	writes the value the way the General Decimal
+	//						Arithmetic specification's to-scientific-string
+	//						does, with a lower case 'e': plain notation
+	//						("1234.50", "0.000012") unless the exponent is
+	//						positive or the value is under 10^-6
+	//						("1.2e+3", "1e-7").  Trailing zeros are kept.
+	//		calls:			limbsToDigits()
+	//		called by:		CRPNTypedEngine<CRPNDecimal>
+	//						toLongDouble()
+	//		parameters:		string& text -- receives the text
+	//		returns:		n/a
+	//		History Log:
+	//					10/17/2026 HJ completed version 1.0
+	// -------------------------------------------------------------------------
+	void CRPNDecimal::format(string& text) const
+	{
+		string digits;
+		if (m_big.empty())
+		{
+			char buffer[24];
+			to_chars_result result = to_chars(buffer, buffer + sizeof buffer,
+				m_small);
+			digits.assign(buffer, result.ptr);
+		}
+		else
+			limbsToDigits(m_big, digits);
+
+		text.clear();
+		if (m_negative)
+			text.push_back('-');
+		const int64_t length = static_cast<int64_t>(digits.size());
+		const int64_t adjusted = m_exponent + length - 1;
+		if (m_exponent <= 0 && adjusted >= -6)
+		{
+			if (m_exponent == 0)
+				text += digits;
+			else if (length > -m_exponent)
+			{
+				text.append(digits, 0, length + m_exponent);
+				text.push_back('.');
+				text.append(digits, length + m_exponent, string::npos);
+			}
+			else
+			{
+				text += "0.";
+				text.append(-m_exponent - length, '0');
+				text += digits;
+			}
+			return;
+		}
+		text.push_back(digits[0]);
+		if (length > 1)
+		{
+			text.push_back('.');
+			text.append(digits, 1, string::npos);
+		}
+		text.push_back('e');
+		text.push_back(adjusted < 0 ? '-' : '+');
+		text += to_string(adjusted < 0 ? -adjusted : adjusted);
+	}
+	//-------------------------------------------------------------------------
+	//		method:			toLongDouble() const
+	//		description:	the nearest long double
+	//		calls:			format()
+	//						strtold()
+	//		called by:		power()
+	//		parameters:		n/a
+	//		returns:		long double -- the value
+	//		History Log:
+	//					10/17/2026 HJ completed version 1.0
+	// -------------------------------------------------------------------------
+	long double CRPNDecimal::toLongDouble() const
+	{
+		string text;
+		format(text);
+		return strtold(text.c_str(), nullptr);
+	}
+	//-------------------------------------------------------------------------
+	//		method:			parse(string_view text, unsigned precision,
+	//							CRPNDecimal& result)
+	//		description:	converts a literal ([-]digits[.digits]
+	//						[e[+-]digits]) exactly, then rounds it to
+	//						precision digits.  Trailing zeros count:
+	//						"1.50" has coefficient 150 and exponent -2.
+	//		calls:			setSmall()
+	//						setMagnitude()
+	//						digitsToLimbs()
+	//		called by:		CRPNTypedEngine<CRPNDecimal>
+	//						fromLongDouble()
+	//		parameters:		string_view text -- the literal
+	//						unsigned precision -- significant digits kept
+	//						CRPNDecimal& result -- receives the value
+	//		returns:		bool -- false if text is not a literal or its
+	//						exponent is out of range
+	//		History Log:
+	//					10/17/2026 HJ completed version 1.0
+	// -------------------------------------------------------------------------
+	bool CRPNDecimal::parse(string_view text, unsigned precision,
+		CRPNDecimal& result)
+	{
+		size_t i = 0;
+		const bool negative = i < text.size() && text[i] == '-';
+		if (negative)
+			i++;
+		const size_t first = i;
+		uint64_t small = 0;
+		bool leading = true;
+		bool fits = true;
+		int64_t exponent = 0;
+		size_t count = 0;
+		bool point = false;
+		for (; i < text.size(); i++)
+		{
+			const char c = text[i];
+			if (c == '.' && !point)
+			{
+				point = true;
+				continue;
+			}
+			if (c < '0' || c > '9')
+				break;
+			count++;
+			if (point)
+				exponent--;
+			if (leading && c == '0')
+				continue;
+			leading = false;
+			if (fits && small <= (UINT64_MAX - (c - '0')) / 10)
+				small = small * 10 + (c - '0');
+			else
+				fits = false;
+		}
+		if (count == 0)
+			return false;
+		const size_t last = i;
+		if (i < text.size() && (text[i] == 'e' || text[i] == 'E'))
+		{
+			i++;
+			const bool negativeExponent = i < text.size() && text[i] == '-';
+			if (i < text.size() && (text[i] == '-' || text[i] == '+'))
+				i++;
+			if (i >= text.size())
+				return false;
+			int64_t power = 0;
+			for (; i < text.size() && text[i] >= '0' && text[i] <= '9'; i++)
+				if (power < 10 * static_cast<int64_t>(MAXEXPONENT))
+					power = power * 10 + (text[i] - '0');
+			exponent += negativeExponent ? -power : power;
+		}
+		if (i != text.size())
+			return false;
+		if (fits)
+			return result.setSmall(small, exponent, negative, precision);
+		// too long for 64 bits: collect the digits without the point
+		string digits;
+		for (size_t j = first; j < last; j++)
+			if (text[j] != '.')
+				digits.push_back(text[j]);
+		Limbs limbs;
+		digitsToLimbs(digits.data(), digits.data() + digits.size(), limbs);
+		return result.setMagnitude(limbs, exponent, negative, precision,
+			false);
+	}
+	//-------------------------------------------------------------------------
+	//		method:			fromLongDouble(long double d, unsigned precision,
+	//							CRPNDecimal& result)
+	//		description:	converts d to LDBL_DIG significant digits, or
+	//						precision if that is fewer
+	//		calls:			snprintf()
+	//						parse()
+	//		called by:		power()
+	//		parameters:		long double d -- the value
+	//						unsigned precision -- significant digits kept
+	//						CRPNDecimal& result -- receives the value
+	//		returns:		bool -- false if d is not finite
+	//		History Log:
+	//					10/17/2026 HJ completed version 1.0
+	// -------------------------------------------------------------------------
+	bool CRPNDecimal::fromLongDouble(long double d, unsigned precision,
+		CRPNDecimal& result)
+	{
+		if (!isfinite(d))
+			return false;
+		char buffer[64];
+		const int length = snprintf(buffer, sizeof buffer, "%.*Le",
+			LDBL_DIG - 1, d);
+		if (length < 0 || length >= static_cast<int>(sizeof buffer))
+			return false;
+		return parse(string_view(buffer, length),
+			min(precision, static_cast<unsigned>(LDBL_DIG)), result);
+	}
+	//-------------------------------------------------------------------------
+	//		method:			add(const CRPNDecimal& a, const CRPNDecimal& b,
+	//							unsigned precision, CRPNDecimal& result)
+	//		description:	a + b rounded to precision digits; result may be
+	//						a or b
+	//		calls:			sum()
+	//		called by:		power()
+	//						CRPNTypedEngine<CRPNDecimal>
+	//		parameters:		const CRPNDecimal& a -- the first addend
+	//						const CRPNDecimal& b -- the second addend
+	//						unsigned precision -- significant digits kept
+	//						CRPNDecimal& result -- receives the sum
+	//		returns:		bool -- false if the exponent is out of range
+	//		History Log:
+	//					10/17/2026 HJ completed version 1.0
+	// -------------------------------------------------------------------------
+	bool CRPNDecimal::add(const CRPNDecimal& a, const CRPNDecimal& b,
+		unsigned precision, CRPNDecimal& result)
+	{
+		return sum(a, b, false, precision, result);
+	}
+	//-------------------------------------------------------------------------
+	//		method:			subtract(const CRPNDecimal& a,
+	//							const CRPNDecimal& b, unsigned precision,
+	//							CRPNDecimal& result)
+	//		description:	a - b rounded to precision digits; result may be
+	//						a or b
+	//		calls:			sum()
+	//		called by:		CRPNTypedEngine<CRPNDecimal>
+	//		parameters:		const CRPNDecimal& a -- the minuend
+	//						const CRPNDecimal& b -- the subtrahend
+	//						unsigned precision -- significant digits kept
+	//						CRPNDecimal& result -- receives the difference
+	//		returns:		bool -- false if the exponent is out of range
+	//		History Log:
+	//					10/17/2026 HJ completed version 1.0
+	// -------------------------------------------------------------------------
+	bool CRPNDecimal::subtract(const CRPNDecimal& a, const CRPNDecimal& b,
+		unsigned precision, CRPNDecimal& result)
+	{
+		return sum(a, b, true, precision, result);
+	}
+	//-------------------------------------------------------------------------
+	//		method:			sum(const CRPNDecimal& a, const CRPNDecimal& b,
+	//							bool flip, unsigned precision,
+	//							CRPNDecimal& result)
+	//		description:	a + b, or a - b if flip is set, rounded to
+	//						precision digits.  The
+	//						exponent of the sum is the smaller one, as in
+	//						1.5 + 2.25 = 3.75 or 1.50 + 2 = 3.50.  When one
+	//						operand lies wholly below the digits the sum
+	//						keeps, it is shrunk to a single sticky digit so
+	//						huge exponent gaps cost no more than close ones.
+	//						result may be a or b.
+	//		calls:			scale()
+	//						shiftUp()
+	//						setSmall()
+	//						setMagnitude()
+	//		called by:		add()
+	//						subtract()
+	//		parameters:		const CRPNDecimal& a -- the first operand
+	//						const CRPNDecimal& b -- the second operand
+	//						bool flip -- b is subtracted
+	//						unsigned precision -- significant digits kept
+	//						CRPNDecimal& result -- receives the sum
+	//		returns:		bool -- false if the exponent is out of range
+	//		History Log:
+	//					10/17/2026 HJ completed version 1.0
+	// -------------------------------------------------------------------------
+	bool CRPNDecimal::sum(const CRPNDecimal& a, const CRPNDecimal& b,
+		bool flip, unsigned precision, CRPNDecimal& result)
+	{
+		const bool bNegative = b.m_negative != flip;
+		if (a.m_big.empty() && b.m_big.empty())
+		{
+			const int64_t exponent = min(a.m_exponent, b.m_exponent);
+			uint64_t ca = a.m_small;
+			uint64_t cb = b.m_small;
+			if (scale(ca, a.m_exponent - exponent)
+				&& scale(cb, b.m_exponent - exponent))
+			{
+				if (a.m_negative == bNegative)
+				{
+					if (ca <= UINT64_MAX - cb)
+						return result.setSmall(ca + cb, exponent,
+							a.m_negative, precision);
+				}
+				else if (ca >= cb)
+					return result.setSmall(ca - cb, exponent,
+						ca == cb ? false : a.m_negative, precision);
+				else
+					return result.setSmall(cb - ca, exponent, bNegative,
+						precision);
+			}
+		}
+
+		const bool aHigh = a.m_exponent >= b.m_exponent;
+		const CRPNDecimal& high = aHigh ? a : b;
+		const CRPNDecimal& low = aHigh ? b : a;
+		const bool highNegative = aHigh ? a.m_negative : bNegative;
+		const bool lowNegative = aHigh ? bNegative : a.m_negative;
+		Limbs highLimbs;
+		Limbs lowLimbs;
+		high.magnitude(highLimbs);
+		low.magnitude(lowLimbs);
+		int64_t highExponent = high.m_exponent;
+		int64_t lowExponent = low.m_exponent;
+		const int64_t guard = static_cast<int64_t>(precision) + 2;
+		const int64_t highAdjusted = highExponent
+			+ static_cast<int64_t>(digitCount(highLimbs)) - 1;
+		const int64_t lowAdjusted = lowExponent
+			+ static_cast<int64_t>(digitCount(lowLimbs)) - 1;
+		if (!high.isZero() && lowAdjusted < highAdjusted - guard)
+		{
+			// give high guard + 1 digits, then put low just below them
+			const int64_t digits = static_cast<int64_t>(digitCount(highLimbs));
+			if (digits < guard + 1)
+			{
+				shiftUp(highLimbs, static_cast<size_t>(guard + 1 - digits));
+				highExponent -= guard + 1 - digits;
+			}
+			lowExponent = highExponent - 1;
+			if (!lowLimbs.empty())
+				fromU64(1, lowLimbs);
+		}
+		shiftUp(highLimbs, static_cast<size_t>(highExponent - lowExponent));
+		if (highNegative == lowNegative)
+		{
+			addTo(highLimbs, lowLimbs);
+			return result.setMagnitude(highLimbs, lowExponent, highNegative,
+				precision, false);
+		}
+		const int order = compare(highLimbs, lowLimbs);
+		if (order >= 0)
+		{
+			subtractFrom(highLimbs, lowLimbs);
+			return result.setMagnitude(highLimbs, lowExponent,
+				order == 0 ? false : highNegative, precision, false);
+		}
+		subtractFrom(lowLimbs, highLimbs);
+		return result.setMagnitude(lowLimbs, lowExponent, lowNegative,
+			precision, false);
+	}
+	//-------------------------------------------------------------------------
+	//		method:			multiply(const CRPNDecimal& a,
+	//							const CRPNDecimal& b, unsigned precision,
+	//							CRPNDecimal& result)
+	//		description:	a x b rounded to precision digits; result may be
+	//						a or b
+	//		calls:			multiply64()
+	//						multiplyLimbs()
+	//						setSmall()
+	//						setMagnitude()
+	//		called by:		power()
+	//						CRPNTypedEngine<CRPNDecimal>
+	//		parameters:		const CRPNDecimal& a -- the multiplicand
+	//						const CRPNDecimal& b -- the multiplier
+	//						unsigned precision -- significant digits kept
+	//						CRPNDecimal& result -- receives the product
+	//		returns:		bool -- false if the exponent is out of range
+	//		History Log:
+	//					10/17/2026 HJ completed version 1.0
+	// -------------------------------------------------------------------------
+	bool CRPNDecimal::multiply(const CRPNDecimal& a, const CRPNDecimal& b,
+		unsigned precision, CRPNDecimal& result)
+	{
+		const int64_t exponent = static_cast<int64_t>(a.m_exponent)
+			+ b.m_exponent;
+		const bool negative = a.m_negative != b.m_negative;
+		if (a.m_big.empty() && b.m_big.empty())
+		{
+			uint64_t high = 0;
+			const uint64_t low = multiply64(a.m_small, b.m_small, high);
+			if (high == 0)
+				return result.setSmall(low, exponent, negative, precision);
+		}
+		Limbs aLimbs;
+		Limbs bLimbs;
+		Limbs product;
+		a.magnitude(aLimbs);
+		b.magnitude(bLimbs);
+		multiplyLimbs(aLimbs, bLimbs, product);
+		return result.setMagnitude(product, exponent, negative, precision,
+			false);
+	}
+	//-------------------------------------------------------------------------
+	//		method:			divide(const CRPNDecimal& a, const CRPNDecimal& b,
+	//							unsigned precision, CRPNDecimal& result)
+	//		description:	a / b rounded to precision digits.  An exact
+	//						quotient keeps no more trailing zeros than the
+	//						difference of the exponents asks for, so
+	//						1 / 4 = 0.25 and 1.00 / 4 = 0.25.  result may
+	//						be a or b.
+	//		calls:			scale()
+	//						divideLimbs()
+	//						setSmall()
+	//						setMagnitude()
+	//		called by:		power()
+	//						CRPNTypedEngine<CRPNDecimal>
+	//		parameters:		const CRPNDecimal& a -- the dividend
+	//						const CRPNDecimal& b -- the divisor
+	//						unsigned precision -- significant digits kept
+	//						CRPNDecimal& result -- receives the quotient
+	//		returns:		bool -- false if b is zero or the exponent is out
+	//						of range
+	//		History Log:
+	//					10/17/2026 HJ completed version 1.0
+	// -------------------------------------------------------------------------
+	bool CRPNDecimal::divide(const CRPNDecimal& a, const CRPNDecimal& b,
+		unsigned precision, CRPNDecimal& result)
+	{
+		if (b.isZero())
+			return false;
+		const int64_t ideal = static_cast<int64_t>(a.m_exponent)
+			- b.m_exponent;
+		const bool negative = a.m_negative != b.m_negative;
+		if (a.isZero())
+			return result.setSmall(0, ideal, negative, precision);
+		if (a.m_big.empty() && b.m_big.empty())
+		{
+			// the fewest extra digits that make the quotient exact, if any
+			uint64_t ca = a.m_small;
+			const uint64_t cb = b.m_small;
+			for (int64_t k = 0; ; k++)
+			{
+				if (ca % cb == 0)
+					return result.setSmall(ca / cb, ideal - k, negative,
+						precision);
+				if (!scale(ca, 1))
+					break;
+			}
+		}
+
+		Limbs numerator;
+		Limbs denominator;
+		a.magnitude(numerator);
+		b.magnitude(denominator);
+		const int64_t extra = static_cast<int64_t>(precision) + 1
+			+ static_cast<int64_t>(digitCount(denominator))
+			- static_cast<int64_t>(digitCount(numerator));
+		const size_t shift = extra > 0 ? static_cast<size_t>(extra) : 0;
+		shiftUp(numerator, shift);
+		Limbs quotient;
+		Limbs remainder;
+		divideLimbs(numerator, denominator, quotient, remainder);
+		int64_t exponent = ideal - static_cast<int64_t>(shift);
+		if (remainder.empty())
+			// exact: drop the zeros the shift added
+			while (exponent < ideal && !quotient.empty() && quotient[0] % 10 == 0)
+			{
+				divideSmall(quotient, 10);
+				exponent++;
+			}
+		else
+		{
+			// one guard digit, plus the sticky remainder
+			shiftUp(quotient, 1);
+			exponent--;
+			quotient[0] += 1;
+		}
+		return result.setMagnitude(quotient, exponent, negative, precision,
+			false);
+	}
+	//-------------------------------------------------------------------------
+	//		method:			mod(const CRPNDecimal& a, const CRPNDecimal& b,
+	//							unsigned precision, CRPNDecimal& result)
+	//		description:	the remainder of a / b with the quotient
+	//						truncated, as fmod() gives: it has the sign of
+	//						a and the smaller exponent, and is exact.
+	//						Fails if the integer quotient has more than
+	//						precision digits, where the remainder would
+	//						mean nothing.  result may be a or b.
+	//		calls:			countDigits()
+	//						scale()
+	//						divideLimbs()
+	//						digitCount()
+	//						setSmall()
+	//						setMagnitude()
+	//		called by:		CRPNTypedEngine<CRPNDecimal>
+	//		parameters:		const CRPNDecimal& a -- the dividend
+	//						const CRPNDecimal& b -- the divisor
+	//						unsigned precision -- significant digits kept
+	//						CRPNDecimal& result -- receives the remainder
+	//		returns:		bool -- false if b is zero or the quotient is too
+	//						long
+	//		History Log:
+	//					10/17/2026 HJ completed version 1.0
+	// -------------------------------------------------------------------------
+	bool CRPNDecimal::mod(const CRPNDecimal& a, const CRPNDecimal& b,
+		unsigned precision, CRPNDecimal& result)
+	{
+		if (b.isZero())
+			return false;
+		const int64_t aAdjusted = a.m_exponent
+			+ static_cast<int64_t>(a.digits()) - 1;
+		const int64_t bAdjusted = b.m_exponent
+			+ static_cast<int64_t>(b.digits()) - 1;
+		const int64_t exponent = min(a.m_exponent, b.m_exponent);
+		if (a.isZero())
+			return result.setSmall(0, exponent, a.m_negative, precision);
+		// |a| < |b|: the remainder is a, at the smaller exponent
+		if (aAdjusted < bAdjusted && a.m_exponent <= b.m_exponent)
+		{
+			if (&result != &a)
+				result = a;
+			return true;
+		}
+		if (aAdjusted - bAdjusted > static_cast<int64_t>(precision))
+			return false;
+		if (a.m_big.empty() && b.m_big.empty())
+		{
+			uint64_t ca = a.m_small;
+			uint64_t cb = b.m_small;
+			if (scale(ca, a.m_exponent - exponent)
+				&& scale(cb, b.m_exponent - exponent))
+			{
+				if (countDigits(ca / cb) > precision)
+					return false;
+				return result.setSmall(ca % cb, exponent, a.m_negative,
+					precision);
+			}
+		}
+		Limbs numerator;
+		Limbs denominator;
+		a.magnitude(numerator);
+		b.magnitude(denominator);
+		shiftUp(numerator, static_cast<size_t>(a.m_exponent - exponent));
+		shiftUp(denominator, static_cast<size_t>(b.m_exponent - exponent));
+		Limbs quotient;
+		Limbs remainder;
+		divideLimbs(numerator, denominator, quotient, remainder);
+		trim(quotient);
+		if (digitCount(quotient) > precision)
+			return false;
+		return result.setMagnitude(remainder, exponent, a.m_negative,
+			precision, false);
+	}
+	//-------------------------------------------------------------------------
+	//		method:			power(const CRPNDecimal& a, const CRPNDecimal& b,
+	//							unsigned precision, CRPNDecimal& result)
+	//		description:	a to the power b.  An integer power up to
+	//						MAXEXPONENT is computed by squaring with nine
+	//						guard digits, so exact powers stay exact; a
+	//						negative one is 1 over the positive power.
+	//						Other powers go through powl().  result may be
+	//						a or b.
+	//		calls:			multiply()
+	//						divide()
+	//						round()
+	//						toLongDouble()
+	//						fromLongDouble()
+	//		called by:		CRPNTypedEngine<CRPNDecimal>
+	//		parameters:		const CRPNDecimal& a -- the base
+	//						const CRPNDecimal& b -- the exponent
+	//						unsigned precision -- significant digits kept
+	//						CRPNDecimal& result -- receives the power
+	//		returns:		bool -- false for 0^0, 0 to a negative power, a
+	//						negative base to a fractional power, or an
+	//						exponent out of range
+	//		History Log:
+	//					10/17/2026 HJ completed version 1.0
+	// -------------------------------------------------------------------------
+	bool CRPNDecimal::power(const CRPNDecimal& a, const CRPNDecimal& b,
+		unsigned precision, CRPNDecimal& result)
+	{
+		if (a.isZero() && b.isZero())
+			return false;
+		// b as an integer, if it is one and is small enough
+		bool integer = false;
+		uint64_t n = 0;
+		if (b.m_big.empty())
+		{
+			n = b.m_small;
+			if (b.m_exponent >= 0)
+				integer = scale(n, b.m_exponent);
+			else if (-static_cast<int64_t>(b.m_exponent) <= MAXPOWER)
+			{
+				const uint64_t divisor = powersOfTen[-b.m_exponent];
+				integer = n % divisor == 0;
+				n /= divisor;
+			}
+			else
+				integer = n == 0;
+			integer = integer && n <= static_cast<uint64_t>(MAXEXPONENT);
+		}
+		if (!integer)
+		{
+			if (a.m_negative && !a.isZero())
+				return false;
+			return fromLongDouble(powl(a.toLongDouble(), b.toLongDouble()),
+				precision, result);
+		}
+		if (b.m_negative && a.isZero())
+			return false;
+
+		const unsigned working = precision + 9;
+		CRPNDecimal base(a);
+		CRPNDecimal product;
+		product.m_small = 1;
+		for (uint64_t bits = n; bits != 0; bits >>= 1)
+		{
+			if ((bits & 1) != 0 && !multiply(product, base, working, product))
+				return false;
+			if (bits > 1 && !multiply(base, base, working, base))
+				return false;
+		}
+		if (b.m_negative)
+		{
+			CRPNDecimal one;
+			one.m_small = 1;
+			return divide(one, product, precision, result);
+		}
+		if (!product.round(precision))
+			return false;
+		result = move(product);
+		return true;
+	}
+	//-------------------------------------------------------------------------
+	//		method:			round(unsigned precision)
+	//		description:	rounds the value in place to precision digits
+	//		calls:			setSmall()
+	//						setMagnitude()
+	//		called by:		power()
+	//		parameters:		unsigned precision -- significant digits kept
+	//		returns:		bool -- false if the exponent is out of range
+	//		History Log:
+	//					10/17/2026 HJ completed version 1.0
+	// -------------------------------------------------------------------------
+	bool CRPNDecimal::round(unsigned precision)
+	{
+		if (m_big.empty())
+			return setSmall(m_small, m_exponent, m_negative, precision);
+		Limbs limbs;
+		limbs.swap(m_big);
+		return setMagnitude(limbs, m_exponent, m_negative, precision, false);
+	}
+	//-------------------------------------------------------------------------
+	//		method:			magnitude(vector<uint32_t>& limbs) const
+	//		description:	copies the coefficient into limbs
+	//		calls:			fromU64()
+	//		called by:		add()
+	//						multiply()
+	//						divide()
+	//						mod()
+	//		parameters:		vector<uint32_t>& limbs -- receives it
+	//		returns:		n/a
+	//		History Log:
+	//					10/17/2026 HJ completed version 1.0
+	// -------------------------------------------------------------------------
+	void CRPNDecimal::magnitude(vector<uint32_t>& limbs) const
+	{
+		if (m_big.empty())
+			fromU64(m_small, limbs);
+		else
+			limbs = m_big;
+	}
+	//-------------------------------------------------------------------------
+	//		method:			setMagnitude(vector<uint32_t>& limbs,
+	//							int64_t exponent, bool negative,
+	//							unsigned precision, bool sticky)
+	//		description:	stores a coefficient given in limbs, rounded to
+	//						precision digits, inline if it then fits in 64
+	//						bits.  limbs is consumed.
+	//		calls:			roundOff()
+	//						toU64()
+	//		called by:		parse()
+	//						add()
+	//						multiply()
+	//						divide()
+	//						mod()
+	//		parameters:		vector<uint32_t>& limbs -- the coefficient
+	//						int64_t exponent -- its power of ten
+	//						bool negative -- the sign
+	//						unsigned precision -- significant digits kept
+	//						bool sticky -- non-zero digits were dropped
+	//						below limbs
+	//		returns:		bool -- false if the exponent is out of range
+	//		History Log:
+	//					10/17/2026 HJ completed version 1.0
+	// -------------------------------------------------------------------------
+	bool CRPNDecimal::setMagnitude(vector<uint32_t>& limbs, int64_t exponent,
+		bool negative, unsigned precision, bool sticky)
+	{
+		trim(limbs);
+		size_t digits = digitCount(limbs);
+		if (digits > precision)
+		{
+			roundOff(limbs, digits - precision, sticky);
+			exponent += digits - precision;
+			// rounding 99..9 up adds a digit
+			if (digitCount(limbs) > precision)
+			{
+				divideSmall(limbs, 10);
+				exponent++;
+			}
+		}
+		if (exponent > MAXEXPONENT || exponent < -MAXEXPONENT)
+			return false;
+		m_exponent = static_cast<int32_t>(exponent);
+		m_negative = negative;
+		uint64_t small = 0;
+		if (toU64(limbs, small))
+		{
+			m_small = small;
+			m_big.clear();
+		}
+		else
+		{
+			m_small = 0;
+			m_big.swap(limbs);
+		}
+		return true;
+	}
+	//-------------------------------------------------------------------------
+	//		method:			setSmall(uint64_t coefficient, int64_t exponent,
+	//							bool negative, unsigned precision)
+	//		description:	stores a 64-bit coefficient, rounded to precision
+	//						digits half to even
+	//		calls:			countDigits()
+	//		called by:		parse()
+	//						add()
+	//						multiply()
+	//						divide()
+	//						mod()
+	//		parameters:		uint64_t coefficient -- the coefficient
+	//						int64_t exponent -- its power of ten
+	//						bool negative -- the sign
+	//						unsigned precision -- significant digits kept
+	//		returns:		bool -- false if the exponent is out of range
+	//		History Log:
+	//					10/17/2026 HJ completed version 1.0
+	// -------------------------------------------------------------------------
+	bool CRPNDecimal::setSmall(uint64_t coefficient, int64_t exponent,
+		bool negative, unsigned precision)
+	{
+		const unsigned digits = countDigits(coefficient);
+		if (digits > precision)
+		{
+			const unsigned drop = digits - precision;
+			const uint64_t divisor = powersOfTen[drop];
+			const uint64_t remainder = coefficient % divisor;
+			const uint64_t half = divisor / 2;
+			coefficient /= divisor;
+			if (remainder > half
+				|| (remainder == half && (coefficient & 1) != 0))
+				coefficient++;
+			exponent += drop;
+			if (countDigits(coefficient) > precision)
+			{
+				coefficient /= 10;
+				exponent++;
+			}
+		}
+		if (exponent > MAXEXPONENT || exponent < -MAXEXPONENT)
+			return false;
+		m_small = coefficient;
+		m_big.clear();
+		m_exponent = static_cast<int32_t>(exponent);
+		m_negative = negative;
+		return true;
+	}
+}
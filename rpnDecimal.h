@@ -0,0 +1,160 @@
+//----------------------------------------------------------------------------
+//    File:		rpnDecimal.h
+//
+//    Class:	CRPNDecimal
+//----------------------------------------------------------------------------
+#ifndef RPNDECIMAL_H
+#define RPNDECIMAL_H
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+//----------------------------------------------------------------------------
+//
+//    Title:		RPNDecimal Class
+//
+//    Description:	This file contains the class definition for CRPNDecimal,
+//					an arbitrary-precision decimal floating-point number:
+//					a sign, an integer coefficient and a power of ten.
+//					Literals such as 0.1 are held exactly, and +, -, * and
+//					% are exact until a result has more significant digits
+//					than the precision asked for, when it is rounded half
+//					to even.  Division rounds the same way.
+//
+//					A coefficient that fits in 64 bits is held inline, and
+//					operations on such values use 64- and 128-bit integer
+//					arithmetic only.  A longer coefficient is held in base
+//					10^9 limbs on the heap, so only values that outgrow 64
+//					bits allocate.
+//
+//					Unlike double there is no infinity or NaN: an operation
+//					that would need one (a divide by zero, 0 to a negative
+//					power, an exponent out of range) fails instead.
+//					Integer powers are computed exactly before rounding;
+//					other powers go through long double, so they carry at
+//					most LDBL_DIG digits.
+//
+//    Programmer:	Han Jung
+//
+//    Date:			10/17/2026
+//
+//    Version:		1.0
+//
+//    Environment:
+//       Hardware: Intel Xeon PC
+//       Software: Windows 10
+//       Compiles under Microsoft Visual C++ 2017 (/std:c++17)
+//
+//	  class CRPNDecimal:
+//
+//	  Properties:
+//		uint64_t m_small -- the coefficient, while m_big is empty
+//		vector<uint32_t> m_big -- the coefficient in base 10^9, least
+//			significant limb first, once it does not fit in 64 bits
+//		int32_t m_exponent -- the value is coefficient x 10^m_exponent
+//		bool m_negative -- the sign, kept for zero as well
+//
+//	  Methods:
+//
+//		inline:
+//			CRPNDecimal();
+//			bool negative() const;
+//			bool inlined() const;
+//			int32_t exponent() const;
+//			void negate();
+//
+//		non-inline:
+//		public:
+//			bool isZero() const;
+//			size_t digits() const;
+//			void format(string& text) const;
+//			long double toLongDouble() const;
+//			static bool parse(string_view text, unsigned precision,
+//				CRPNDecimal& result);
+//			static bool fromLongDouble(long double d, unsigned precision,
+//				CRPNDecimal& result);
+//			static bool add(const CRPNDecimal& a, const CRPNDecimal& b,
+//				unsigned precision, CRPNDecimal& result);
+//			static bool subtract(const CRPNDecimal& a, const CRPNDecimal& b,
+//				unsigned precision, CRPNDecimal& result);
+//			static bool multiply(const CRPNDecimal& a, const CRPNDecimal& b,
+//				unsigned precision, CRPNDecimal& result);
+//			static bool divide(const CRPNDecimal& a, const CRPNDecimal& b,
+//				unsigned precision, CRPNDecimal& result);
+//			static bool mod(const CRPNDecimal& a, const CRPNDecimal& b,
+//				unsigned precision, CRPNDecimal& result);
+//			static bool power(const CRPNDecimal& a, const CRPNDecimal& b,
+//				unsigned precision, CRPNDecimal& result);
+//		private:
+//			static bool sum(const CRPNDecimal& a, const CRPNDecimal& b,
+//				bool flip, unsigned precision, CRPNDecimal& result);
+//			bool round(unsigned precision);
+//			void magnitude(vector<uint32_t>& limbs) const;
+//			bool setMagnitude(vector<uint32_t>& limbs, int64_t exponent,
+//				bool negative, unsigned precision, bool sticky);
+//			bool setSmall(uint64_t coefficient, int64_t exponent,
+//				bool negative, unsigned precision);
+//
+//    History Log:
+//			10/17/2026	HJ  arbitrary-precision decimal numbers, version 1.0
+// ----------------------------------------------------------------------------
+
+using namespace std;
+
+namespace PB_CALC
+{
+	const unsigned DEFAULTPRECISION = 34;	// digits, as IEEE decimal128
+	const unsigned MAXPRECISION = 100000;
+	const int32_t MAXEXPONENT = 999999999;	// largest |exponent| kept
+
+	class CRPNDecimal
+	{
+	public:
+		CRPNDecimal() : m_small(0), m_exponent(0), m_negative(false) {}
+		bool isZero() const;
+		size_t digits() const;
+		void format(string& text) const;
+		long double toLongDouble() const;
+		static bool parse(string_view text, unsigned precision,
+			CRPNDecimal& result);
+		static bool fromLongDouble(long double d, unsigned precision,
+			CRPNDecimal& result);
+		static bool add(const CRPNDecimal& a, const CRPNDecimal& b,
+			unsigned precision, CRPNDecimal& result);
+		static bool subtract(const CRPNDecimal& a, const CRPNDecimal& b,
+			unsigned precision, CRPNDecimal& result);
+		static bool multiply(const CRPNDecimal& a, const CRPNDecimal& b,
+			unsigned precision, CRPNDecimal& result);
+		static bool divide(const CRPNDecimal& a, const CRPNDecimal& b,
+			unsigned precision, CRPNDecimal& result);
+		static bool mod(const CRPNDecimal& a, const CRPNDecimal& b,
+			unsigned precision, CRPNDecimal& result);
+		static bool power(const CRPNDecimal& a, const CRPNDecimal& b,
+			unsigned precision, CRPNDecimal& result);
+
+		bool negative() const { return m_negative; }
+		// the coefficient is held inline, without a heap allocation
+		bool inlined() const { return m_big.empty(); }
+		int32_t exponent() const { return m_exponent; }
+		void negate() { m_negative = !m_negative; }
+
+	private:
+		static bool sum(const CRPNDecimal& a, const CRPNDecimal& b, bool flip,
+			unsigned precision, CRPNDecimal& result);
+		bool round(unsigned precision);
+		void magnitude(vector<uint32_t>& limbs) const;
+		bool setMagnitude(vector<uint32_t>& limbs, int64_t exponent,
+			bool negative, unsigned precision, bool sticky);
+		bool setSmall(uint64_t coefficient, int64_t exponent, bool negative,
+			unsigned precision);
+
+		uint64_t m_small;
+		vector<uint32_t> m_big;
+		int32_t m_exponent;
+		bool m_negative;
+	};
+}
+
+#endif
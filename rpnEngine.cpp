@@ -0,0 +1,1835 @@
+#include "rpnEngine.h"
+#include <cctype>
+#include <cfloat>
+#include <charconv>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+//-------------------------------------------------------------------------------------------
+//    Class:		CRPNEngine
+//
+//    File:			rpnEngine.cpp
+//
+//    Description:	This file contains the function definitions for
+//					CRPNEngine, the evaluation half of the calculator.  The
+//					engine owns no streams and writes no global state, so
+//					any number of engines can run at once, one per thread.
+//					The one global it reads, the operator table, is frozen
+//					when the first engine is constructed.
+//
+//    Programmer:	Han Jung
+//					Cheuk Chi Chow
+//					Huy Ngyuen
+//   
+//    Date:			10/17/2026
+// 
+//    Version:		2.0
+//  
+//    Environment:	Intel Xeon PC 
+//                  Software:   MS Windows 10 for execution; 
+//                  Compiles under Microsoft Visual C++ 2017 (/std:c++17)
+// 
+//	  class:		CRPNEngine
+//
+//	  Properties:
+//				double m_registers[MAXREGS];
+//				CRPNRegisterNames m_registerNames;
+//				CRPNStack m_stack;
+//				unique_ptr<CRPNMappedFile> m_programFile;
+//				CRPNArena m_programText;
+//				vector<string_view> m_program;
+//				CRPNProgram m_compiled;
+//				CRPNProgram m_optimized;
+//				unique_ptr<CRPNJit> m_jit;
+//				unsigned m_hotRuns;
+//				bool m_jitEnabled;
+//				CRPNResultCache m_cache;
+//				vector<double> m_cacheKey;
+//				vector<double> m_cacheResult;
+//				bool m_cacheable;
+//				CRPNLibrary m_library;
+//				bool m_error;
+//				bool m_programChanged;
+//				bool m_programMapped;
+//				int m_runDepth;
+//				vector<size_t> m_calls;
+//				uint64_t m_jumpLimit;
+//				uint64_t m_jumps;
+//				bool m_jumpsPerLine;
+//				CRPNStats m_stats;	(RPNCALC_STATS)
+//
+//	  Non-inline Methods:
+//				CRPNEngine();
+//				virtual ~CRPNEngine();
+//				EvalResult evaluate(string_view line, double& top);
+//				void setProgram(const list<string>& program);
+//				void setProgramText(string_view text);
+//				void compileProgram();
+//				bool loadProgramFile(const string& filename);
+//				bool saveProgramFile(const string& filename);
+//				bool saveProgramBinary(const string& filename);
+//				bool defineProgram(string_view name, string_view text);
+//				bool loadLibrary(const string& filename);
+//				void copyLibrary(const CRPNEngine& source);
+//				double registerValue(int reg) const;
+//				void setRegister(int reg, double d);
+//				void push(double d);
+//				void reset();
+//
+//				protected:
+//					void parse(string_view line);
+//					virtual void loadProgram();
+//					virtual void recordProgram();
+//					virtual void saveToFile();
+//					virtual void toggleHelp();
+//					virtual void turnOff();
+//
+//				private:
+//					void add();
+//					void binary_prep(double& d1, double& d2);
+//					void clearEntry();
+//					void clearAll();
+//					void divide();
+//					void constantOp(OpCode op, double d1);
+//					size_t branch(const SInstruction& instruction,
+//						size_t next, size_t calls);
+//					void customOp(const SOperator& entry);
+//					void execute(const CRPNProgram& program,
+//						const CRPNProgram& source, size_t first,
+//						size_t calls);
+//					void exp();
+//					void getReg(int reg);
+//					void mod();
+//					void multiply();
+//					void neg();
+//					void ownProgramText();
+//					int registerSlot(const SToken& token);
+//					void rotateUp(int count);
+//					void rotateDown(int count);
+//					bool runJit();
+//					void runLibraryProgram(int slot);
+//					void runProgram();
+//					void saveState(vector<double>& state) const;
+//					void setReg(int reg);
+//					bool step(const SInstruction& instruction,
+//						const double* constants);
+//					void subtract();
+//					void unary_prep(double& d);
+//
+//	  related functions:
+//				size_t formatNumber(double d, char* buffer, size_t size);
+//
+//    History Log:
+//				6/3/2017	HJ Initial setups (as CRPNCalc)
+//				6/11/2017	HJ completed version 1.1
+//				10/17/2026	HJ tokenizer, compiled programs and CRPNStack
+//				10/17/2026	HJ split from CRPNCalc, version 2.0
+//				10/17/2026	HJ branches, loops and calls, version 2.1
+//				10/17/2026	HJ library programs, version 2.2
+//				10/17/2026	HJ binary program files, version 2.3
+//				10/17/2026	HJ freezes the operator table, version 2.4
+//				10/17/2026	HJ copyLibrary(), version 2.5
+//				10/17/2026	HJ jump limit per line, version 2.6
+// ----------------------------------------------------------------------------	
+namespace PB_CALC
+{
+	//-------------------------------------------------------------------------
+	//		method:			CRPNEngine()
+	//		description:	constructor; an empty stack and zeroed registers.
+	//						Freezes the operator table, so no operator is
+	//						added while an engine reads it.
+	//		calls:			CRPNOperators::freeze()
+	//		called by:		CRPNCalc()
+	//						embedding code
+	//		parameters:		n/a
+	//		returns:		n/a
+	//		History Log:
+	//					10/17/2026 HJ completed version 1.0
+	//					10/17/2026 HJ call stack and jump limit, version 1.1
+	//					10/17/2026 HJ freezes the operator table, version 1.2
+	//					10/17/2026 HJ jump limit per line, version 1.3
+	// -------------------------------------------------------------------------
+	CRPNEngine::CRPNEngine() : m_hotRuns(0), m_jitEnabled(true),
+		m_cacheable(true), m_error(false), m_programChanged(false),
+		m_programMapped(false), m_runDepth(0),
+		m_jumpLimit(MAXJUMPS), m_jumps(0), m_jumpsPerLine(false)
+	{
+		CRPNOperators::freeze();
+		m_calls.reserve(MAXCALLDEPTH);
+		for (int i = 0; i < MAXREGS; i++)
+			m_registers[i] = 0.0;
+	}
+	//-------------------------------------------------------------------------
+	//		method:			~CRPNEngine()
+	//		description:	destructor
+	//		calls:			n/a
+	//		called by:		n/a
+	//		parameters:		n/a
+	//		returns:		n/a
+	//		History Log:
+	//					10/17/2026 HJ completed version 1.0
+	// -------------------------------------------------------------------------
+	CRPNEngine::~CRPNEngine()
+	{
+	}
+	//-------------------------------------------------------------------------
+	//		method:			parse(string_view line)
+	//		description:	parses the commands in line using a
+	//						CRPNTokenizer, which keeps a cursor into the line
+	//						instead of erasing consumed characters
+	//		calls:			CRPNTokenizer::next()
+	//						registerSlot()
+	//						add()
+	//						clearEntry()
+	//						clearAll()
+	//						divide()
+	//						exp()
+	//						getReg()
+	//						loadProgram()
+	//						mod()
+	//						multiply()
+	//						neg()
+	//						recordProgram()
+	//						rotateDown()
+	//						rotateUp()
+	//						runLibraryProgram()
+	//						runProgram()
+	//						saveToFile()
+	//						setReg()
+	//						subtract()
+	//						toggleHelp()
+	//						turnOff()
+	//						CRPNLibrary::find()
+	//
+	//		called by:		evaluate()
+	//						CRPNCalc::input()
+	//						CRPNCalc::runBatch()
+	//		parameters:		string_view line -- the commands to parse
+	//		returns:		n/a
+	//		History Log:
+	//					6/10/2017 HN completed version 1.0
+	//					10/17/2026 HJ single-pass tokenizer, version 1.1
+	//					10/17/2026 HJ named registers, version 1.2
+	//					10/17/2026 HJ U:k and D:k, version 1.3
+	//					10/17/2026 HJ operator table, version 1.4
+	//					10/17/2026 HJ labels and branches, version 1.5
+	//					10/17/2026 HJ R:name, version 1.6
+	// -------------------------------------------------------------------------
+	void CRPNEngine::parse(string_view line)
+	{
+		RPN_STAT(CRPNStatTimer timer(m_stats.parseLatency()));
+		CRPNTokenizer tokenizer(line);
+		SToken token;
+		while (tokenizer.next(token))
+		{
+			switch (token.type)
+			{
+			case TOK_NUMBER:
+				RPN_STAT(m_stats.count(STAT_PUSH));
+				m_stack.push(token.value);
+				break;
+			case TOK_NEGZERO:
+				RPN_STAT(m_stats.count(STAT_PUSH));
+				m_stack.push(token.value);
+				neg();
+				break;
+			case TOK_CLEARALL:
+				RPN_STAT(m_stats.count(STAT_CLEAR));
+				clearAll();
+				break;
+			case TOK_SETREG:
+				setReg(registerSlot(token));
+				break;
+			case TOK_GETREG:
+				getReg(registerSlot(token));
+				break;
+			case TOK_ROTATE:
+				if (token.op == 'U')
+					rotateUp(token.reg);
+				else
+					rotateDown(token.reg);
+				break;
+			case TOK_RUNPROGRAM:
+				// unlike R, the rest of the line still runs
+				runLibraryProgram(m_library.find(token.text));
+				break;
+			case TOK_LABEL:
+			case TOK_BRANCH:
+				//labels and branches are for programs only
+				RPN_STAT(m_stats.error(STATERR_BADTOKEN));
+				m_error = true;
+				break;
+			case TOK_OPERATOR:
+			{
+				const SOperator& entry = CRPNOperators::find(token.op);
+				switch (entry.op)
+				{
+				case OP_ADD: add(); break;
+				case OP_SUBTRACT: subtract(); break;
+				case OP_MULTIPLY: multiply(); break;
+				case OP_DIVIDE: divide(); break;
+				case OP_EXP: exp(); break;
+				case OP_MOD: mod(); break;
+				case OP_CLEARENTRY: clearEntry(); break;
+				case OP_ROTATEDOWN: rotateDown(entry.arg); break;
+				case OP_SAVE: saveToFile(); break;
+				case OP_HELP: toggleHelp(); break;
+				case OP_LOAD: loadProgram(); break;
+				case OP_NEG: neg(); break;
+				case OP_RECORD: recordProgram(); break;
+				case OP_RUN:
+					//the application only do this method and ignore other methods
+					//if they are inputed at the same line
+					runProgram();
+					return;
+				case OP_ROTATEUP: rotateUp(entry.arg); break;
+				case OP_EXIT: turnOff(); break;
+				case OP_CUSTOM: customOp(entry); break;
+				default:
+					RPN_STAT(m_stats.error(STATERR_BADTOKEN));
+					m_error = true;
+					break;
+				}
+				break;
+			}
+			}
+		}
+	}
+	//-------------------------------------------------------------------------
+	//		method:			add()
+	//		description:	if possible, pops top 2 elements from the stack,
+	//						adds them and pushes the result onto the stack
+	//		calls:			binary_prep()
+	//		called by:		parse()
+	//		parameters:		n/a
+	//		returns:		n/a
+	//		History Log:
+	//					6/10/2017 HN completed version 1.1
+	//					6/8/2017  HJ completed version 1.0
+	// -------------------------------------------------------------------------
+	void CRPNEngine::add()
+	{
+		RPN_STAT(m_stats.count(STAT_ADD));
+		double d1 = 0.0;
+		double d2 = 0.0;
+		binary_prep(d1, d2);
+		if (m_error)
+			return;
+		m_stack.push(d1 + d2);
+	}
+	//-------------------------------------------------------------------------
+	//		method:			binary_prep()
+	//		description:	Check if operation requiring two number from stack
+	//						is possible and save the popped value to argument's
+	//						address if it is possible
+	//		calls:			n/a
+	//		called by:		add()
+	//						subtract()
+	//						multiply()
+	//						divide()
+	//						exp()
+	//						mod()			
+	//						
+	//		parameters:		double& d1 -- address of operand 1
+	//						double& d2 -- address of operand 2
+	//		returns:		n/a
+	//		History Log:
+	//					6/10/2017 HN completed version 1.0
+	// -------------------------------------------------------------------------
+	void CRPNEngine::binary_prep(double& d1, double& d2)
+	{
+
+		if (m_stack.size() >= 2)
+		{
+			d1 = m_stack.top();
+			m_stack.pop();
+			d2 = m_stack.top();
+			m_stack.pop();
+		}
+		else
+		{
+			RPN_STAT(m_stats.error(STATERR_UNDERFLOW));
+			m_error = true;
+		}
+	}
+	//-------------------------------------------------------------------------
+	//		method:			clearEntry()
+	//		description:	Clear the last entered number
+	//		calls:			n/a
+	//		called by:		parse()	
+	//						
+	//		parameters:		n/a
+	//		returns:		n/a
+	//		History Log:
+	//					6/10/2017 HJ completed version 1.0
+	// -------------------------------------------------------------------------
+	void CRPNEngine::clearEntry()
+	{
+		RPN_STAT(m_stats.count(STAT_CLEAR));
+		if (!m_stack.empty())
+			m_stack.pop();
+	}
+	//-------------------------------------------------------------------------
+	//		method:			clearAll()
+	//		description:	Clear all the values stored in the stack
+	//		calls:			n/a
+	//		called by:		parse()	
+	//						
+	//		parameters:		n/a
+	//		returns:		n/a
+	//		History Log:
+	//					6/10/2017 HJ completed version 1.0
+	// -------------------------------------------------------------------------
+	void CRPNEngine::clearAll()
+	{
+		m_stack.clear();
+	}
+	//-------------------------------------------------------------------------
+	//		method:			divide()
+	//		description:	if possible, pops top 2 elements from the stack, 
+	//						divides them and pushes the result onto the stack
+	//		calls:			binary_prep()
+	//		called by:		parse()
+	//		parameters:		n/a
+	//		returns:		n/a
+	//		History Log:
+	//					6/10/2017 HN completed version 1.1
+	//					6/8/2017  HJ completed version 1.0
+	// -------------------------------------------------------------------------
+	void CRPNEngine::divide()
+	{
+		RPN_STAT(m_stats.count(STAT_DIVIDE));
+		double d1 = 0.0;
+		double d2 = 0.0;
+		binary_prep(d1, d2);
+		if (m_error)
+			return;
+		if (d2 == 0)
+		{
+			//do nothing, push the numbers back
+			RPN_STAT(m_stats.error(STATERR_DIVIDEBYZERO));
+			m_error = true;
+			m_stack.push(d1);
+			m_stack.push(d2);
+		}
+		else
+			m_stack.push(d1 / d2);
+	}
+	//-------------------------------------------------------------------------
+	//		method:			execute(const CRPNProgram& program,
+	//							const CRPNProgram& source, size_t first,
+	//							size_t calls)
+	//		description:	runs a compiled program from instruction first.
+	//						An instruction that replaces m_program (P, L, or
+	//						an R or R:name whose run did) ends the run, since
+	//						for the main program the code being executed is
+	//						no longer the recorded program.
+	//						An optimized program only matches its source
+	//						while there is no error, so at its first error
+	//						the run continues in source, and so do the calls
+	//						it is in.  Branches are taken here, without
+	//						leaving the loop.
+	//		calls:			step()
+	//						branch()
+	//		called by:		runProgram()
+	//						runLibraryProgram()
+	//		parameters:		const CRPNProgram& program -- the code to run
+	//						const CRPNProgram& source -- the compiled code
+	//						program was optimized from, or program itself
+	//						size_t first -- the instruction to start at
+	//						size_t calls -- entries of m_calls that belong
+	//						to the runs this one is nested in
+	//		returns:		n/a
+	//		History Log:
+	//					10/17/2026 HJ completed version 1.0
+	//					10/17/2026 HJ optimized programs, version 1.1
+	//					10/17/2026 HJ branches, loops and calls, version 1.2
+	//					10/17/2026 HJ the source is a parameter, version 1.3
+	//					10/17/2026 HJ code viewed in place, version 1.4
+	// -------------------------------------------------------------------------
+	void CRPNEngine::execute(const CRPNProgram& program,
+		const CRPNProgram& source, size_t first, size_t calls)
+	{
+		const SInstruction* const code = program.code();
+		const size_t size = program.size();
+		const double* const constants = program.constants();
+		const size_t* const resume = program.resume();
+		size_t i = first;
+		while (i < size)
+		{
+			const SInstruction& instruction = code[i];
+			size_t next = i + 1;
+			if (instruction.op >= OP_JUMP && instruction.op <= OP_RETURN)
+				next = branch(instruction, next, calls);
+			else if (!step(instruction, constants))
+				break;
+			if (resume != nullptr && m_error && next != ENDRUN)
+			{
+				// a call returns just past itself, and the source
+				// program's call is where the resume table says
+				for (size_t c = calls; c < m_calls.size(); c++)
+					m_calls[c] = resume[m_calls[c] - 1];
+				execute(source, source, resume[i], calls);
+				return;
+			}
+			i = next;
+		}
+		m_calls.resize(calls);
+	}
+	//-------------------------------------------------------------------------
+	//		method:			branch(const SInstruction& instruction,
+	//							size_t next, size_t calls)
+	//		description:	runs one branch, loop, call or return.  A
+	//						compare-and-branch takes its operands as a
+	//						binary op does, and does not branch once an
+	//						error is set.  A loop counts its register down
+	//						and goes back while it is still above 0.  Every
+	//						jump taken, other than a return, counts against
+	//						the run's jump limit.
+	//		calls:			binary_prep()
+	//		called by:		execute()
+	//		parameters:		const SInstruction& instruction -- the
+	//						instruction
+	//						size_t next -- the instruction after it
+	//						size_t calls -- entries of m_calls that belong
+	//						to other runs
+	//		returns:		size_t -- the instruction to run next, or
+	//						ENDRUN if the run is over
+	//		History Log:
+	//					10/17/2026 HJ completed version 1.0
+	// -------------------------------------------------------------------------
+	inline size_t CRPNEngine::branch(const SInstruction& instruction,
+		size_t next, size_t calls)
+	{
+		RPN_STAT(m_stats.count(STAT_BRANCH));
+		switch (instruction.op)
+		{
+		case OP_BRANCHLESS:
+		case OP_BRANCHGREATER:
+		case OP_BRANCHEQUAL:
+		case OP_BRANCHNOTEQUAL:
+		{
+			double d1 = 0.0;
+			double d2 = 0.0;
+			binary_prep(d1, d2);
+			if (m_error)
+				return next;
+			const bool taken = (instruction.op == OP_BRANCHLESS) ? d1 < d2
+				: (instruction.op == OP_BRANCHGREATER) ? d1 > d2
+				: (instruction.op == OP_BRANCHEQUAL) ? d1 == d2 : d1 != d2;
+			if (!taken)
+				return next;
+			break;
+		}
+		case OP_LOOP:
+			if (!(--m_registers[instruction.reg] > 0))
+				return next;
+			break;
+		case OP_CALL:
+			if (m_calls.size() >= MAXCALLDEPTH)
+			{
+				RPN_STAT(m_stats.error(STATERR_CALLDEPTH));
+				m_error = true;
+				return next;
+			}
+			m_calls.push_back(next);
+			break;
+		case OP_RETURN:
+		{
+			if (m_calls.size() == calls)
+				return ENDRUN;
+			const size_t back = m_calls.back();
+			m_calls.pop_back();
+			return back;
+		}
+		default:
+			break;
+		}
+		if (m_jumps == 0)
+		{
+			RPN_STAT(m_stats.error(STATERR_JUMPLIMIT));
+			m_error = true;
+			return ENDRUN;
+		}
+		m_jumps--;
+		return static_cast<size_t>(instruction.arg);
+	}
+	//-------------------------------------------------------------------------
+	//		method:			step(const SInstruction& instruction,
+	//							const double* constants)
+	//		description:	runs one compiled instruction
+	//		calls:			add()
+	//						clearEntry()
+	//						clearAll()
+	//						constantOp()
+	//						divide()
+	//						exp()
+	//						getReg()
+	//						loadProgram()
+	//						mod()
+	//						multiply()
+	//						neg()
+	//						recordProgram()
+	//						rotateDown()
+	//						rotateUp()
+	//						runLibraryProgram()
+	//						runProgram()
+	//						saveToFile()
+	//						setReg()
+	//						subtract()
+	//						toggleHelp()
+	//						turnOff()
+	//		called by:		execute()
+	//		parameters:		const SInstruction& instruction -- the
+	//						instruction
+	//						const double* constants -- its program's pool
+	//		returns:		bool -- false if it replaced m_program
+	//		History Log:
+	//					10/17/2026 HJ completed version 1.0 (from execute)
+	//					10/17/2026 HJ rotations take their count, version 1.1
+	//					10/17/2026 HJ custom operators, version 1.2
+	//					10/17/2026 HJ library programs, version 1.3
+	// -------------------------------------------------------------------------
+	inline bool CRPNEngine::step(const SInstruction& instruction,
+		const double* constants)
+	{
+		switch (instruction.op)
+		{
+		case OP_PUSH:
+			RPN_STAT(m_stats.count(STAT_PUSH));
+			m_stack.push(constants[instruction.arg]);
+			break;
+		case OP_NEGZERO:
+			RPN_STAT(m_stats.count(STAT_PUSH));
+			m_stack.push(constants[instruction.arg]);
+			neg();
+			break;
+		case OP_ADD: add(); break;
+		case OP_SUBTRACT: subtract(); break;
+		case OP_MULTIPLY: multiply(); break;
+		case OP_DIVIDE: divide(); break;
+		case OP_EXP: exp(); break;
+		case OP_MOD: mod(); break;
+		case OP_NEG: neg(); break;
+		case OP_CLEARENTRY: clearEntry(); break;
+		case OP_CLEARALL:
+			RPN_STAT(m_stats.count(STAT_CLEAR));
+			clearAll();
+			break;
+		case OP_ROTATEDOWN: rotateDown(instruction.arg); break;
+		case OP_ROTATEUP: rotateUp(instruction.arg); break;
+		case OP_SETREG: setReg(instruction.arg); break;
+		case OP_GETREG: getReg(instruction.arg); break;
+		case OP_SAVE: saveToFile(); break;
+		case OP_HELP: toggleHelp(); break;
+		case OP_EXIT: turnOff(); break;
+		case OP_CUSTOM: customOp(CRPNOperators::custom(instruction.arg)); break;
+		case OP_JUMP:
+		case OP_BRANCHLESS:
+		case OP_BRANCHGREATER:
+		case OP_BRANCHEQUAL:
+		case OP_BRANCHNOTEQUAL:
+		case OP_LOOP:
+		case OP_CALL:
+		case OP_RETURN:
+			// taken by execute()
+			break;
+		case OP_ERROR:
+			RPN_STAT(m_stats.error(STATERR_BADTOKEN));
+			m_error = true;
+			break;
+		case OP_LOAD:
+		case OP_RECORD:
+		case OP_RUN:
+		case OP_RUNPROGRAM:
+			if (instruction.op == OP_LOAD)
+				loadProgram();
+			else if (instruction.op == OP_RECORD)
+				recordProgram();
+			else if (instruction.op == OP_RUN)
+				runProgram();
+			else
+				runLibraryProgram(instruction.arg);
+			return !m_programChanged;
+		case OP_ADDCONST:
+		case OP_SUBTRACTCONST:
+		case OP_MULTIPLYCONST:
+		case OP_DIVIDECONST:
+		case OP_EXPCONST:
+		case OP_MODCONST:
+			constantOp(static_cast<OpCode>(OP_ADD
+				+ (instruction.op - OP_ADDCONST)), constants[instruction.arg]);
+			break;
+		}
+		return true;
+	}
+	//-------------------------------------------------------------------------
+	//		method:			constantOp(OpCode op, double d1)
+	//		description:	a push of d1 followed by a binary op, in one
+	//						step.  Only runs without an error set, and
+	//						leaves the stack as the two steps would,
+	//						including on failure.
+	//		calls:			CRPNProgram::fold()
+	//		called by:		step()
+	//		parameters:		OpCode op -- OP_ADD through OP_MOD
+	//						double d1 -- the pushed value, the top operand
+	//		returns:		n/a
+	//		History Log:
+	//					10/17/2026 HJ completed version 1.0
+	// -------------------------------------------------------------------------
+	void CRPNEngine::constantOp(OpCode op, double d1)
+	{
+		RPN_STAT(m_stats.countInstruction(static_cast<OpCode>(OP_ADDCONST
+			+ (op - OP_ADD))));
+		if (m_stack.empty())
+		{
+			RPN_STAT(m_stats.error(STATERR_UNDERFLOW));
+			m_stack.push(d1);
+			m_error = true;
+			return;
+		}
+		double d2 = m_stack.top();
+		m_stack.pop();
+		double result = 0.0;
+		if (CRPNProgram::fold(op, d1, d2, result))
+			m_stack.push(result);
+		else
+		{
+			//do nothing, push the numbers back
+			RPN_STAT(m_stats.error(op == OP_EXP ? STATERR_ZEROPOWER
+				: STATERR_DIVIDEBYZERO));
+			m_error = true;
+			m_stack.push(d1);
+			m_stack.push(d2);
+		}
+	}
+	//-------------------------------------------------------------------------
+	//		method:			customOp(const SOperator& entry)
+	//		description:	runs a custom operator: pops its operands as
+	//						binary_prep() or unary_prep() does and pushes
+	//						the kernel's result.  If the kernel fails the
+	//						operands are pushed back, as divide() does.
+	//		calls:			binary_prep()
+	//						unary_prep()
+	//						the operator's kernel
+	//		called by:		parse()
+	//						step()
+	//		parameters:		const SOperator& entry -- the operator
+	//		returns:		n/a
+	//		History Log:
+	//					10/17/2026 HJ completed version 1.0
+	// -------------------------------------------------------------------------
+	void CRPNEngine::customOp(const SOperator& entry)
+	{
+		RPN_STAT(m_stats.count(STAT_CUSTOM));
+		double d1 = 0.0;
+		double d2 = 0.0;
+		if (entry.arity == 2)
+			binary_prep(d1, d2);
+		else
+			unary_prep(d1);
+		if (m_error)
+			return;
+		double result = 0.0;
+		if (entry.kernel(d1, d2, result))
+			m_stack.push(result);
+		else
+		{
+			//do nothing, push the numbers back
+			RPN_STAT(m_stats.error(STATERR_OPERATOR));
+			m_error = true;
+			m_stack.push(d1);
+			if (entry.arity == 2)
+				m_stack.push(d2);
+		}
+	}
+	//-------------------------------------------------------------------------
+	//		method:			exp()
+	//		description:	if possible, pops top 2 elements from the stack, 
+	//						and exponentiate top value by the next value and 
+	//						pushes result back to the top
+	//		calls:			binary_prep()
+	//		called by:		parse()
+	//		parameters:		n/a
+	//		returns:		n/a
+	//		History Log:
+	//					6/10/2017 HN completed version 1.1
+	//					6/8/2017  CC completed version 1.0
+	// -------------------------------------------------------------------------
+	void CRPNEngine::exp()
+	{
+		RPN_STAT(m_stats.count(STAT_EXP));
+		double d1 = 0.0;
+		double d2 = 0.0;
+		binary_prep(d1, d2);
+		if (m_error)
+			return;
+		if (d1 == 0 && d2 == 0)
+		{
+			//do nothing, push the numbers back
+			RPN_STAT(m_stats.error(STATERR_ZEROPOWER));
+			m_error = true;
+			m_stack.push(d1);
+			m_stack.push(d2);
+		}
+		else
+			m_stack.push(pow(d1, d2));
+	}
+	//-------------------------------------------------------------------------
+	//		method:			getReg()
+	//		description:	pushes the given register's value onto the stack
+	//		calls:			n/a
+	//		called by:		parse()
+	//		parameters:		int reg -- the register slot, -1 for a name
+	//						that has none
+	//		returns:		n/a
+	//		History Log:
+	//					6/10/2017 HN completed version 1.0
+	//					10/17/2026 HJ named registers, version 1.1
+	// -------------------------------------------------------------------------
+	void CRPNEngine::getReg(int reg)
+	{
+		RPN_STAT(m_stats.count(STAT_GETREG));
+		if (reg >= 0 && reg < MAXREGS)
+			m_stack.push(m_registers[reg]);
+		else
+		{
+			RPN_STAT(m_stats.error(STATERR_BADTOKEN));
+			m_error = true;
+		}
+	}
+	//-------------------------------------------------------------------------
+	//		method:			mod()
+	//		description:	if possible, pops top 2 elements from the stack, 
+	//						and mod top value by the next value and pushes
+	//						result back to the top
+	//		calls:			binary_prep()
+	//		called by:		parse()
+	//		parameters:		n/a
+	//		returns:		n/a
+	//		History Log:
+	//					6/10/2017 HN completed version 1.1
+	//					6/8/2017  HJ completed version 1.0
+	// -------------------------------------------------------------------------
+	void CRPNEngine::mod()
+	{
+		RPN_STAT(m_stats.count(STAT_MOD));
+		double d1 = 0.0;
+		double d2 = 0.0;
+		binary_prep(d1, d2);
+		if (m_error)
+			return;
+		if (d2 == 0)
+		{
+			//do nothing, push the numbers back
+			RPN_STAT(m_stats.error(STATERR_DIVIDEBYZERO));
+			m_error = true;
+			m_stack.push(d1);
+			m_stack.push(d2);
+		}
+		else
+			m_stack.push(fmod(d1, d2));
+	}
+	//-------------------------------------------------------------------------
+	//		method:			multiply()
+	//		description:	if possible, pops top 2 elements from the stack, 
+	//						and multiply top value by the next value and pushes
+	//						result back to the top
+	//		calls:			binary_prep()
+	//		called by:		parse()
+	//		parameters:		n/a
+	//		returns:		n/a
+	//		History Log:
+	//					6/10/2017 HN completed version 1.1
+	//					6/8/2017  CC completed version 1.0
+	// -------------------------------------------------------------------------
+	void CRPNEngine::multiply()
+	{
+		RPN_STAT(m_stats.count(STAT_MULTIPLY));
+		double d1 = 0.0;
+		double d2 = 0.0;
+		binary_prep(d1, d2);
+		if (m_error)
+			return;
+		m_stack.push(d1 * d2);
+	}
+	//-------------------------------------------------------------------------
+	//		method:			neg()
+	//		description:	if possible, pops the first value then multiply it
+	//						by negative 1 and pushes the returned value back
+	//		calls:			binary_prep()
+	//		called by:		parse()
+	//		parameters:		n/a
+	//		returns:		n/a
+	//		History Log:
+	//					6/10/2017 HN completed version 1.1
+	//					6/8/2017  HJ completed version 1.0
+	// -------------------------------------------------------------------------
+	void CRPNEngine::neg()
+	{
+		RPN_STAT(m_stats.count(STAT_NEG));
+		double d = 0;
+		unary_prep(d);
+		if (m_error)
+			return;
+		d *= -1.0;
+		m_stack.push(d);
+	}
+	//-------------------------------------------------------------------------
+	//		method:			ownProgramText()
+	//		description:	copies a mapped program into m_programText and
+	//						unmaps the file, leaving the lines unchanged.
+	//						Code that ran from a program file is dropped,
+	//						to be compiled from the lines.  Must not be
+	//						called while that code is running.
+	//		calls:			CRPNArena::reset()
+	//						CRPNArena::allocate()
+	//						splitLines()
+	//						CRPNProgram::clear()
+	//		called by:		saveProgramFile()
+	//						saveProgramBinary()
+	//		parameters:		n/a
+	//		returns:		n/a
+	//		History Log:
+	//					10/17/2026 HJ completed version 1.0
+	//					10/17/2026 HJ program files, version 1.1
+	//-------------------------------------------------------------------------
+	void CRPNEngine::ownProgramText()
+	{
+		size_t size = 0;
+		for (string_view line : m_program)
+			size += line.size() + 1;
+		m_programText.reset();
+		char* text = static_cast<char*>(m_programText.allocate(size, 1));
+		char* next = text;
+		for (string_view line : m_program)
+		{
+			memcpy(next, line.data(), line.size());
+			next += line.size();
+			*next++ = '\n';
+		}
+		splitLines(string_view(text, size), m_program);
+		if (m_programMapped)
+		{
+			m_compiled.clear();
+			m_optimized.clear();
+			m_programMapped = false;
+			m_programChanged = true;
+		}
+		m_programFile.reset();
+	}
+	//-------------------------------------------------------------------------
+	//		method:			unary_prep(double& d)
+	//		description:	if possible, pops the first value of the stack then
+	//						assign it to the address of the argument.
+	//		calls:			n/a
+	//		called by:		neg()
+	//		parameters:		double& d --address of the variable assigning to
+	//		returns:		n/a
+	//		History Log:
+	//					6/10/2017 HN completed version 1.1
+	//					6/8/2017  HJ completed version 1.0
+	// -------------------------------------------------------------------------
+	void CRPNEngine::unary_prep(double& d)
+	{
+		if (!m_stack.empty())
+		{
+			d = m_stack.top();
+			m_stack.pop();
+		}
+		else
+		{
+			RPN_STAT(m_stats.error(STATERR_UNDERFLOW));
+			m_error = true;
+		}
+	}
+	//-------------------------------------------------------------------------
+	//		method:			registerSlot(const SToken& token)
+	//		description:	the slot of a TOK_SETREG or TOK_GETREG token: its
+	//						register, or the named register's slot
+	//		calls:			CRPNRegisterNames::slot()
+	//		called by:		parse()
+	//		parameters:		const SToken& token -- the token
+	//		returns:		int -- the slot, or -1 if the name cannot have
+	//						one
+	//		History Log:
+	//					10/17/2026 HJ completed version 1.0
+	// -------------------------------------------------------------------------
+	int CRPNEngine::registerSlot(const SToken& token)
+	{
+		if (token.reg >= 0)
+			return token.reg;
+		return m_registerNames.slot(token.text);
+	}
+	//-------------------------------------------------------------------------
+	//		method:			rotateDown(int count)
+	//		description:	moves the bottom count values of the stack to
+	//						the top, keeping their order; count wraps at the
+	//						depth, so D:k undoes U:k
+	//		calls:			CRPNStack::rotateDown()
+	//		called by:		parse()
+	//						step()
+	//		parameters:		int count -- values to move, -1 if the count
+	//						was too large
+	//		returns:		n/a
+	//		History Log:
+	//					6/8/2017 HJ completed version 1.0
+	//					10/17/2026 HJ moves the bottom instead of copying
+	//						it over the top; rotates by count, version 1.1
+	//-------------------------------------------------------------------------
+	void CRPNEngine::rotateDown(int count)
+	{
+		RPN_STAT(m_stats.count(STAT_ROTATEDOWN));
+		if (!m_stack.empty() && count >= 0)
+		{
+			const size_t k = static_cast<size_t>(count);
+			m_stack.rotateDown(k < m_stack.size() ? k : k % m_stack.size());
+		}
+		else
+		{
+			RPN_STAT(m_stats.error(m_stack.empty() ? STATERR_UNDERFLOW
+				: STATERR_BADTOKEN));
+			m_error = true;
+		}
+	}
+	//-------------------------------------------------------------------------
+	//		method:			rotateUp(int count)
+	//		description:	moves the top count values of the stack to the
+	//						bottom, keeping their order; count wraps at the
+	//						depth
+	//		calls:			CRPNStack::rotateUp()
+	//		called by:		parse()
+	//						step()
+	//		parameters:		int count -- values to move, -1 if the count
+	//						was too large
+	//		returns:		n/a
+	//		History Log:
+	//					6/8/2017 HJ completed version 1.0
+	//					10/17/2026 HJ rotates by count, version 1.1
+	//-------------------------------------------------------------------------
+	void CRPNEngine::rotateUp(int count)
+	{
+		RPN_STAT(m_stats.count(STAT_ROTATEUP));
+		if (!m_stack.empty() && count >= 0)
+		{
+			const size_t k = static_cast<size_t>(count);
+			m_stack.rotateUp(k < m_stack.size() ? k : k % m_stack.size());
+		}
+		else
+		{
+			RPN_STAT(m_stats.error(m_stack.empty() ? STATERR_UNDERFLOW
+				: STATERR_BADTOKEN));
+			m_error = true;
+		}
+	}
+	//-------------------------------------------------------------------------
+	//		method:			runJit()
+	//		description:	runs the program as native code.  A program is
+	//						compiled once it has run JITTHRESHOLD times;
+	//						until then, and for programs or hosts CRPNJit
+	//						does not support, this returns false at once.
+	//						The code works on a copy of the registers and
+	//						of the stack values it reads, and they are
+	//						only written back if it finishes, so a run that
+	//						would fail changes nothing and the interpreter
+	//						runs it again with the exact error semantics.
+	//		calls:			CRPNJit::compile()
+	//						CRPNJit::run()
+	//		called by:		runProgram()
+	//		parameters:		n/a
+	//		returns:		bool -- true if the program was run
+	//		History Log:
+	//					10/17/2026 HJ completed version 1.0
+	//					10/17/2026 HJ copy the registers in use, version 1.1
+	// -------------------------------------------------------------------------
+	bool CRPNEngine::runJit()
+	{
+		if (!m_jitEnabled || m_error)
+			return false;
+		if (m_hotRuns < JITTHRESHOLD)
+		{
+			if (++m_hotRuns < JITTHRESHOLD)
+				return false;
+			if (!m_jit)
+				m_jit.reset(new CRPNJit);
+			m_jit->compile(m_optimized);
+		}
+		if (!m_jit || !m_jit->ready() || m_stack.size() < m_jit->inputs())
+			return false;
+
+		double* frame = m_jit->frame();
+		const size_t inputs = m_jit->inputs();
+		for (size_t i = 0; i < inputs; i++)
+			frame[inputs - 1 - i] = m_stack.at(i);
+		// only the slots in use; the rest are 0.0 and the code cannot
+		// address them
+		double registers[MAXREGS];
+		const size_t bytes = m_registerNames.registerCount() * sizeof(double);
+		memcpy(registers, m_registers, bytes);
+		if (!m_jit->run(registers))
+			return false;
+
+		RPN_STAT(for (size_t i = 0; i < m_optimized.size(); i++)
+			m_stats.countInstruction(m_optimized.code()[i].op));
+		memcpy(m_registers, registers, bytes);
+		if (m_jit->clearsStack())
+			m_stack.clear();
+		else
+			for (size_t i = 0; i < inputs; i++)
+				m_stack.pop();
+		for (size_t i = 0; i < m_jit->outputs(); i++)
+			m_stack.push(frame[i]);
+		return true;
+	}
+	//-------------------------------------------------------------------------
+	//		method:			runLibraryProgram(int slot)
+	//		description:	runs a library program.  Its code was compiled
+	//						when it was defined, so nothing is parsed here,
+	//						and it is never cached or compiled to native
+	//						code.  It nests with R, and shares the run
+	//						depth and jump limit of the run it is in.
+	//		calls:			execute()
+	//		called by:		parse()
+	//						step()
+	//		parameters:		int slot -- the program's slot, or -1 for a
+	//						name that has none
+	//		returns:		n/a
+	//		History Log:
+	//					10/17/2026 HJ completed version 1.0
+	//					10/17/2026 HJ jump limit per line, version 1.1
+	//-------------------------------------------------------------------------
+	void CRPNEngine::runLibraryProgram(int slot)
+	{
+		if (slot < 0 || !m_library.program(slot).defined)
+		{
+			RPN_STAT(m_stats.error(STATERR_NOPROGRAM));
+			m_error = true;
+			return;
+		}
+		if (m_runDepth >= MAXRUNDEPTH)
+		{
+			RPN_STAT(m_stats.error(STATERR_RUNDEPTH));
+			m_error = true;
+			return;
+		}
+		RPN_STAT(CRPNStatTimer timer(m_stats.runLatency()));
+		const SLibraryProgram& program = m_library.program(slot);
+		if (m_runDepth == 0 && !m_jumpsPerLine)
+			m_jumps = m_jumpLimit;
+		m_runDepth++;
+		// the optimized code assumes no error is set on entry
+		execute(m_error ? program.compiled : program.optimized,
+			program.compiled, 0, m_calls.size());
+		m_runDepth--;
+	}
+	//-------------------------------------------------------------------------
+	//		method:			runProgram()
+	//		description:	runs the program in m_program.  The program is
+	//						compiled the first time it is run after it was
+	//						recorded or loaded, and the compiled code is
+	//						reused until it changes again.  A program that
+	//						keeps running itself stops with an error after
+	//						MAXRUNDEPTH nested runs.  The jump limit is
+	//						for a run and the runs nested in it, or, set
+	//						per line, for all the runs of an evaluate().
+	//						With the result cache on, a run that is not
+	//						nested in another starts by looking up the
+	//						registers, stack and error flag; if this
+	//						program has run from that state before, the
+	//						state it ended in is restored instead.
+	//		calls:			compileProgram()
+	//						saveState()
+	//						CRPNResultCache::hashKey()
+	//						CRPNResultCache::find()
+	//						CRPNResultCache::insert()
+	//						runJit()
+	//						execute()
+	//		called by:		parse()
+	//						step()
+	//		parameters:		n/a
+	//		returns:		n/a
+	//		History Log:
+	//					6/8/2017 HN completed version 1.0
+	//					10/17/2026 HJ run compiled code, version 1.1
+	//					10/17/2026 HJ run optimized code, version 1.2
+	//					10/17/2026 HJ run native code, version 1.3
+	//					10/17/2026 HJ result cache, version 1.4
+	//					10/17/2026 HJ named registers, version 1.5
+	//					10/17/2026 HJ jump limit, version 1.6
+	//					10/17/2026 HJ jump limit per line, version 1.7
+	//-------------------------------------------------------------------------
+	void CRPNEngine::runProgram()
+	{
+		if (m_runDepth >= MAXRUNDEPTH)
+		{
+			RPN_STAT(m_stats.error(STATERR_RUNDEPTH));
+			m_error = true;
+			return;
+		}
+		RPN_STAT(CRPNStatTimer timer(m_stats.runLatency()));
+		compileProgram();
+		const bool cached = m_runDepth == 0 && m_cacheable
+			&& m_cache.enabled();
+		const bool error = m_error;
+		uint64_t hash = 0;
+		if (cached)
+		{
+			saveState(m_cacheKey);
+			hash = CRPNResultCache::hashKey(m_cacheKey, error);
+			if (m_cache.find(hash, m_cacheKey, error, m_cacheResult, m_error))
+			{
+				const int count = m_registerNames.registerCount();
+				memcpy(m_registers, m_cacheResult.data(),
+					count * sizeof(double));
+				m_stack.assign(m_cacheResult.data() + count,
+					m_cacheResult.data() + m_cacheResult.size());
+				return;
+			}
+		}
+		if (m_runDepth == 0 && !m_jumpsPerLine)
+			m_jumps = m_jumpLimit;
+		m_runDepth++;
+		// the optimized code assumes no error is set on entry
+		if (!runJit())
+			execute(m_error ? m_compiled : m_optimized, m_compiled, 0,
+				m_calls.size());
+		m_runDepth--;
+		if (cached)
+		{
+			saveState(m_cacheResult);
+			m_cache.insert(hash, m_cacheKey, error, m_cacheResult, m_error);
+		}
+	}
+	//-------------------------------------------------------------------------
+	//		method:			saveState(vector<double>& state) const
+	//		description:	copies the registers in use, then the stack from
+	//						the bottom up, into state; the layout of a
+	//						result cache key or result
+	//		calls:			n/a
+	//		called by:		runProgram()
+	//		parameters:		vector<double>& state -- receives the values
+	//		returns:		n/a
+	//		History Log:
+	//					10/17/2026 HJ completed version 1.0
+	//					10/17/2026 HJ named registers, version 1.1
+	//					10/17/2026 HJ ring buffer stack, version 1.2
+	//-------------------------------------------------------------------------
+	void CRPNEngine::saveState(vector<double>& state) const
+	{
+		state.assign(m_registers,
+			m_registers + m_registerNames.registerCount());
+		m_stack.copyTo(state);
+	}
+	//-------------------------------------------------------------------------
+	//		method:			setReg()
+	//		description:	if the index of register is within limits of 0 
+	//						and MAXREGS take the top of the stack and asign
+	//						it to given index
+	//		calls:			n/a
+	//		called by:		parse()
+	//		parameters:		int reg --index of the register, -1 for a name
+	//						that has none
+	//		returns:		n/a
+	//		History Log:
+	//					6/8/2017 HN completed version 1.0
+	//					10/17/2026 HJ named registers, version 1.1
+	//-------------------------------------------------------------------------
+	void CRPNEngine::setReg(int reg)
+	{
+		RPN_STAT(m_stats.count(STAT_SETREG));
+		if (reg >= 0 && reg < MAXREGS && !m_stack.empty())
+			m_registers[reg] = m_stack.top();
+		else
+		{
+			RPN_STAT(m_stats.error(m_stack.empty() ? STATERR_UNDERFLOW
+				: STATERR_BADTOKEN));
+			m_error = true;
+		}
+	}
+	//-------------------------------------------------------------------------
+	//		method:			subtract()
+	//		description:	Take two values from the stack, subtract them 
+	//						then push it back to the register
+	//		calls:			n/a
+	//		called by:		parse()
+	//		parameters:		n/a
+	//		returns:		n/a
+	//		History Log:
+	//					6/11/2016 HJ completed version 1.1
+	//					6/8/2017 HN completed version 1.0
+	//-------------------------------------------------------------------------
+	void CRPNEngine::subtract()
+	{
+		RPN_STAT(m_stats.count(STAT_SUBTRACT));
+		double d1 = 0.0;
+		double d2 = 0.0;
+		binary_prep(d1, d2);
+		if (m_error)
+			return;
+		m_stack.push(d1 - d2);
+	}
+	//-------------------------------------------------------------------------
+	//		method:			evaluate(string_view line, double& top)
+	//		description:	embedding entry point: parses line as if it had
+	//						been typed in and reports the result without
+	//						writing anything.  Clears the error flag.  With
+	//						the jump limit per line, the line's runs share
+	//						one budget of jumps.
+	//		calls:			parse()
+	//		called by:		embedding code
+	//		parameters:		string_view line -- the commands to run
+	//						double& top -- receives the top of the stack
+	//						when the result is EVAL_OK
+	//		returns:		EvalResult -- EVAL_OK, EVAL_EMPTY if the stack is
+	//						empty, or EVAL_ERROR
+	//		History Log:
+	//					10/17/2026 HJ completed version 1.0
+	//					10/17/2026 HJ jump limit per line, version 1.1
+	//-------------------------------------------------------------------------
+	EvalResult CRPNEngine::evaluate(string_view line, double& top)
+	{
+		if (m_jumpsPerLine)
+			m_jumps = m_jumpLimit;
+		parse(line);
+		if (m_error)
+		{
+			m_error = false;
+			return EVAL_ERROR;
+		}
+		if (m_stack.empty())
+			return EVAL_EMPTY;
+		top = m_stack.top();
+		return EVAL_OK;
+	}
+	//-------------------------------------------------------------------------
+	//		method:			compileProgram()
+	//		description:	compiles m_program and its optimized form if it
+	//						changed since the last time; native code and
+	//						cached results for the old program are dropped.
+	//						Programs that use shell commands (L, P, F, H,
+	//						X) are never cached, since those can change the
+	//						program or depend on more than the engine state;
+	//						nor are programs that run library programs,
+	//						which may be redefined.  An R:name gives the
+	//						name a library slot if it has none.  A program
+	//						loaded from a program file is already compiled.
+	//		calls:			CRPNProgram::compile()
+	//						CRPNProgram::optimize()
+	//						CRPNJit::clear()
+	//						CRPNResultCache::clear()
+	//		called by:		runProgram()
+	//						embedding code
+	//		parameters:		n/a
+	//		returns:		n/a
+	//		History Log:
+	//					10/17/2026 HJ completed version 1.0
+	//					10/17/2026 HJ library programs, version 1.1
+	//					10/17/2026 HJ program files, version 1.2
+	//-------------------------------------------------------------------------
+	void CRPNEngine::compileProgram()
+	{
+		if (!m_programChanged)
+			return;
+		if (!m_programMapped)
+		{
+			m_compiled.compile(m_program, m_registerNames, &m_library);
+			m_optimized.optimize(m_compiled);
+		}
+		if (m_jit)
+			m_jit->clear();
+		m_hotRuns = 0;
+		m_cache.clear();
+		m_cacheable = true;
+		for (size_t i = 0; i < m_compiled.size(); i++)
+			switch (m_compiled.code()[i].op)
+			{
+			case OP_SAVE:
+			case OP_HELP:
+			case OP_LOAD:
+			case OP_RECORD:
+			case OP_EXIT:
+			case OP_RUNPROGRAM:
+				m_cacheable = false;
+				break;
+			default:
+				break;
+			}
+		m_programChanged = false;
+	}
+	//-------------------------------------------------------------------------
+	//		method:			setProgram(const list<string>& program)
+	//		description:	replaces m_program, as recording or loading it
+	//						would.  The lines are copied into m_programText
+	//						as one block of text.
+	//		calls:			CRPNArena::reset()
+	//						CRPNArena::allocate()
+	//						splitLines()
+	//		called by:		CRPNVector::setProgram()
+	//						embedding code
+	//		parameters:		const list<string>& program -- the program lines
+	//		returns:		n/a
+	//		History Log:
+	//					10/17/2026 HJ completed version 1.0
+	//					10/17/2026 HJ keep one text buffer, version 1.1
+	//					10/17/2026 HJ text in the arena, version 1.2
+	//					10/17/2026 HJ program files, version 1.3
+	//-------------------------------------------------------------------------
+	void CRPNEngine::setProgram(const list<string>& program)
+	{
+		size_t size = 0;
+		for (const string& line : program)
+			size += line.size() + 1;
+		m_programText.reset();
+		char* text = static_cast<char*>(m_programText.allocate(size, 1));
+		char* next = text;
+		for (const string& line : program)
+		{
+			memcpy(next, line.data(), line.size());
+			next += line.size();
+			*next++ = '\n';
+		}
+		splitLines(string_view(text, size), m_program);
+		m_programFile.reset();
+		m_programChanged = true;
+		m_programMapped = false;
+	}
+	//-------------------------------------------------------------------------
+	//		method:			setProgramText(string_view text)
+	//		description:	replaces m_program with the lines of text, as
+	//						loading a file holding text would.  The text is
+	//						copied into m_programText, which is reset
+	//						first, so replacing a program with one of about
+	//						the same size does not allocate.  text must not
+	//						view the current program.
+	//		calls:			CRPNArena::reset()
+	//						CRPNArena::copy()
+	//						splitLines()
+	//		called by:		CRPNCalc::recordProgram()
+	//						embedding code
+	//		parameters:		string_view text -- lines ending in LF or CRLF
+	//		returns:		n/a
+	//		History Log:
+	//					10/17/2026 HJ completed version 1.0
+	//-------------------------------------------------------------------------
+	void CRPNEngine::setProgramText(string_view text)
+	{
+		m_programText.reset();
+		splitLines(m_programText.copy(text), m_program);
+		m_programFile.reset();
+		m_programChanged = true;
+		m_programMapped = false;
+	}
+	//-------------------------------------------------------------------------
+	//		method:			loadProgramFile(const string& filename)
+	//		description:	replaces m_program with the lines of a file.  The
+	//						file is mapped, not read: the lines are views
+	//						into the mapping, so loading costs page faults
+	//						rather than a copy and an allocation per line.
+	//						A final newline does not add an empty line.
+	//						A program file (see CRPNProgramFile) is not
+	//						compiled either: once its names have the slots
+	//						its code was compiled with, that code runs
+	//						where it lies in the mapping.  Otherwise, as on
+	//						a machine with another layout, its text is
+	//						compiled as a text file's would be.
+	//		calls:			CRPNMappedFile::open()
+	//						CRPNProgramFile::isProgramFile()
+	//						CRPNProgramFile::read()
+	//						CRPNProgramFile::bind()
+	//						CRPNProgram::map()
+	//						splitLines()
+	//		called by:		CRPNCalc::loadProgram()
+	//		parameters:		const string& filename -- the file to read
+	//		returns:		bool -- false if the file could not be opened, or
+	//						is a program file that is damaged or of another
+	//						version, in which case the program is unchanged
+	//		History Log:
+	//					6/10/2017 HN completed version 1.0 (loadProgram)
+	//					10/17/2026 HJ moved from CRPNCalc
+	//					10/17/2026 HJ map the file, version 1.1
+	//					10/17/2026 HJ program files, version 1.2
+	// -------------------------------------------------------------------------
+	bool CRPNEngine::loadProgramFile(const string& filename)
+	{
+		RPN_STAT(CRPNStatTimer timer(m_stats.fileLatency()));
+		unique_ptr<CRPNMappedFile> file(new CRPNMappedFile);
+		if (!file->open(filename))
+		{
+			RPN_STAT(m_stats.error(STATERR_FILE));
+			return false;
+		}
+		SProgramImage image;
+		const bool binary = CRPNProgramFile::isProgramFile(file->data());
+		if (binary && !CRPNProgramFile::read(file->data(), image))
+		{
+			RPN_STAT(m_stats.error(STATERR_FILE));
+			return false;
+		}
+		splitLines(binary ? image.text : file->data(), m_program);
+		m_programFile = move(file);
+		m_programText.reset();
+		m_programChanged = true;
+		m_programMapped = binary && image.native
+			&& CRPNProgramFile::bind(image.bindings, m_registerNames,
+				m_library);
+		if (m_programMapped)
+		{
+			m_compiled.map(image.compiled, image.compiledSize,
+				image.compiledConstants, image.compiledConstantCount,
+				nullptr);
+			m_optimized.map(image.optimized, image.optimizedSize,
+				image.optimizedConstants, image.optimizedConstantCount,
+				image.resume);
+		}
+		return true;
+	}
+	//-------------------------------------------------------------------------
+	//		method:			saveProgramFile(const string& filename)
+	//		description:	writes m_program to a file, one line per line.
+	//						A mapped program is copied out first, since
+	//						the file written may be the one it maps.  That
+	//						cannot be done to a program file's code while
+	//						it runs, so a program loaded from a program
+	//						file cannot save itself.
+	//		calls:			ownProgramText()
+	//		called by:		CRPNCalc::saveToFile()
+	//		parameters:		const string& filename -- the file to write
+	//		returns:		bool -- false if the file could not be opened
+	//		History Log:
+	//					6/8/2017 HN completed version 1.0 (saveToFile)
+	//					10/17/2026 HJ moved from CRPNCalc
+	//					10/17/2026 HJ write line views, version 1.1
+	//					10/17/2026 HJ program files, version 1.2
+	// -------------------------------------------------------------------------
+	bool CRPNEngine::saveProgramFile(const string& filename)
+	{
+		RPN_STAT(CRPNStatTimer timer(m_stats.fileLatency()));
+		if (m_programMapped && m_runDepth > 0)
+		{
+			RPN_STAT(m_stats.error(STATERR_FILE));
+			return false;
+		}
+		if (m_programFile)
+			ownProgramText();
+		ofstream fout;
+		fout.open(filename, ios::out | ios::trunc);
+		if (!fout.is_open())
+		{
+			RPN_STAT(m_stats.error(STATERR_FILE));
+			return false;
+		}
+		for (string_view line : m_program)
+		{
+			fout.write(line.data(), line.size());
+			fout.put('\n');
+		}
+		fout.close();
+		return true;
+	}
+	//-------------------------------------------------------------------------
+	//		method:			saveProgramBinary(const string& filename)
+	//		description:	writes m_program to a program file: its text,
+	//						and its code compiled and optimized, so that
+	//						loading it needs no parsing.  As with
+	//						saveProgramFile(), a mapped program is copied
+	//						out first.
+	//		calls:			ownProgramText()
+	//						compileProgram()
+	//						CRPNProgramFile::write()
+	//		called by:		CRPNCalc::saveToFile()
+	//						embedding code
+	//		parameters:		const string& filename -- the file to write
+	//		returns:		bool -- false if the file could not be written
+	//		History Log:
+	//					10/17/2026 HJ completed version 1.0
+	// -------------------------------------------------------------------------
+	bool CRPNEngine::saveProgramBinary(const string& filename)
+	{
+		RPN_STAT(CRPNStatTimer timer(m_stats.fileLatency()));
+		if (m_programMapped && m_runDepth > 0)
+		{
+			RPN_STAT(m_stats.error(STATERR_FILE));
+			return false;
+		}
+		if (m_programFile)
+			ownProgramText();
+		compileProgram();
+		if (!CRPNProgramFile::write(filename, m_program, m_compiled,
+			m_optimized, m_registerNames, m_library))
+		{
+			RPN_STAT(m_stats.error(STATERR_FILE));
+			return false;
+		}
+		return true;
+	}
+	//-------------------------------------------------------------------------
+	//		method:			defineProgram(string_view name, string_view text)
+	//		description:	gives a library program its code, compiled and
+	//						optimized now, so that R:name runs it without
+	//						reading or parsing anything.  Programs that
+	//						already use the name run the new code; none may
+	//						be running.
+	//		calls:			CRPNLibrary::define()
+	//		called by:		embedding code
+	//		parameters:		string_view name -- the program's name
+	//						string_view text -- its lines, ending in LF or
+	//						CRLF
+	//		returns:		bool -- false if the name is not valid or the
+	//						library has MAXPROGRAMS names
+	//		History Log:
+	//					10/17/2026 HJ completed version 1.0
+	// -------------------------------------------------------------------------
+	bool CRPNEngine::defineProgram(string_view name, string_view text)
+	{
+		return m_library.define(name, text, m_registerNames);
+	}
+	//-------------------------------------------------------------------------
+	//		method:			loadLibrary(const string& filename)
+	//		description:	defines the programs of a library file, each
+	//						after a "[name]" line.  The text is copied into
+	//						the library, so the file is only read here.
+	//		calls:			CRPNMappedFile::open()
+	//						CRPNLibrary::load()
+	//		called by:		CRPNBatch::loadLibrary()
+	//						main()
+	//		parameters:		const string& filename -- the file to read
+	//		returns:		bool -- false if the file could not be read or
+	//						is not a library, in which case no program is
+	//						defined
+	//		History Log:
+	//					10/17/2026 HJ completed version 1.0
+	// -------------------------------------------------------------------------
+	bool CRPNEngine::loadLibrary(const string& filename)
+	{
+		RPN_STAT(CRPNStatTimer timer(m_stats.fileLatency()));
+		CRPNMappedFile file;
+		if (!file.open(filename)
+			|| !m_library.load(file.data(), m_registerNames))
+		{
+			RPN_STAT(m_stats.error(STATERR_FILE));
+			return false;
+		}
+		return true;
+	}
+	//-------------------------------------------------------------------------
+	//		method:			copyLibrary(const CRPNEngine& source)
+	//		description:	gives the engine source's library programs,
+	//						already compiled, and the register names they
+	//						were compiled with; nothing is read or
+	//						compiled.  Meant for a new engine: names it
+	//						gave slots before are replaced, so a program
+	//						it has is compiled again.  Must not be called
+	//						while the engine is running.
+	//		calls:			CRPNRegisterNames::assign()
+	//						CRPNLibrary::assign()
+	//						compileProgram()
+	//		called by:		CRPNServer::acceptSessions()
+	//		parameters:		const CRPNEngine& source -- the engine to
+	//						copy from
+	//		returns:		n/a
+	//		History Log:
+	//					10/17/2026 HJ completed version 1.0
+	// -------------------------------------------------------------------------
+	void CRPNEngine::copyLibrary(const CRPNEngine& source)
+	{
+		m_registerNames.assign(source.m_registerNames);
+		m_library.assign(source.m_library);
+		if (!m_program.empty())
+		{
+			m_programChanged = true;
+			compileProgram();
+		}
+	}
+	//-------------------------------------------------------------------------
+	//		method:			registerValue(int reg)
+	//		description:	reads a register without touching the stack
+	//		calls:			n/a
+	//		called by:		embedding code
+	//		parameters:		int reg -- the register, 0 to NUMREGS - 1, or
+	//						a slot from registerNames()
+	//		returns:		double -- its value, 0.0 if reg is out of range
+	//		History Log:
+	//					10/17/2026 HJ completed version 1.0
+	//					10/17/2026 HJ named registers, version 1.1
+	// -------------------------------------------------------------------------
+	double CRPNEngine::registerValue(int reg) const
+	{
+		if (reg >= 0 && reg < m_registerNames.registerCount())
+			return m_registers[reg];
+		return 0.0;
+	}
+	//-------------------------------------------------------------------------
+	//		method:			setRegister(int reg, double d)
+	//		description:	writes a register without touching the stack
+	//		calls:			n/a
+	//		called by:		CRPNVector::run()
+	//						embedding code
+	//		parameters:		int reg -- the register, 0 to NUMREGS - 1, or
+	//						a slot from registerNames(); ignored if out of
+	//						range
+	//						double d -- the value
+	//		returns:		n/a
+	//		History Log:
+	//					10/17/2026 HJ completed version 1.0
+	//					10/17/2026 HJ named registers, version 1.1
+	// -------------------------------------------------------------------------
+	void CRPNEngine::setRegister(int reg, double d)
+	{
+		if (reg >= 0 && reg < m_registerNames.registerCount())
+			m_registers[reg] = d;
+	}
+	//-------------------------------------------------------------------------
+	//		method:			push(double d)
+	//		description:	pushes a value, as entering the number would
+	//		calls:			n/a
+	//		called by:		CRPNVector::run()
+	//						embedding code
+	//		parameters:		double d -- the value
+	//		returns:		n/a
+	//		History Log:
+	//					10/17/2026 HJ completed version 1.0
+	// -------------------------------------------------------------------------
+	void CRPNEngine::push(double d)
+	{
+		m_stack.push(d);
+	}
+	//-------------------------------------------------------------------------
+	//		method:			loadProgram()
+	//		description:	L command.  The engine has no one to ask for a
+	//						file name, so L is an error unless a shell
+	//						overrides it.
+	//		calls:			n/a
+	//		called by:		parse()
+	//						execute()
+	//		parameters:		n/a
+	//		returns:		n/a
+	//		History Log:
+	//					10/17/2026 HJ completed version 1.0
+	// -------------------------------------------------------------------------
+	void CRPNEngine::loadProgram()
+	{
+		RPN_STAT(m_stats.error(STATERR_NOSHELL));
+		m_error = true;
+	}
+	//-------------------------------------------------------------------------
+	//		method:			recordProgram()
+	//		description:	P command; an error unless a shell overrides it
+	//		calls:			n/a
+	//		called by:		parse()
+	//						execute()
+	//		parameters:		n/a
+	//		returns:		n/a
+	//		History Log:
+	//					10/17/2026 HJ completed version 1.0
+	// -------------------------------------------------------------------------
+	void CRPNEngine::recordProgram()
+	{
+		RPN_STAT(m_stats.error(STATERR_NOSHELL));
+		m_error = true;
+	}
+	//-------------------------------------------------------------------------
+	//		method:			saveToFile()
+	//		description:	F command; an error unless a shell overrides it
+	//		calls:			n/a
+	//		called by:		parse()
+	//						execute()
+	//		parameters:		n/a
+	//		returns:		n/a
+	//		History Log:
+	//					10/17/2026 HJ completed version 1.0
+	// -------------------------------------------------------------------------
+	void CRPNEngine::saveToFile()
+	{
+		RPN_STAT(m_stats.error(STATERR_NOSHELL));
+		m_error = true;
+	}
+	//-------------------------------------------------------------------------
+	//		method:			toggleHelp()
+	//		description:	H command; the engine has no help to show
+	//		calls:			n/a
+	//		called by:		parse()
+	//						execute()
+	//		parameters:		n/a
+	//		returns:		n/a
+	//		History Log:
+	//					10/17/2026 HJ completed version 1.0
+	// -------------------------------------------------------------------------
+	void CRPNEngine::toggleHelp()
+	{
+	}
+	//-------------------------------------------------------------------------
+	//		method:			turnOff()
+	//		description:	X command; the engine has nothing to turn off
+	//		calls:			n/a
+	//		called by:		parse()
+	//						execute()
+	//		parameters:		n/a
+	//		returns:		n/a
+	//		History Log:
+	//					10/17/2026 HJ completed version 1.0
+	// -------------------------------------------------------------------------
+	void CRPNEngine::turnOff()
+	{
+	}
+	//-------------------------------------------------------------------------
+	//		method:			reset()
+	//		description:	empties the stack, zeroes the registers and
+	//						clears the error flag; the program and the
+	//						register names are kept
+	//		calls:			clearAll()
+	//		called by:		CRPNBatch::evaluateChunk()
+	//		parameters:		n/a
+	//		returns:		n/a
+	//		History Log:
+	//					10/17/2026 HJ completed version 1.0
+	//					10/17/2026 HJ named registers, version 1.1
+	// -------------------------------------------------------------------------
+	void CRPNEngine::reset()
+	{
+		clearAll();
+		for (int i = 0; i < m_registerNames.registerCount(); i++)
+			m_registers[i] = 0.0;
+		m_error = false;
+	}
+	//-------------------------------------------------------------------------
+	//		function:		formatNumber(double d, char* buffer, size_t size)
+	//		description:	formats d with the fewest significant digits
+	//						that read back as exactly d ("0.1", "1e+20",
+	//						"0.30000000000000004").  The
+	//						text does not depend on the locale where the
+	//						library has to_chars() for double; otherwise
+	//						snprintf() searches for the shortest precision.
+	//		calls:			to_chars() or snprintf()
+	//		called by:		CRPNCalc::runBatch()
+	//						CRPNCalc::print()
+	//						CRPNBatch::evaluateChunk()
+	//		parameters:		double d -- the value
+	//						char* buffer -- receives the text
+	//						size_t size -- size of buffer
+	//		returns:		size_t -- number of characters written
+	//		History Log:
+	//					10/17/2026 HJ completed version 1.0
+	//					10/17/2026 HJ shortest round trip, version 1.1
+	// -------------------------------------------------------------------------
+	size_t formatNumber(double d, char* buffer, size_t size)
+	{
+#if defined(__cpp_lib_to_chars)
+		to_chars_result result = to_chars(buffer, buffer + size, d);
+		return (result.ec == errc())
+			? static_cast<size_t>(result.ptr - buffer) : 0;
+#else
+		int length = snprintf(buffer, size, "%g", d);
+		// %g drops trailing zeros, so a normal number that needs fewer
+		// than DBL_DIG digits already comes out short at DBL_DIG
+		if (isfinite(d))
+			for (int precision = (fabs(d) < DBL_MIN) ? 1 : DBL_DIG;
+				precision <= 17; precision++)
+			{
+				length = snprintf(buffer, size, "%.*g", precision, d);
+				if (length < 0 || strtod(buffer, nullptr) == d)
+					break;
+			}
+		return (length < 0) ? 0 : static_cast<size_t>(length);
+#endif
+	}
+}
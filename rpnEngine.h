@@ -0,0 +1,344 @@
+//----------------------------------------------------------------------------
+//    File:		rpnEngine.h
+//
+//    Class:	CRPNEngine
+//----------------------------------------------------------------------------
+#ifndef RPNENGINE_H
+#define RPNENGINE_H
+
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <fstream>
+#include <list>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+#include "rpnArena.h"
+#include "rpnCache.h"
+#include "rpnJit.h"
+#include "rpnLibrary.h"
+#include "rpnMappedFile.h"
+#include "rpnOperators.h"
+#include "rpnProgram.h"
+#include "rpnProgramFile.h"
+#include "rpnRegisters.h"
+#include "rpnStack.h"
+#include "rpnStats.h"
+#include "rpnTokenizer.h"
+//----------------------------------------------------------------------------
+//
+//    Title:		RPNEngine Class
+//
+//    Description:	This file contains the class definition for CRPNEngine,
+//					the evaluation state and operators of the calculator.
+//					An engine has no streams and no global state: it is
+//					safe to run one engine per thread without locking.
+//					Commands that need a user (P, L, F, H, X) are virtual
+//					hooks that a shell such as CRPNCalc overrides.
+//
+//    Programmer:	Han Jung
+//
+//    Date:			10/17/2026
+//
+//    Version:		1.0
+//
+//    Environment:
+//       Hardware: Intel Xeon PC
+//       Software: Windows 10
+//       Compiles under Microsoft Visual C++ 2017 (/std:c++17)
+//
+//	  class CRPNEngine:
+//
+//	  Properties:
+//		double m_registers[MAXREGS] -- S0-S9/G0-G9, then the named
+//			registers; slots from registerCount() on are always 0.0
+//		CRPNRegisterNames m_registerNames -- slots of the named registers
+//		CRPNStack m_stack -- operand stack
+//		unique_ptr<CRPNMappedFile> m_programFile -- a loaded program file,
+//			mapped; text, or a program file (see CRPNProgramFile)
+//		CRPNArena m_programText -- a recorded program's text, when the
+//			program was not loaded from a file; reset, not freed, when
+//			the program is replaced
+//		vector<string_view> m_program -- the program lines, viewing
+//			m_programFile or m_programText
+//		CRPNProgram m_compiled -- m_program compiled for R
+//		CRPNProgram m_optimized -- m_compiled after optimize()
+//		unique_ptr<CRPNJit> m_jit -- m_optimized as native code, once the
+//			program is hot
+//		unsigned m_hotRuns -- runs of the current program, up to
+//			JITTHRESHOLD
+//		bool m_jitEnabled -- hot programs may be compiled to native code
+//		CRPNResultCache m_cache -- final states of earlier runs of the
+//			current program, by starting state
+//		vector<double> m_cacheKey -- scratch: the state a run starts from
+//		vector<double> m_cacheResult -- scratch: the state it ends in
+//		bool m_cacheable -- the program uses no shell commands or library
+//			programs, so its result depends only on the registers, stack
+//			and error flag
+//		CRPNLibrary m_library -- resident programs, run with R:name
+//		bool m_error -- set by any failed operation until cleared
+//		bool m_programChanged -- m_compiled is out of date
+//		bool m_programMapped -- m_compiled and m_optimized are the code
+//			of the program file in m_programFile, so need no compiling
+//		int m_runDepth -- nesting of R inside programs
+//		vector<size_t> m_calls -- return addresses of the calls being run
+//		uint64_t m_jumpLimit -- jumps a run, or a line, may take
+//		uint64_t m_jumps -- jumps the current run, or line, has left
+//		bool m_jumpsPerLine -- m_jumpLimit is for each evaluate(), not
+//			for each run
+//		CRPNStats m_stats -- RPNCALC_STATS builds only: operator counts,
+//			errors by cause and latencies
+//
+//	  Methods:
+//
+//		inline:
+//			bool empty() const;
+//			size_t depth() const;
+//			double top() const;
+//			bool error() const;
+//			void clearError();
+//			const vector<string_view>& program() const;
+//			const CRPNArena& programArena() const;
+//			CRPNRegisterNames& registerNames();
+//			const CRPNRegisterNames& registerNames() const;
+//			size_t programSize() const;
+//			size_t optimizedSize() const;
+//			void setJit(bool enabled);
+//			bool jitCompiled() const;
+//			void setResultCache(size_t capacity);
+//			const CRPNResultCache& resultCache() const;
+//			void setJumpLimit(uint64_t limit, bool perLine = false);
+//			uint64_t jumpLimit() const;
+//			const CRPNLibrary& library() const;
+//			const CRPNStats* stats() const;
+//			void clearStats();
+//
+//		non-inline:
+//		public:
+//			CRPNEngine();
+//			virtual ~CRPNEngine();
+//			EvalResult evaluate(string_view line, double& top);
+//			void setProgram(const list<string>& program);
+//			void setProgramText(string_view text);
+//			void compileProgram();
+//			bool loadProgramFile(const string& filename);
+//			bool saveProgramFile(const string& filename);
+//			bool saveProgramBinary(const string& filename);
+//			bool defineProgram(string_view name, string_view text);
+//			bool loadLibrary(const string& filename);
+//			void copyLibrary(const CRPNEngine& source);
+//			double registerValue(int reg) const;
+//			void setRegister(int reg, double d);
+//			void push(double d);
+//			void reset();
+//		protected:
+//			void parse(string_view line);
+//			virtual void loadProgram();
+//			virtual void recordProgram();
+//			virtual void saveToFile();
+//			virtual void toggleHelp();
+//			virtual void turnOff();
+//		private:
+//			void add();
+//			void binary_prep(double& d1, double& d2);
+//			void clearEntry();
+//			void clearAll();
+//			void divide();
+//			void constantOp(OpCode op, double d1);
+//			size_t branch(const SInstruction& instruction, size_t next,
+//				size_t calls);
+//			void customOp(const SOperator& entry);
+//			void execute(const CRPNProgram& program,
+//				const CRPNProgram& source, size_t first, size_t calls);
+//			void exp();
+//			void getReg(int reg);
+//			void mod();
+//			void multiply();
+//			void neg();
+//			void ownProgramText();
+//			int registerSlot(const SToken& token);
+//			void rotateUp(int count);
+//			void rotateDown(int count);
+//			bool runJit();
+//			void runLibraryProgram(int slot);
+//			void runProgram();
+//			void saveState(vector<double>& state) const;
+//			void setReg(int reg);
+//			bool step(const SInstruction& instruction,
+//				const double* constants);
+//			void subtract();
+//			void unary_prep(double& d);
+//
+//	  related functions:
+//			size_t formatNumber(double d, char* buffer, size_t size);
+//
+//    History Log:
+//			10/17/2026	HJ  split from CRPNCalc, version 1.0
+//			10/17/2026	HJ  program text in an arena, version 1.1
+//			10/17/2026	HJ  named registers, version 1.2
+//			10/17/2026	HJ  U:k and D:k, D fixed, version 1.3
+//			10/17/2026	HJ  operator table and custom operators, version 1.4
+//			10/17/2026	HJ  branches, loops and calls, version 1.5
+//			10/17/2026	HJ  library programs, version 1.6
+//			10/17/2026	HJ  binary program files, version 1.7
+//			10/17/2026	HJ  copyLibrary(), version 1.8
+//			10/17/2026	HJ  jump limit per line, version 1.9
+// ----------------------------------------------------------------------------
+
+using namespace std;
+
+namespace PB_CALC
+{
+	const unsigned short MAXRUNDEPTH = 256;
+	const size_t MAXCALLDEPTH = 256;
+	const uint64_t MAXJUMPS = 10000000000ULL;	// default jump limit of a run
+	const unsigned JITTHRESHOLD = 8;	// runs before a program is compiled
+	const size_t NUMBERSIZE = 32;
+	const char errorText[] = "<<error>>";
+
+	enum EvalResult
+	{
+		EVAL_OK,		// the top of the stack was returned
+		EVAL_EMPTY,		// the stack is empty
+		EVAL_ERROR		// the line caused an error
+	};
+
+	class CRPNEngine
+	{
+	public:
+		CRPNEngine();
+		virtual ~CRPNEngine();
+		EvalResult evaluate(string_view line, double& top);
+		void setProgram(const list<string>& program);
+		void setProgramText(string_view text);
+		void compileProgram();
+		bool loadProgramFile(const string& filename);
+		bool saveProgramFile(const string& filename);
+		bool saveProgramBinary(const string& filename);
+		bool defineProgram(string_view name, string_view text);
+		bool loadLibrary(const string& filename);
+		void copyLibrary(const CRPNEngine& source);
+		double registerValue(int reg) const;
+		void setRegister(int reg, double d);
+		void push(double d);
+		void reset();
+
+		bool empty() const { return m_stack.empty(); }
+		size_t depth() const { return m_stack.size(); }
+		double top() const { return m_stack.top(); }
+		bool error() const { return m_error; }
+		void clearError() { m_error = false; }
+		const vector<string_view>& program() const { return m_program; }
+		const CRPNArena& programArena() const { return m_programText; }
+		// slots of the named registers, for registerValue()/setRegister()
+		CRPNRegisterNames& registerNames() { return m_registerNames; }
+		const CRPNRegisterNames& registerNames() const
+		{
+			return m_registerNames;
+		}
+		// instruction counts after compileProgram()
+		size_t programSize() const { return m_compiled.size(); }
+		size_t optimizedSize() const { return m_optimized.size(); }
+		// native code for hot programs, where the host supports it
+		void setJit(bool enabled) { m_jitEnabled = enabled; }
+		bool jitCompiled() const { return m_jit && m_jit->ready(); }
+		// memoized runs, keyed by starting state; 0 entries turns it off
+		void setResultCache(size_t capacity) { m_cache.setCapacity(capacity); }
+		const CRPNResultCache& resultCache() const { return m_cache; }
+		// a run that takes more jumps stops with an error, so a program
+		// that never leaves its loop cannot hang the caller; perLine
+		// makes it the limit for all the runs of an evaluate() together
+		void setJumpLimit(uint64_t limit, bool perLine = false)
+		{
+			m_jumpLimit = limit;
+			m_jumpsPerLine = perLine;
+		}
+		uint64_t jumpLimit() const { return m_jumpLimit; }
+		// programs defined with defineProgram() or loadLibrary()
+		const CRPNLibrary& library() const { return m_library; }
+#if defined(RPNCALC_STATS)
+		const CRPNStats* stats() const { return &m_stats; }
+		void clearStats() { m_stats.clear(); }
+#else
+		// statistics are not collected in this build
+		const CRPNStats* stats() const { return nullptr; }
+		void clearStats() {}
+#endif
+
+	protected:
+		void parse(string_view line);
+
+		// commands that need a user; see the .cpp for the defaults
+		virtual void loadProgram();
+		virtual void recordProgram();
+		virtual void saveToFile();
+		virtual void toggleHelp();
+		virtual void turnOff();
+
+	private:
+		static const size_t ENDRUN = ~size_t(0);	// from branch(): stop
+
+		void add();
+		void binary_prep(double& d1, double& d2);
+		void clearEntry();
+		void clearAll();
+		void divide();
+		void constantOp(OpCode op, double d1);
+		size_t branch(const SInstruction& instruction, size_t next,
+			size_t calls);
+		void customOp(const SOperator& entry);
+		void execute(const CRPNProgram& program, const CRPNProgram& source,
+			size_t first, size_t calls);
+		void exp();
+		void getReg(int reg);
+		void mod();
+		void multiply();
+		void neg();
+		void ownProgramText();
+		int registerSlot(const SToken& token);
+		void rotateUp(int count);
+		void rotateDown(int count);
+		bool runJit();
+		void runLibraryProgram(int slot);
+		void runProgram();
+		void saveState(vector<double>& state) const;
+		void setReg(int reg);
+		bool step(const SInstruction& instruction, const double* constants);
+		void subtract();
+		void unary_prep(double& d);
+
+		double m_registers[MAXREGS];
+		CRPNRegisterNames m_registerNames;
+		CRPNStack m_stack;
+		unique_ptr<CRPNMappedFile> m_programFile;
+		CRPNArena m_programText;
+		vector<string_view> m_program;
+		CRPNProgram m_compiled;
+		CRPNProgram m_optimized;
+		unique_ptr<CRPNJit> m_jit;
+		unsigned m_hotRuns;
+		bool m_jitEnabled;
+		CRPNResultCache m_cache;
+		vector<double> m_cacheKey;
+		vector<double> m_cacheResult;
+		bool m_cacheable;
+		CRPNLibrary m_library;
+		bool m_error;
+		bool m_programChanged;
+		bool m_programMapped;
+		int m_runDepth;
+		vector<size_t> m_calls;
+		uint64_t m_jumpLimit;
+		uint64_t m_jumps;
+		bool m_jumpsPerLine;
+#if defined(RPNCALC_STATS)
+		CRPNStats m_stats;
+#endif
+	};
+
+	size_t formatNumber(double d, char* buffer, size_t size);
+}
+
+#endif
@@ -0,0 +1,729 @@
+#include "rpnJit.h"
+#include "rpnOperators.h"
+#include "rpnRegisters.h"
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#if defined(__x86_64__) && !defined(_WIN32) && !defined(RPNCALC_NO_JIT)
+#include <sys/mman.h>
+#include <unistd.h>
+#define RPNJIT_X64
+#endif
+//-------------------------------------------------------------------------------------------
+//    Class:		CRPNJit
+//
+//    File:			rpnJit.cpp
+//
+//    Description:	This file contains the function definitions for
+//					CRPNJit and the x86-64 assembler it uses
+//
+//    Programmer:	Han Jung
+//
+//    Date:			10/17/2026
+//
+//    Version:		1.0
+//
+//    Environment:	Intel Xeon PC
+//                  Software:   Linux x86-64 for the generated code;
+//                  Compiles under Microsoft Visual C++ 2017 (/std:c++17)
+//
+//	  class:		CRPNJit
+//
+//	  Properties:
+//				unsigned char* m_code;
+//				size_t m_codeSize;
+//				size_t m_inputs;
+//				size_t m_outputs;
+//				bool m_clearsStack;
+//				vector<double> m_frame;
+//
+//	  Non-inline Methods:
+//				CRPNJit();
+//				~CRPNJit();
+//				bool compile(const CRPNProgram& program);
+//				void clear();
+//				bool run(double* registers);
+//				static bool supported();
+//
+//    History Log:
+//				10/17/2026	HJ x86-64 code for hot programs, version 1.0
+//				10/17/2026	HJ any register slot, version 1.1
+//				10/17/2026	HJ custom operators, version 1.2
+// ----------------------------------------------------------------------------
+namespace PB_CALC
+{
+	namespace
+	{
+		// the generated function: frame in rdi, registers in rsi; returns
+		// 0, or 1 if an op would have failed
+		typedef int (*JitCode)(double* frame, double* registers);
+
+#if defined(RPNJIT_X64)
+		const size_t XMMSLOTS = 14;		// slots 0-13 live in xmm0-xmm13
+		const int TEMP = 14;			// xmm14: results on their way
+		const int SCRATCH = 15;			// xmm15: zero and -1.0
+		const int FRAME = 3;			// rbx holds the frame
+		const int REGISTERS = 5;		// rbp holds the registers
+
+		// the arithmetic of exp() and mod(), called from generated code
+		double callPow(double d1, double d2) { return pow(d1, d2); }
+		double callFmod(double d1, double d2) { return fmod(d1, d2); }
+
+		//--------------------------------------------------------------------
+		//	Class:			CAssembler
+		//	Description:	emits the handful of x86-64 instructions the
+		//					backend needs.  Memory operands are always
+		//					[rbx + disp32] or [rbp + disp32]; stack slot s
+		//					is xmm s below XMMSLOTS and frame[s] above.
+		//--------------------------------------------------------------------
+		class CAssembler
+		{
+		public:
+			const vector<unsigned char>& bytes() const { return m_bytes; }
+
+			void byte(unsigned b)
+			{
+				m_bytes.push_back(static_cast<unsigned char>(b));
+			}
+			void dword(uint32_t d)
+			{
+				for (int i = 0; i < 4; i++)
+					byte((d >> (8 * i)) & 0xFF);
+			}
+			void qword(uint64_t q)
+			{
+				for (int i = 0; i < 8; i++)
+					byte((q >> (8 * i)) & 0xFF);
+			}
+
+			// prefix [REX] 0F op with reg, reg
+			void sse(unsigned prefix, unsigned op, int reg, int rm)
+			{
+				byte(prefix);
+				if (reg >= 8 || rm >= 8)
+					byte(0x40 | (reg >= 8 ? 4 : 0) | (rm >= 8 ? 1 : 0));
+				byte(0x0F);
+				byte(op);
+				byte(0xC0 | ((reg & 7) << 3) | (rm & 7));
+			}
+			// prefix [REX] 0F op with reg, [base + disp]
+			void sseMemory(unsigned prefix, unsigned op, int reg, int base,
+				size_t disp)
+			{
+				byte(prefix);
+				if (reg >= 8)
+					byte(0x44);
+				byte(0x0F);
+				byte(op);
+				byte(0x80 | ((reg & 7) << 3) | base);
+				dword(static_cast<uint32_t>(disp));
+			}
+			// prefix [REX] 0F op with xmm, slot s
+			void sseSlot(unsigned prefix, unsigned op, int reg, size_t s)
+			{
+				if (s < XMMSLOTS)
+					sse(prefix, op, reg, static_cast<int>(s));
+				else
+					sseMemory(prefix, op, reg, FRAME, s * sizeof(double));
+			}
+
+			void load(int xmm, size_t s)
+			{
+				if (s >= XMMSLOTS)
+					sseSlot(0xF2, 0x10, xmm, s);		// movsd
+				else if (xmm != static_cast<int>(s))
+					sse(0x66, 0x28, xmm, static_cast<int>(s));	// movapd
+			}
+			void store(size_t s, int xmm)
+			{
+				if (s >= XMMSLOTS)
+					sseMemory(0xF2, 0x11, xmm, FRAME, s * sizeof(double));
+				else if (xmm != static_cast<int>(s))
+					sse(0x66, 0x28, static_cast<int>(s), xmm);
+			}
+			void spill(size_t s)
+			{
+				sseMemory(0xF2, 0x11, static_cast<int>(s), FRAME,
+					s * sizeof(double));
+			}
+			void reload(size_t s)
+			{
+				sseMemory(0xF2, 0x10, static_cast<int>(s), FRAME,
+					s * sizeof(double));
+			}
+			// addsd, subsd, mulsd or divsd: xmm = xmm OP slot s
+			void arithmetic(unsigned op, int xmm, size_t s)
+			{
+				sseSlot(0xF2, op, xmm, s);
+			}
+			void constant(int xmm, double d)
+			{
+				uint64_t bits;
+				memcpy(&bits, &d, sizeof bits);
+				byte(0x48);						// mov rax, imm64
+				byte(0xB8);
+				qword(bits);
+				byte(0x66);						// movq xmm, rax
+				byte(xmm >= 8 ? 0x4C : 0x48);
+				byte(0x0F);
+				byte(0x6E);
+				byte(0xC0 | ((xmm & 7) << 3));
+			}
+			void zeroScratch()
+			{
+				sse(0x66, 0x57, SCRATCH, SCRATCH);		// xorpd
+			}
+			// ucomisd xmm15, slot s; xmm15 must hold zero
+			void compareZero(size_t s)
+			{
+				sseSlot(0x66, 0x2E, SCRATCH, s);
+			}
+			// jcc rel8 to a label bound later
+			size_t jumpShort(unsigned cc)
+			{
+				byte(0x70 | cc);
+				byte(0);
+				return m_bytes.size();
+			}
+			void bind(size_t jump)
+			{
+				m_bytes[jump - 1] =
+					static_cast<unsigned char>(m_bytes.size() - jump);
+			}
+			// equal and ordered: the d == 0 of the interpreter
+			void failIfZero(size_t s)
+			{
+				compareZero(s);
+				size_t unordered = jumpShort(0xA);		// jp
+				byte(0x0F);								// je rel32
+				byte(0x84);
+				dword(0);
+				m_failJumps.push_back(m_bytes.size());
+				bind(unordered);
+			}
+			// 0^0 fails; NaN compares unequal, as in the interpreter
+			void failIfBothZero(size_t top, size_t next)
+			{
+				zeroScratch();
+				compareZero(top);
+				size_t unordered = jumpShort(0xA);		// jp
+				size_t nonzero = jumpShort(0x5);		// jne
+				failIfZero(next);
+				bind(unordered);
+				bind(nonzero);
+			}
+			void call(double (*function)(double, double))
+			{
+				callAddress(reinterpret_cast<uintptr_t>(function));
+			}
+			void call(OperatorKernel kernel)
+			{
+				callAddress(reinterpret_cast<uintptr_t>(kernel));
+			}
+			// lea rdi, [rbx + slot s]: where a kernel puts its result
+			void resultAddress(size_t s)
+			{
+				byte(0x48);
+				byte(0x8D);
+				byte(0x80 | (7 << 3) | FRAME);
+				dword(static_cast<uint32_t>(s * sizeof(double)));
+			}
+			// a kernel returned false
+			void failIfFalse()
+			{
+				byte(0x84);						// test al, al
+				byte(0xC0);
+				byte(0x0F);						// je rel32
+				byte(0x84);
+				dword(0);
+				m_failJumps.push_back(m_bytes.size());
+			}
+
+			void prologue()
+			{
+				byte(0x53);						// push rbx
+				byte(0x55);						// push rbp
+				byte(0x48); byte(0x83); byte(0xEC); byte(0x08);	// sub rsp, 8
+				byte(0x48); byte(0x89); byte(0xFB);	// mov rbx, rdi
+				byte(0x48); byte(0x89); byte(0xF5);	// mov rbp, rsi
+			}
+			void epilogue()
+			{
+				byte(0x31); byte(0xC0);			// xor eax, eax
+				size_t exit = m_bytes.size();
+				byte(0x48); byte(0x83); byte(0xC4); byte(0x08);	// add rsp, 8
+				byte(0x5D);						// pop rbp
+				byte(0x5B);						// pop rbx
+				byte(0xC3);						// ret
+				size_t fail = m_bytes.size();
+				byte(0xB8);						// mov eax, 1
+				dword(1);
+				byte(0xE9);						// jmp exit
+				dword(static_cast<uint32_t>(exit - (m_bytes.size() + 4)));
+				for (size_t jump : m_failJumps)
+				{
+					uint32_t rel = static_cast<uint32_t>(fail - jump);
+					memcpy(&m_bytes[jump - 4], &rel, sizeof rel);
+				}
+			}
+
+		private:
+			void callAddress(uint64_t address)
+			{
+				byte(0x48);						// mov rax, imm64
+				byte(0xB8);
+				qword(address);
+				byte(0xFF);						// call rax
+				byte(0xD0);
+			}
+
+			vector<unsigned char> m_bytes;
+			vector<size_t> m_failJumps;
+		};
+
+		//--------------------------------------------------------------------
+		//	Function:		shape(const SInstruction& instruction,
+		//						ptrdiff_t& reads, ptrdiff_t& change)
+		//	Description:	the stack values an op needs and how it changes
+		//					the depth, for the ops the backend compiles
+		//	Returns:		false if the op is not compiled
+		//--------------------------------------------------------------------
+		bool shape(const SInstruction& instruction, ptrdiff_t& reads,
+			ptrdiff_t& change)
+		{
+			switch (instruction.op)
+			{
+			case OP_PUSH:
+			case OP_NEGZERO:
+				reads = 0;
+				change = 1;
+				return true;
+			case OP_GETREG:
+				reads = 0;
+				change = 1;
+				return instruction.arg >= 0 && instruction.arg < MAXREGS;
+			case OP_SETREG:
+				reads = 1;
+				change = 0;
+				return instruction.arg >= 0 && instruction.arg < MAXREGS;
+			case OP_ADD:
+			case OP_SUBTRACT:
+			case OP_MULTIPLY:
+			case OP_DIVIDE:
+			case OP_EXP:
+			case OP_MOD:
+				reads = 2;
+				change = -1;
+				return true;
+			case OP_NEG:
+			case OP_ADDCONST:
+			case OP_SUBTRACTCONST:
+			case OP_MULTIPLYCONST:
+			case OP_DIVIDECONST:
+			case OP_EXPCONST:
+			case OP_MODCONST:
+				reads = 1;
+				change = 0;
+				return true;
+			case OP_CLEARENTRY:
+				reads = 1;
+				change = -1;
+				return true;
+			case OP_CUSTOM:
+				reads = CRPNOperators::custom(instruction.arg).arity;
+				change = 1 - reads;
+				return true;
+			default:
+				return false;
+			}
+		}
+
+		//--------------------------------------------------------------------
+		//	Function:		sseOp(OpCode op)
+		//	Description:	the SSE2 opcode byte of + - * /
+		//--------------------------------------------------------------------
+		unsigned sseOp(OpCode op)
+		{
+			switch (op)
+			{
+			case OP_ADD: return 0x58;
+			case OP_SUBTRACT: return 0x5C;
+			case OP_MULTIPLY: return 0x59;
+			default: return 0x5E;
+			}
+		}
+
+		//--------------------------------------------------------------------
+		//	Function:		emitBinary(CAssembler& a, OpCode op, size_t top,
+		//						bool isConstant, double d1, size_t next)
+		//	Description:	slot next = d1 OP slot next, where d1 is slot
+		//					top, or the constant when isConstant is set.
+		//					pow() and fmod() are called with every live
+		//					slot spilled, since no XMM register survives a
+		//					call.
+		//--------------------------------------------------------------------
+		void emitBinary(CAssembler& a, OpCode op, size_t top, bool isConstant,
+			double d1, size_t next)
+		{
+			if (op == OP_DIVIDE || op == OP_MOD)
+			{
+				a.zeroScratch();
+				a.failIfZero(next);
+			}
+			else if (op == OP_EXP)
+			{
+				if (!isConstant)
+					a.failIfBothZero(top, next);
+				else if (d1 == 0)
+				{
+					a.zeroScratch();
+					a.failIfZero(next);
+				}
+			}
+
+			if (op == OP_EXP || op == OP_MOD)
+			{
+				size_t live = isConstant ? next + 1 : top + 1;
+				for (size_t s = 0; s < min(live, XMMSLOTS); s++)
+					a.spill(s);
+				if (isConstant)
+					a.constant(0, d1);
+				else
+					a.sseMemory(0xF2, 0x10, 0, FRAME, top * sizeof(double));
+				a.sseMemory(0xF2, 0x10, 1, FRAME, next * sizeof(double));
+				a.call(op == OP_EXP ? callPow : callFmod);
+				a.sseMemory(0xF2, 0x11, 0, FRAME, next * sizeof(double));
+				for (size_t s = 0; s < min(next + 1, XMMSLOTS); s++)
+					a.reload(s);
+				return;
+			}
+
+			// the result is built where d1 is, then moved to next
+			int result = TEMP;
+			if (isConstant)
+				a.constant(TEMP, d1);
+			else if (top < XMMSLOTS)
+				result = static_cast<int>(top);
+			else
+				a.load(TEMP, top);
+			a.arithmetic(sseOp(op), result, next);
+			a.store(next, result);
+		}
+
+		//--------------------------------------------------------------------
+		//	Function:		emitCustom(CAssembler& a, const SOperator& entry,
+		//						size_t top)
+		//	Description:	calls a custom operator's kernel on slot top,
+		//					and the slot below it for two operands, with
+		//					every live slot spilled; the kernel writes its
+		//					result to the frame.  If it returns false the
+		//					code fails, and the interpreter runs the
+		//					operator again and sets the error.
+		//--------------------------------------------------------------------
+		void emitCustom(CAssembler& a, const SOperator& entry, size_t top)
+		{
+			const size_t result = top + 1 - entry.arity;
+			for (size_t s = 0; s < min(top + 1, XMMSLOTS); s++)
+				a.spill(s);
+			a.sseMemory(0xF2, 0x10, 0, FRAME, top * sizeof(double));
+			if (entry.arity == 2)
+				a.sseMemory(0xF2, 0x10, 1, FRAME, result * sizeof(double));
+			else
+				a.sse(0x66, 0x57, 1, 1);		// xorpd: d2 is 0
+			a.resultAddress(result);
+			a.call(entry.kernel);
+			a.failIfFalse();
+			for (size_t s = 0; s < min(result + 1, XMMSLOTS); s++)
+				a.reload(s);
+		}
+#endif
+	}
+
+	//-------------------------------------------------------------------------
+	//		method:			CRPNJit()
+	//		description:	constructor; nothing is compiled
+	//		calls:			n/a
+	//		called by:		CRPNEngine::runJit()
+	//		parameters:		n/a
+	//		returns:		n/a
+	//		History Log:
+	//					10/17/2026 HJ completed version 1.0
+	// -------------------------------------------------------------------------
+	CRPNJit::CRPNJit() : m_code(nullptr), m_codeSize(0), m_inputs(0),
+		m_outputs(0), m_clearsStack(false)
+	{
+	}
+	//-------------------------------------------------------------------------
+	//		method:			~CRPNJit()
+	//		description:	destructor; unmaps the code
+	//		calls:			clear()
+	//		called by:		n/a
+	//		parameters:		n/a
+	//		returns:		n/a
+	//		History Log:
+	//					10/17/2026 HJ completed version 1.0
+	// -------------------------------------------------------------------------
+	CRPNJit::~CRPNJit()
+	{
+		clear();
+	}
+	//-------------------------------------------------------------------------
+	//		method:			compile(const CRPNProgram& program)
+	//		description:	translates program to native code, replacing
+	//						any earlier code.  A first pass finds how many
+	//						entry values the program reads; a second emits
+	//						the code with every slot at a fixed place.  The
+	//						mapping is writable while it is filled and only
+	//						executable after.
+	//		calls:			CRPNProgram::code()
+	//						CRPNProgram::constants()
+	//						clear()
+	//		called by:		CRPNEngine::runJit()
+	//		parameters:		const CRPNProgram& program -- the program,
+	//						normally optimized
+	//		returns:		bool -- false if the host or the program is not
+	//						supported; ready() is then false
+	//		History Log:
+	//					10/17/2026 HJ completed version 1.0
+	//					10/17/2026 HJ custom operators, version 1.1
+	//					10/17/2026 HJ mapped programs, version 1.2
+	// -------------------------------------------------------------------------
+	bool CRPNJit::compile(const CRPNProgram& program)
+	{
+		clear();
+#if defined(RPNJIT_X64)
+		const SInstruction* const code = program.code();
+		const size_t count = program.size();
+		const double* const constants = program.constants();
+		if (count == 0)
+			return false;
+
+		// how far below the entry top the program reaches; after a CE
+		// nothing is left to reach, so an underflow there always fails
+		ptrdiff_t inputs = 0;
+		ptrdiff_t depth = 0;
+		bool cleared = false;
+		for (size_t i = 0; i < count; i++)
+		{
+			const SInstruction& instruction = code[i];
+			if (instruction.op == OP_CLEARALL)
+			{
+				cleared = true;
+				depth = 0;
+				continue;
+			}
+			if (instruction.op == OP_CLEARENTRY && cleared && depth == 0)
+				continue;
+			ptrdiff_t reads = 0;
+			ptrdiff_t change = 0;
+			if (!shape(instruction, reads, change))
+				return false;
+			if (depth < reads)
+			{
+				if (cleared)
+					return false;
+				inputs = max(inputs, reads - depth);
+			}
+			depth += change;
+		}
+
+		CAssembler a;
+		a.prologue();
+		size_t slots = static_cast<size_t>(inputs);
+		size_t maxSlots = slots;
+		for (size_t s = 0; s < min(slots, XMMSLOTS); s++)
+			a.reload(s);
+		for (size_t i = 0; i < count; i++)
+		{
+			const SInstruction& instruction = code[i];
+			switch (instruction.op)
+			{
+			case OP_PUSH:
+			case OP_NEGZERO:
+			{
+				double d = constants[instruction.arg];
+				if (instruction.op == OP_NEGZERO)
+					d *= -1.0;		// as neg() does it
+				if (slots < XMMSLOTS)
+					a.constant(static_cast<int>(slots), d);
+				else
+				{
+					a.constant(TEMP, d);
+					a.store(slots, TEMP);
+				}
+				slots++;
+				break;
+			}
+			case OP_GETREG:
+				if (slots < XMMSLOTS)
+					a.sseMemory(0xF2, 0x10, static_cast<int>(slots),
+						REGISTERS, instruction.arg * sizeof(double));
+				else
+				{
+					a.sseMemory(0xF2, 0x10, TEMP, REGISTERS,
+						instruction.arg * sizeof(double));
+					a.store(slots, TEMP);
+				}
+				slots++;
+				break;
+			case OP_SETREG:
+			{
+				int xmm = TEMP;
+				if (slots - 1 < XMMSLOTS)
+					xmm = static_cast<int>(slots - 1);
+				else
+					a.load(TEMP, slots - 1);
+				a.sseMemory(0xF2, 0x11, xmm, REGISTERS,
+					instruction.arg * sizeof(double));
+				break;
+			}
+			case OP_ADD:
+			case OP_SUBTRACT:
+			case OP_MULTIPLY:
+			case OP_DIVIDE:
+			case OP_EXP:
+			case OP_MOD:
+				emitBinary(a, instruction.op, slots - 1, false, 0.0,
+					slots - 2);
+				slots--;
+				break;
+			case OP_ADDCONST:
+			case OP_SUBTRACTCONST:
+			case OP_MULTIPLYCONST:
+			case OP_DIVIDECONST:
+			case OP_EXPCONST:
+			case OP_MODCONST:
+				emitBinary(a, static_cast<OpCode>(OP_ADD
+					+ (instruction.op - OP_ADDCONST)), slots, true,
+					constants[instruction.arg], slots - 1);
+				break;
+			case OP_NEG:
+			{
+				// GCC and Clang compile neg()'s d *= -1.0 to a sign flip,
+				// so flip the sign too and NaNs match
+				size_t top = slots - 1;
+				a.constant(SCRATCH, -0.0);
+				if (top < XMMSLOTS)
+					a.sse(0x66, 0x57, static_cast<int>(top), SCRATCH);
+				else
+				{
+					a.load(TEMP, top);
+					a.sse(0x66, 0x57, TEMP, SCRATCH);	// xorpd
+					a.store(top, TEMP);
+				}
+				break;
+			}
+			case OP_CLEARENTRY:
+				if (slots > 0)
+					slots--;
+				break;
+			case OP_CLEARALL:
+				slots = 0;
+				break;
+			case OP_CUSTOM:
+			{
+				const SOperator& entry = CRPNOperators::custom(
+					instruction.arg);
+				emitCustom(a, entry, slots - 1);
+				slots -= entry.arity - 1;
+				break;
+			}
+			default:
+				break;
+			}
+			maxSlots = max(maxSlots, slots);
+		}
+		for (size_t s = 0; s < min(slots, XMMSLOTS); s++)
+			a.spill(s);
+		a.epilogue();
+
+		const vector<unsigned char>& bytes = a.bytes();
+		size_t page = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+		size_t size = (bytes.size() + page - 1) / page * page;
+		void* memory = mmap(nullptr, size, PROT_READ | PROT_WRITE,
+			MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+		if (memory == MAP_FAILED)
+			return false;
+		memcpy(memory, bytes.data(), bytes.size());
+		if (mprotect(memory, size, PROT_READ | PROT_EXEC) != 0)
+		{
+			munmap(memory, size);
+			return false;
+		}
+		m_code = static_cast<unsigned char*>(memory);
+		m_codeSize = size;
+		m_inputs = static_cast<size_t>(inputs);
+		m_outputs = slots;
+		m_clearsStack = cleared;
+		m_frame.assign(max<size_t>(maxSlots, 1), 0.0);
+		return true;
+#else
+		(void)program;
+		return false;
+#endif
+	}
+	//-------------------------------------------------------------------------
+	//		method:			clear()
+	//		description:	unmaps any compiled code
+	//		calls:			n/a
+	//		called by:		compile()
+	//						~CRPNJit()
+	//						CRPNEngine::compileProgram()
+	//		parameters:		n/a
+	//		returns:		n/a
+	//		History Log:
+	//					10/17/2026 HJ completed version 1.0
+	// -------------------------------------------------------------------------
+	void CRPNJit::clear()
+	{
+#if defined(RPNJIT_X64)
+		if (m_code != nullptr)
+			munmap(m_code, m_codeSize);
+#endif
+		m_code = nullptr;
+		m_codeSize = 0;
+		m_inputs = 0;
+		m_outputs = 0;
+		m_clearsStack = false;
+	}
+	//-------------------------------------------------------------------------
+	//		method:			run(double* registers)
+	//		description:	runs the compiled code.  frame() must hold the
+	//						inputs() values below the top of the stack,
+	//						bottom first; on success it holds the outputs()
+	//						values the program leaves there.
+	//		calls:			the generated code
+	//		called by:		CRPNEngine::runJit()
+	//		parameters:		double* registers -- the register slots the
+	//						program uses, read and written
+	//		returns:		bool -- false if an op would have failed; the
+	//						frame and registers are then only partly
+	//						written and the caller must discard them
+	//		History Log:
+	//					10/17/2026 HJ completed version 1.0
+	// -------------------------------------------------------------------------
+	bool CRPNJit::run(double* registers)
+	{
+		JitCode entry = reinterpret_cast<JitCode>(m_code);
+		return entry(m_frame.data(), registers) == 0;
+	}
+	//-------------------------------------------------------------------------
+	//		method:			supported()
+	//		description:	whether this build can generate code at all
+	//		calls:			n/a
+	//		called by:		main() (benchmarks)
+	//		parameters:		n/a
+	//		returns:		bool -- true on x86-64 System V hosts
+	//		History Log:
+	//					10/17/2026 HJ completed version 1.0
+	// -------------------------------------------------------------------------
+	bool CRPNJit::supported()
+	{
+#if defined(RPNJIT_X64)
+		return true;
+#else
+		return false;
+#endif
+	}
+}
@@ -0,0 +1,116 @@
+//----------------------------------------------------------------------------
+//    File:		rpnJit.h
+//
+//    Class:	CRPNJit
+//----------------------------------------------------------------------------
+#ifndef RPNJIT_H
+#define RPNJIT_H
+
+#include <cstddef>
+#include <vector>
+#include "rpnProgram.h"
+//----------------------------------------------------------------------------
+//
+//    Title:		RPNJit Class
+//
+//    Description:	This file contains the class definition for CRPNJit,
+//					a native code backend for hot recorded programs.  A
+//					straight-line program of pushes, + - * / ^ %, M, C, CE,
+//					S/G and custom operators (CRPNOperators) is translated
+//					to x86-64 machine code in an executable mapping.  The
+//					stack depth at every point is known when the code is
+//					generated, so each stack slot gets a fixed home: the
+//					bottom 14 slots live in XMM registers and only deeper
+//					slots use memory.
+//
+//					Generated code never sets an error.  Before an op
+//					that would fail (divide or mod by zero, 0^0), or after
+//					a custom operator's kernel fails, it returns false
+//					having changed nothing the caller owns, and the caller
+//					runs the interpreter instead.
+//					Programs with any other op, or on a host other than
+//					x86-64 with the System V calling convention, are not
+//					compiled and also run on the interpreter.
+//
+//    Programmer:	Han Jung
+//
+//    Date:			10/17/2026
+//
+//    Version:		1.0
+//
+//    Environment:
+//       Hardware: Intel Xeon PC
+//       Software: Linux x86-64 (mmap); elsewhere compile() always fails
+//       Compiles under Microsoft Visual C++ 2017 (/std:c++17)
+//       RPNCALC_NO_JIT turns the backend off
+//
+//	  class CRPNJit:
+//
+//	  Properties:
+//		unsigned char* m_code -- the executable mapping, nullptr if none
+//		size_t m_codeSize -- length of the mapping
+//		size_t m_inputs -- stack values the code reads on entry
+//		size_t m_outputs -- stack values it leaves
+//		bool m_clearsStack -- the program runs CE, so no entry value
+//			below the inputs survives
+//		vector<double> m_frame -- inputs on entry, outputs on return,
+//			and the home of slots that do not fit in registers
+//
+//	  Methods:
+//
+//		inline:
+//			bool ready() const;
+//			size_t inputs() const;
+//			size_t outputs() const;
+//			bool clearsStack() const;
+//			double* frame();
+//
+//		non-inline:
+//		public:
+//			CRPNJit();
+//			~CRPNJit();
+//			bool compile(const CRPNProgram& program);
+//			void clear();
+//			bool run(double* registers);
+//			static bool supported();
+//
+//    History Log:
+//			10/17/2026	HJ  x86-64 code for hot programs, version 1.0
+//			10/17/2026	HJ  custom operators, version 1.1
+// ----------------------------------------------------------------------------
+
+using namespace std;
+
+namespace PB_CALC
+{
+	class CRPNJit
+	{
+	public:
+		CRPNJit();
+		~CRPNJit();
+		bool compile(const CRPNProgram& program);
+		void clear();
+		bool run(double* registers);
+		static bool supported();
+
+		bool ready() const { return m_code != nullptr; }
+		size_t inputs() const { return m_inputs; }
+		size_t outputs() const { return m_outputs; }
+		bool clearsStack() const { return m_clearsStack; }
+		// inputs()/outputs() values, bottom first
+		double* frame() { return m_frame.data(); }
+
+	private:
+		CRPNJit(const CRPNJit&);
+		CRPNJit& operator=(const CRPNJit&);
+
+		unsigned char* m_code;
+		size_t m_codeSize;
+		size_t m_inputs;
+		size_t m_outputs;
+		bool m_clearsStack;
+		vector<double> m_frame;
+	};
+}
+
+#endif
@@ -0,0 +1,284 @@
+#include "rpnLibrary.h"
+#include "rpnMappedFile.h"
+#include "rpnRegisters.h"
+#include <cctype>
+#include <unordered_set>
+//-------------------------------------------------------------------------------------------
+//    Class:		CRPNLibrary
+//
+//    File:			rpnLibrary.cpp
+//
+//    Description:	This file contains the function definitions for
+//					CRPNLibrary
+//
+//    Programmer:	Han Jung
+//
+//    Date:			10/17/2026
+//
+//    Version:		1.0
+//
+//    Environment:	Intel Xeon PC
+//                  Software:   MS Windows 10 for execution;
+//                  Compiles under Microsoft Visual C++ 2017 (/std:c++17)
+//
+//	  class:		CRPNLibrary
+//
+//	  Properties:
+//				unordered_map<string, int> m_slots;
+//				vector<SLibraryProgram> m_programs;
+//
+//	  Non-inline Methods:
+//				CRPNLibrary();
+//				void assign(const CRPNLibrary& source);
+//				int slot(string_view name);
+//				int find(string_view name) const;
+//				bool define(string_view name, string_view text,
+//					CRPNRegisterNames& names);
+//				bool load(string_view text, CRPNRegisterNames& names);
+//
+//				private:
+//					static bool fold(string_view name, string& key);
+//
+//    History Log:
+//				10/17/2026	HJ resident library of named programs, version 1.0
+//				10/17/2026	HJ assign(), version 1.1
+// ----------------------------------------------------------------------------
+namespace PB_CALC
+{
+	//-------------------------------------------------------------------------
+	//		method:			CRPNLibrary()
+	//		description:	constructor; no programs, and no memory until
+	//						the first name is given a slot
+	//		calls:			n/a
+	//		called by:		CRPNEngine()
+	//		parameters:		n/a
+	//		returns:		n/a
+	//		History Log:
+	//					10/17/2026 HJ completed version 1.0
+	// -------------------------------------------------------------------------
+	CRPNLibrary::CRPNLibrary()
+	{
+	}
+	//-------------------------------------------------------------------------
+	//		method:			assign(const CRPNLibrary& source)
+	//		description:	makes the library a copy of source, compiled
+	//						code and all, so nothing is parsed or compiled
+	//						again.  The code keeps source's register slots:
+	//						the names must be copied along with it.
+	//		calls:			splitLines()
+	//						CRPNProgram::assign()
+	//		called by:		CRPNEngine::copyLibrary()
+	//		parameters:		const CRPNLibrary& source -- the library to
+	//						copy
+	//		returns:		n/a
+	//		History Log:
+	//					10/17/2026 HJ completed version 1.0
+	// -------------------------------------------------------------------------
+	void CRPNLibrary::assign(const CRPNLibrary& source)
+	{
+		if (&source == this)
+			return;
+		m_slots = source.m_slots;
+		m_programs.clear();
+		if (!source.m_programs.empty())
+			m_programs.reserve(MAXPROGRAMS);
+		for (const SLibraryProgram& from : source.m_programs)
+		{
+			m_programs.emplace_back();
+			SLibraryProgram& program = m_programs.back();
+			program.name = from.name;
+			program.text = from.text;
+			// the views must be of this copy of the text
+			splitLines(program.text, program.lines);
+			program.compiled.assign(from.compiled);
+			program.optimized.assign(from.optimized);
+			program.defined = from.defined;
+		}
+	}
+	//-------------------------------------------------------------------------
+	//		method:			slot(string_view name)
+	//		description:	the slot of a program, giving the name the next
+	//						free slot, with no code yet, if it has none.
+	//						The first slot reserves room for MAXPROGRAMS,
+	//						so giving out another never moves the others.
+	//		calls:			fold()
+	//		called by:		define()
+	//						CRPNProgram::compileLine()
+	//		parameters:		string_view name -- the name, without "R:"
+	//		returns:		int -- the slot, or -1 if the name is not valid
+	//						or MAXPROGRAMS names have slots
+	//		History Log:
+	//					10/17/2026 HJ completed version 1.0
+	// -------------------------------------------------------------------------
+	int CRPNLibrary::slot(string_view name)
+	{
+		string key;
+		if (!fold(name, key))
+			return -1;
+		unordered_map<string, int>::const_iterator it = m_slots.find(key);
+		if (it != m_slots.end())
+			return it->second;
+		if (m_programs.size() >= MAXPROGRAMS)
+			return -1;
+		if (m_programs.empty())
+			m_programs.reserve(MAXPROGRAMS);
+		const int slot = static_cast<int>(m_programs.size());
+		m_programs.emplace_back();
+		m_programs.back().name = key;
+		m_programs.back().defined = false;
+		m_slots.emplace(move(key), slot);
+		return slot;
+	}
+	//-------------------------------------------------------------------------
+	//		method:			find(string_view name) const
+	//		description:	the slot of a program, without giving it one
+	//		calls:			fold()
+	//		called by:		CRPNEngine::parse()
+	//						embedding code
+	//		parameters:		string_view name -- the name
+	//		returns:		int -- the slot, or -1 if the name has none
+	//		History Log:
+	//					10/17/2026 HJ completed version 1.0
+	// -------------------------------------------------------------------------
+	int CRPNLibrary::find(string_view name) const
+	{
+		string key;
+		if (!fold(name, key))
+			return -1;
+		unordered_map<string, int>::const_iterator it = m_slots.find(key);
+		return (it == m_slots.end()) ? -1 : it->second;
+	}
+	//-------------------------------------------------------------------------
+	//		method:			define(string_view name, string_view text,
+	//							CRPNRegisterNames& names)
+	//		description:	gives a program its code: the text is copied,
+	//						compiled and optimized, and replaces whatever
+	//						the slot held.  Must not be called while the
+	//						engine is running the program.
+	//		calls:			slot()
+	//						splitLines()
+	//						CRPNProgram::compile()
+	//						CRPNProgram::optimize()
+	//		called by:		load()
+	//						CRPNEngine::defineProgram()
+	//		parameters:		string_view name -- the program's name
+	//						string_view text -- its lines, ending in LF or
+	//						CRLF
+	//						CRPNRegisterNames& names -- gives named
+	//						registers their slots
+	//		returns:		bool -- false if the name cannot have a slot
+	//		History Log:
+	//					10/17/2026 HJ completed version 1.0
+	// -------------------------------------------------------------------------
+	bool CRPNLibrary::define(string_view name, string_view text,
+		CRPNRegisterNames& names)
+	{
+		const int index = slot(name);
+		if (index < 0)
+			return false;
+		// compiling may give other names slots, which the reserve keeps
+		// from moving this one
+		SLibraryProgram& program = m_programs[index];
+		program.text.assign(text.data(), text.size());
+		splitLines(program.text, program.lines);
+		program.compiled.compile(program.lines, names, this);
+		program.optimized.optimize(program.compiled);
+		program.defined = true;
+		return true;
+	}
+	//-------------------------------------------------------------------------
+	//		method:			load(string_view text, CRPNRegisterNames& names)
+	//		description:	defines the programs of a library file: each
+	//						"[name]" line starts a program, which runs to
+	//						the next one or the end.  Blank lines before
+	//						the first are skipped.  Nothing is defined
+	//						unless every name is valid and has a slot free.
+	//		calls:			splitLines()
+	//						slot()
+	//						define()
+	//		called by:		CRPNEngine::loadLibrary()
+	//		parameters:		string_view text -- the library file
+	//						CRPNRegisterNames& names -- gives named
+	//						registers their slots
+	//		returns:		bool -- false if the file has text before its
+	//						first program, a name that is not valid, or
+	//						more programs than there are slots
+	//		History Log:
+	//					10/17/2026 HJ completed version 1.0
+	// -------------------------------------------------------------------------
+	bool CRPNLibrary::load(string_view text, CRPNRegisterNames& names)
+	{
+		struct SSection
+		{
+			string_view name;
+			const char* first;	// the program's text
+			const char* last;
+		};
+		vector<string_view> lines;
+		splitLines(text, lines);
+		vector<SSection> sections;
+		unordered_set<string> added;	// names new to the library
+		string key;
+		for (string_view line : lines)
+		{
+			if (line.size() >= 2 && line.front() == '['
+				&& line.back() == ']')
+			{
+				SSection section;
+				section.name = line.substr(1, line.size() - 2);
+				section.first = line.data() + line.size();
+				section.last = section.first;
+				if (!fold(section.name, key))
+					return false;
+				if (m_slots.find(key) == m_slots.end())
+					added.insert(key);
+				sections.push_back(section);
+			}
+			else if (!sections.empty())
+				sections.back().last = line.data() + line.size();
+			else if (line.find_first_not_of(" \t") != string_view::npos)
+				return false;
+		}
+		if (m_programs.size() + added.size() > MAXPROGRAMS)
+			return false;
+		for (const SSection& section : sections)
+		{
+			// the text starts after the header's line break
+			const char* first = section.first;
+			while (first < section.last && (*first == '\r' || *first == '\n'))
+				first++;
+			define(section.name, string_view(first,
+				static_cast<size_t>(section.last - first)), names);
+		}
+		return true;
+	}
+	//-------------------------------------------------------------------------
+	//		method:			fold(string_view name, string& key)
+	//		description:	checks a name and gives its upper case form
+	//		calls:			n/a
+	//		called by:		slot()
+	//						find()
+	//						load()
+	//		parameters:		string_view name -- the name
+	//						string& key -- receives it in upper case
+	//		returns:		bool -- false if the name is empty, longer than
+	//						MAXREGNAME or has a character other than a
+	//						letter, digit or '_'
+	//		History Log:
+	//					10/17/2026 HJ completed version 1.0
+	// -------------------------------------------------------------------------
+	bool CRPNLibrary::fold(string_view name, string& key)
+	{
+		if (name.empty() || name.size() > MAXREGNAME)
+			return false;
+		key.assign(name.data(), name.size());
+		for (char& c : key)
+		{
+			const unsigned char u = static_cast<unsigned char>(c);
+			if (!isalnum(u) && u != '_')
+				return false;
+			c = static_cast<char>(toupper(u));
+		}
+		return true;
+	}
+}
@@ -0,0 +1,123 @@
+//----------------------------------------------------------------------------
+//    File:		rpnLibrary.h
+//
+//    Class:	CRPNLibrary
+//----------------------------------------------------------------------------
+#ifndef RPNLIBRARY_H
+#define RPNLIBRARY_H
+
+#include <cstddef>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+#include "rpnProgram.h"
+//----------------------------------------------------------------------------
+//
+//    Title:		RPNLibrary Class
+//
+//    Description:	This file contains the class definition for
+//					CRPNLibrary, an engine's resident programs.  Each
+//					program has a name and a slot, and is compiled and
+//					optimized when it is defined, so running it, or
+//					switching from one program to another, never reads a
+//					file or parses text.  "R:name" runs one, from the
+//					keyboard or from another program; a program compiles
+//					the slot of the name, not the name, so programs call
+//					each other without a lookup.  A name gets its slot
+//					the first time it is used, so a program can call one
+//					that is defined after it.
+//
+//					A library file holds any number of programs, each
+//					after a "[name]" line, and is loaded with load() at
+//					startup.  Names follow the rules for register names.
+//
+//    Programmer:	Han Jung
+//
+//    Date:			10/17/2026
+//
+//    Version:		1.0
+//
+//    Environment:
+//       Hardware: Intel Xeon PC
+//       Software: Windows 10
+//       Compiles under Microsoft Visual C++ 2017 (/std:c++17)
+//
+//	  class CRPNLibrary:
+//
+//	  Properties:
+//		unordered_map<string, int> m_slots -- slot of each name, upper
+//			case
+//		vector<SLibraryProgram> m_programs -- the programs by slot;
+//			MAXPROGRAMS are reserved with the first, so a program stays
+//			put while it runs
+//
+//	  Methods:
+//
+//		inline:
+//			const SLibraryProgram& program(int slot) const;
+//			size_t size() const;
+//
+//		non-inline:
+//		public:
+//			CRPNLibrary();
+//			void assign(const CRPNLibrary& source);
+//			int slot(string_view name);
+//			int find(string_view name) const;
+//			bool define(string_view name, string_view text,
+//				CRPNRegisterNames& names);
+//			bool load(string_view text, CRPNRegisterNames& names);
+//		private:
+//			static bool fold(string_view name, string& key);
+//
+//    History Log:
+//			10/17/2026	HJ  resident library of named programs, version 1.0
+//			10/17/2026	HJ  assign(), version 1.1
+// ----------------------------------------------------------------------------
+
+using namespace std;
+
+namespace PB_CALC
+{
+	const size_t MAXPROGRAMS = 256;
+
+	struct SLibraryProgram
+	{
+		string name;				// as first used, upper case
+		string text;				// the program's lines
+		vector<string_view> lines;	// views of text
+		CRPNProgram compiled;
+		CRPNProgram optimized;
+		bool defined;				// false until define() gives it code
+	};
+
+	class CRPNLibrary
+	{
+	public:
+		CRPNLibrary();
+		void assign(const CRPNLibrary& source);
+		int slot(string_view name);
+		int find(string_view name) const;
+		bool define(string_view name, string_view text,
+			CRPNRegisterNames& names);
+		bool load(string_view text, CRPNRegisterNames& names);
+
+		const SLibraryProgram& program(int slot) const
+		{
+			return m_programs[slot];
+		}
+		// names given a slot so far, defined or not
+		size_t size() const { return m_programs.size(); }
+
+	private:
+		CRPNLibrary(const CRPNLibrary&);
+		CRPNLibrary& operator=(const CRPNLibrary&);
+
+		static bool fold(string_view name, string& key);
+
+		unordered_map<string, int> m_slots;
+		vector<SLibraryProgram> m_programs;
+	};
+}
+
+#endif
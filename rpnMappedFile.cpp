@@ -0,0 +1,228 @@
+#include "rpnMappedFile.h"
+#include <cstdint>
+#include <cstring>
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+//-------------------------------------------------------------------------------------------
+//    Class:		CRPNMappedFile
+//
+//    File:			rpnMappedFile.cpp
+//
+//    Description:	This file contains the function definitions for
+//					CRPNMappedFile
+//
+//    Programmer:	Han Jung
+//
+//    Date:			10/17/2026
+//
+//    Version:		1.0
+//
+//    Environment:	Intel Xeon PC
+//                  Software:   MS Windows 10 for execution;
+//                  Compiles under Microsoft Visual C++ 2017 (/std:c++17)
+//
+//	  class:		CRPNMappedFile
+//
+//	  Properties:
+//				const char* m_data;
+//				size_t m_size;
+//				bool m_open;
+//				void* m_file;		(Windows)
+//				void* m_mapping;	(Windows)
+//
+//	  Non-inline Methods:
+//				CRPNMappedFile();
+//				~CRPNMappedFile();
+//				bool open(const string& filename);
+//				void close();
+//
+//	  related functions:
+//				void splitLines(string_view text, vector<string_view>& lines);
+//
+//    History Log:
+//				10/17/2026	HJ memory-mapped program and batch files, version 1.0
+//				10/17/2026	HJ splitLines() stays inside the text, version 1.1
+// ----------------------------------------------------------------------------
+namespace PB_CALC
+{
+	//-------------------------------------------------------------------------
+	//		method:			CRPNMappedFile()
+	//		description:	constructor; nothing is mapped
+	//		calls:			n/a
+	//		called by:		CRPNEngine()
+	//		parameters:		n/a
+	//		returns:		n/a
+	//		History Log:
+	//					10/17/2026 HJ completed version 1.0
+	// -------------------------------------------------------------------------
+	CRPNMappedFile::CRPNMappedFile() : m_data(nullptr), m_size(0),
+		m_open(false)
+#ifdef _WIN32
+		, m_file(INVALID_HANDLE_VALUE), m_mapping(nullptr)
+#endif
+	{
+	}
+	//-------------------------------------------------------------------------
+	//		method:			~CRPNMappedFile()
+	//		description:	destructor; unmaps the file
+	//		calls:			close()
+	//		called by:		n/a
+	//		parameters:		n/a
+	//		returns:		n/a
+	//		History Log:
+	//					10/17/2026 HJ completed version 1.0
+	// -------------------------------------------------------------------------
+	CRPNMappedFile::~CRPNMappedFile()
+	{
+		close();
+	}
+	//-------------------------------------------------------------------------
+	//		method:			open(const string& filename)
+	//		description:	maps filename read-only, replacing any earlier
+	//						mapping.  An empty file opens with empty data.
+	//		calls:			close()
+	//		called by:		CRPNEngine::loadProgramFile()
+	//						main()
+	//		parameters:		const string& filename -- the file to map
+	//		returns:		bool -- false if the file could not be mapped
+	//		History Log:
+	//					10/17/2026 HJ completed version 1.0
+	// -------------------------------------------------------------------------
+	bool CRPNMappedFile::open(const string& filename)
+	{
+		close();
+#ifdef _WIN32
+		HANDLE file = CreateFileA(filename.c_str(), GENERIC_READ,
+			FILE_SHARE_READ, nullptr, OPEN_EXISTING,
+			FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+		if (file == INVALID_HANDLE_VALUE)
+			return false;
+		LARGE_INTEGER size;
+		if (!GetFileSizeEx(file, &size)
+			|| static_cast<unsigned long long>(size.QuadPart) > SIZE_MAX)
+		{
+			CloseHandle(file);
+			return false;
+		}
+		m_file = file;
+		m_size = static_cast<size_t>(size.QuadPart);
+		if (m_size > 0)
+		{
+			m_mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0,
+				nullptr);
+			if (m_mapping != nullptr)
+				m_data = static_cast<const char*>(
+					MapViewOfFile(m_mapping, FILE_MAP_READ, 0, 0, 0));
+			if (m_data == nullptr)
+			{
+				close();
+				return false;
+			}
+		}
+#else
+		int fd = ::open(filename.c_str(), O_RDONLY);
+		if (fd < 0)
+			return false;
+		struct stat info;
+		if (fstat(fd, &info) != 0 || !S_ISREG(info.st_mode))
+		{
+			::close(fd);
+			return false;
+		}
+		m_size = static_cast<size_t>(info.st_size);
+		if (m_size > 0)
+		{
+			void* data = mmap(nullptr, m_size, PROT_READ, MAP_PRIVATE, fd, 0);
+			if (data == MAP_FAILED)
+			{
+				::close(fd);
+				m_size = 0;
+				return false;
+			}
+			madvise(data, m_size, MADV_SEQUENTIAL);
+			m_data = static_cast<const char*>(data);
+		}
+		// the mapping stays valid without the descriptor
+		::close(fd);
+#endif
+		m_open = true;
+		return true;
+	}
+	//-------------------------------------------------------------------------
+	//		method:			close()
+	//		description:	unmaps the file; views into it become invalid
+	//		calls:			n/a
+	//		called by:		open()
+	//						~CRPNMappedFile()
+	//		parameters:		n/a
+	//		returns:		n/a
+	//		History Log:
+	//					10/17/2026 HJ completed version 1.0
+	// -------------------------------------------------------------------------
+	void CRPNMappedFile::close()
+	{
+#ifdef _WIN32
+		if (m_data != nullptr)
+			UnmapViewOfFile(m_data);
+		if (m_mapping != nullptr)
+			CloseHandle(m_mapping);
+		if (m_file != INVALID_HANDLE_VALUE)
+			CloseHandle(m_file);
+		m_mapping = nullptr;
+		m_file = INVALID_HANDLE_VALUE;
+#else
+		if (m_data != nullptr)
+			munmap(const_cast<char*>(m_data), m_size);
+#endif
+		m_data = nullptr;
+		m_size = 0;
+		m_open = false;
+	}
+	//-------------------------------------------------------------------------
+	//		function:		splitLines(string_view text,
+	//							vector<string_view>& lines)
+	//		description:	replaces lines with views of the lines of text.
+	//						A '\n' ends a line and a '\r' just before it is
+	//						dropped, so files with either line ending give
+	//						the same lines.  A final line without a '\n'
+	//						counts; there is no empty line after a final
+	//						'\n'.
+	//		calls:			memchr()
+	//		called by:		CRPNEngine::loadProgramFile()
+	//						CRPNBatch
+	//		parameters:		string_view text -- the text to split
+	//						vector<string_view>& lines -- receives the lines
+	//		returns:		n/a
+	//		History Log:
+	//					10/17/2026 HJ completed version 1.0
+	//					10/17/2026 HJ no pointer past the end after a
+	//						final line without '\n', version 1.1
+	// -------------------------------------------------------------------------
+	void splitLines(string_view text, vector<string_view>& lines)
+	{
+		lines.clear();
+		const char* p = text.data();
+		const char* const end = p + text.size();
+		while (p < end)
+		{
+			const char* newline = static_cast<const char*>(
+				memchr(p, '\n', end - p));
+			if (newline == nullptr)
+				newline = end;
+			const char* lineEnd = newline;
+			if (lineEnd > p && lineEnd[-1] == '\r')
+				lineEnd--;
+			lines.push_back(string_view(p, lineEnd - p));
+			if (newline == end)
+				break;
+			p = newline + 1;
+		}
+	}
+}
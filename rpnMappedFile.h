@@ -0,0 +1,93 @@
+//----------------------------------------------------------------------------
+//    File:		rpnMappedFile.h
+//
+//    Class:	CRPNMappedFile
+//----------------------------------------------------------------------------
+#ifndef RPNMAPPEDFILE_H
+#define RPNMAPPEDFILE_H
+
+#include <cstddef>
+#include <string>
+#include <string_view>
+#include <vector>
+//----------------------------------------------------------------------------
+//
+//    Title:		RPNMappedFile Class
+//
+//    Description:	This file contains the class definition for
+//					CRPNMappedFile, a read-only memory mapping of a whole
+//					file.  Loading a file this way costs page faults, not
+//					reads and allocations; lines are handed out as
+//					string_views into the mapping.
+//
+//    Programmer:	Han Jung
+//
+//    Date:			10/17/2026
+//
+//    Version:		1.0
+//
+//    Environment:
+//       Hardware: Intel Xeon PC
+//       Software: Windows 10 (file mapping), Linux (mmap)
+//       Compiles under Microsoft Visual C++ 2017 (/std:c++17)
+//
+//	  class CRPNMappedFile:
+//
+//	  Properties:
+//		const char* m_data -- start of the mapping, nullptr if none
+//		size_t m_size -- length of the file
+//		bool m_open -- a file is open (it may be empty)
+//		void* m_file -- Windows only: file handle
+//		void* m_mapping -- Windows only: mapping handle
+//
+//	  Methods:
+//
+//		inline:
+//			bool isOpen() const;
+//			string_view data() const;
+//
+//		non-inline:
+//		public:
+//			CRPNMappedFile();
+//			~CRPNMappedFile();
+//			bool open(const string& filename);
+//			void close();
+//
+//	  related functions:
+//			void splitLines(string_view text, vector<string_view>& lines);
+//
+//    History Log:
+//			10/17/2026	HJ  memory-mapped program and batch files, version 1.0
+// ----------------------------------------------------------------------------
+
+using namespace std;
+
+namespace PB_CALC
+{
+	class CRPNMappedFile
+	{
+	public:
+		CRPNMappedFile();
+		~CRPNMappedFile();
+		bool open(const string& filename);
+		void close();
+		bool isOpen() const { return m_open; }
+		string_view data() const { return string_view(m_data, m_size); }
+
+	private:
+		CRPNMappedFile(const CRPNMappedFile&);
+		CRPNMappedFile& operator=(const CRPNMappedFile&);
+
+		const char* m_data;
+		size_t m_size;
+		bool m_open;
+#ifdef _WIN32
+		void* m_file;
+		void* m_mapping;
+#endif
+	};
+
+	void splitLines(string_view text, vector<string_view>& lines);
+}
+
+#endif
@@ -0,0 +1,862 @@
+#include "rpnNumeric.h"
+#include <algorithm>
+#include <cctype>
+#include <cfloat>
+#include <charconv>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include "rpnMappedFile.h"
+//-------------------------------------------------------------------------------------------
+//    Class:		CRPNNumericEngine
+//					CRPNTypedEngine<T>
+//
+//    File:			rpnNumeric.cpp
+//
+//    Description:	This file contains the function definitions for
+//					CRPNNumericEngine and CRPNTypedEngine<T>.  What differs
+//					between number types -- converting a literal, the
+//					arithmetic and its errors, formatting -- is in
+//					SNumber<T>; the engine itself is written once and
+//					instantiated here for double, long double and
+//					CRPNDecimal.
+//
+//    Programmer:	Han Jung
+//
+//    Date:			10/17/2026
+//
+//    Version:		1.0
+//
+//    Environment:	Intel Xeon PC
+//                  Software:   MS Windows 10 for execution;
+//                  Compiles under Microsoft Visual C++ 2017 (/std:c++17)
+//
+//	  class:		CRPNNumericEngine
+//
+//	  Properties:
+//				unsigned m_precision;
+//
+//	  Non-inline Methods:
+//				virtual ~CRPNNumericEngine();
+//				void setPrecision(unsigned digits);
+//
+//				protected:
+//					CRPNNumericEngine(unsigned precision);
+//
+//	  class:		CRPNTypedEngine<T>
+//
+//	  Properties:
+//				vector<T> m_stack;
+//				vector<T> m_registers;
+//				CRPNRegisterNames m_registerNames;
+//				CRPNArena m_programText;
+//				vector<string_view> m_program;
+//				bool m_error;
+//				int m_runDepth;
+//
+//	  Non-inline Methods:
+//				CRPNTypedEngine(unsigned precision);
+//				EvalResult evaluate(string_view line, string& top);
+//				void setProgram(const list<string>& program);
+//				void reset();
+//				size_t depth() const;
+//				NumericMode mode() const;
+//				void push(const T& value);
+//
+//				private:
+//					void parse(string_view line);
+//					void binary(OpCode op);
+//					bool binary_prep(T& d1, T& d2);
+//					void neg();
+//					int registerSlot(const SToken& token);
+//					void rotateUp(int count);
+//					void rotateDown(int count);
+//					void runProgram();
+//
+//	  related functions:
+//				unique_ptr<CRPNNumericEngine> createNumericEngine(
+//					NumericMode mode, unsigned precision);
+//				bool parseNumericMode(string_view text, NumericMode& mode,
+//					unsigned& precision);
+//
+//    History Log:
+//				10/17/2026	HJ long double and decimal engines, version 1.0
+//				10/17/2026	HJ U:k and D:k, D fixed, version 1.1
+//				10/17/2026	HJ operators from CRPNOperators, version 1.2
+//				10/17/2026	HJ labels and branches rejected, version 1.3
+//				10/17/2026	HJ R:name rejected, version 1.4
+//				10/17/2026	HJ freezes the operator table, version 1.5
+//				10/17/2026	HJ program lines split as in CRPNEngine,
+//							version 1.6
+// ----------------------------------------------------------------------------
+namespace PB_CALC
+{
+	namespace
+	{
+		//--------------------------------------------------------------------
+		//	Function:		applyFloat(OpCode op, F d1, F d2, F& result)
+		//	Description:	a binary operator on a floating-point type, with
+		//					the errors CRPNEngine raises: divide or mod by
+		//					zero, and 0^0.  Anything else gives an IEEE
+		//					result, which may be an infinity or NaN.
+		//	Returns:		false on one of those errors
+		//--------------------------------------------------------------------
+		template <class F>
+		bool applyFloat(OpCode op, F d1, F d2, F& result)
+		{
+			switch (op)
+			{
+			case OP_ADD: result = d1 + d2; return true;
+			case OP_SUBTRACT: result = d1 - d2; return true;
+			case OP_MULTIPLY: result = d1 * d2; return true;
+			case OP_DIVIDE:
+				if (d2 == 0)
+					return false;
+				result = d1 / d2;
+				return true;
+			case OP_EXP:
+				if (d1 == 0 && d2 == 0)
+					return false;
+				result = pow(d1, d2);
+				return true;
+			case OP_MOD:
+				if (d2 == 0)
+					return false;
+				result = fmod(d1, d2);
+				return true;
+			default:
+				return false;
+			}
+		}
+
+		template <class T>
+		struct SNumber;
+
+		template <>
+		struct SNumber<double>
+		{
+			static NumericMode mode() { return NUM_DOUBLE; }
+
+			// the tokenizer has already converted it
+			static bool fromToken(const SToken& token, unsigned, double& value)
+			{
+				value = token.value;
+				return true;
+			}
+
+			static bool apply(OpCode op, const double& d1, const double& d2,
+				unsigned, double& result)
+			{
+				return applyFloat(op, d1, d2, result);
+			}
+
+			static void negate(double& d)
+			{
+				d *= -1.0;
+			}
+
+			static void format(const double& d, string& text)
+			{
+				char buffer[NUMBERSIZE];
+				text.assign(buffer, formatNumber(d, buffer, sizeof buffer));
+			}
+		};
+
+		template <>
+		struct SNumber<long double>
+		{
+			static NumericMode mode() { return NUM_LONGDOUBLE; }
+
+			//----------------------------------------------------------------
+			//	Function:		fromToken(const SToken& token, unsigned,
+			//						long double& value)
+			//	Description:	converts the literal's text, correctly
+			//					rounded.  A literal out of range for long
+			//					double is out of range for double too, so
+			//					the tokenizer's +-HUGE_VAL or +-0 is used.
+			//	Returns:		true
+			//----------------------------------------------------------------
+			static bool fromToken(const SToken& token, unsigned,
+				long double& value)
+			{
+				const char* first = token.text.data();
+				const char* last = first + token.text.size();
+#if defined(__cpp_lib_to_chars)
+				if (from_chars(first, last, value).ec
+					== errc::result_out_of_range)
+					value = token.value;
+#else
+				const string literal(first, last);
+				value = strtold(literal.c_str(), nullptr);
+#endif
+				return true;
+			}
+
+			static bool apply(OpCode op, const long double& d1,
+				const long double& d2, unsigned, long double& result)
+			{
+				return applyFloat(op, d1, d2, result);
+			}
+
+			static void negate(long double& d)
+			{
+				d *= -1.0L;
+			}
+
+			//----------------------------------------------------------------
+			//	Function:		format(const long double& d, string& text)
+			//	Description:	the shortest text that reads back as d, as
+			//					formatNumber() does for double
+			//----------------------------------------------------------------
+			static void format(const long double& d, string& text)
+			{
+				char buffer[2 * NUMBERSIZE];
+#if defined(__cpp_lib_to_chars)
+				to_chars_result result = to_chars(buffer,
+					buffer + sizeof buffer, d);
+				text.assign(buffer, (result.ec == errc())
+					? static_cast<size_t>(result.ptr - buffer) : 0);
+#else
+				int length = snprintf(buffer, sizeof buffer, "%Lg", d);
+				if (isfinite(d))
+					for (int precision = (fabsl(d) < LDBL_MIN) ? 1 : LDBL_DIG;
+						precision <= LDBL_DIG + 4; precision++)
+					{
+						length = snprintf(buffer, sizeof buffer, "%.*Lg",
+							precision, d);
+						if (length < 0 || strtold(buffer, nullptr) == d)
+							break;
+					}
+				text.assign(buffer, (length < 0) ? 0 : length);
+#endif
+			}
+		};
+
+		template <>
+		struct SNumber<CRPNDecimal>
+		{
+			static NumericMode mode() { return NUM_DECIMAL; }
+
+			// exact, then rounded to the precision
+			static bool fromToken(const SToken& token, unsigned precision,
+				CRPNDecimal& value)
+			{
+				return CRPNDecimal::parse(token.text, precision, value);
+			}
+
+			static bool apply(OpCode op, const CRPNDecimal& d1,
+				const CRPNDecimal& d2, unsigned precision, CRPNDecimal& result)
+			{
+				switch (op)
+				{
+				case OP_ADD:
+					return CRPNDecimal::add(d1, d2, precision, result);
+				case OP_SUBTRACT:
+					return CRPNDecimal::subtract(d1, d2, precision, result);
+				case OP_MULTIPLY:
+					return CRPNDecimal::multiply(d1, d2, precision, result);
+				case OP_DIVIDE:
+					return CRPNDecimal::divide(d1, d2, precision, result);
+				case OP_EXP:
+					return CRPNDecimal::power(d1, d2, precision, result);
+				case OP_MOD:
+					return CRPNDecimal::mod(d1, d2, precision, result);
+				default:
+					return false;
+				}
+			}
+
+			static void negate(CRPNDecimal& d)
+			{
+				d.negate();
+			}
+
+			static void format(const CRPNDecimal& d, string& text)
+			{
+				d.format(text);
+			}
+		};
+	}
+
+	//-------------------------------------------------------------------------
+	//		method:			CRPNNumericEngine(unsigned precision)
+	//		description:	constructor
+	//		calls:			setPrecision()
+	//		called by:		CRPNTypedEngine<T>()
+	//		parameters:		unsigned precision -- significant digits of
+	//						decimal results
+	//		returns:		n/a
+	//		History Log:
+	//					10/17/2026 HJ completed version 1.0
+	// -------------------------------------------------------------------------
+	CRPNNumericEngine::CRPNNumericEngine(unsigned precision)
+		: m_precision(DEFAULTPRECISION)
+	{
+		setPrecision(precision);
+	}
+	//-------------------------------------------------------------------------
+	//		method:			~CRPNNumericEngine()
+	//		description:	destructor
+	//		calls:			n/a
+	//		called by:		n/a
+	//		parameters:		n/a
+	//		returns:		n/a
+	//		History Log:
+	//					10/17/2026 HJ completed version 1.0
+	// -------------------------------------------------------------------------
+	CRPNNumericEngine::~CRPNNumericEngine()
+	{
+	}
+	//-------------------------------------------------------------------------
+	//		method:			setPrecision(unsigned digits)
+	//		description:	sets the significant digits decimal results
+	//						keep, from 1 to MAXPRECISION.  Values already on
+	//						the stack keep their digits until they are used.
+	//		calls:			n/a
+	//		called by:		CRPNNumericEngine()
+	//						embedding code
+	//		parameters:		unsigned digits -- the precision; clamped
+	//		returns:		n/a
+	//		History Log:
+	//					10/17/2026 HJ completed version 1.0
+	// -------------------------------------------------------------------------
+	void CRPNNumericEngine::setPrecision(unsigned digits)
+	{
+		m_precision = (digits < 1) ? 1
+			: (digits > MAXPRECISION) ? MAXPRECISION : digits;
+	}
+	//-------------------------------------------------------------------------
+	//		method:			CRPNTypedEngine(unsigned precision)
+	//		description:	constructor; an empty stack and zeroed
+	//						registers.  Freezes the operator table.
+	//		calls:			CRPNNumericEngine()
+	//						CRPNOperators::freeze()
+	//		called by:		createNumericEngine()
+	//						embedding code
+	//		parameters:		unsigned precision -- significant digits of
+	//						decimal results
+	//		returns:		n/a
+	//		History Log:
+	//					10/17/2026 HJ completed version 1.0
+	//					10/17/2026 HJ freezes the operator table, version 1.1
+	// -------------------------------------------------------------------------
+	template <class T>
+	CRPNTypedEngine<T>::CRPNTypedEngine(unsigned precision)
+		: CRPNNumericEngine(precision), m_registers(NUMREGS), m_error(false),
+		m_runDepth(0)
+	{
+		CRPNOperators::freeze();
+	}
+	//-------------------------------------------------------------------------
+	//		method:			evaluate(string_view line, string& top)
+	//		description:	parses line as CRPNEngine::evaluate() does and
+	//						formats the top of the stack.  Clears the error
+	//						flag.
+	//		calls:			parse()
+	//						SNumber<T>::format()
+	//		called by:		embedding code
+	//		parameters:		string_view line -- the commands to run
+	//						string& top -- receives the top of the stack
+	//						when the result is EVAL_OK
+	//		returns:		EvalResult -- EVAL_OK, EVAL_EMPTY if the stack is
+	//						empty, or EVAL_ERROR
+	//		History Log:
+	//					10/17/2026 HJ completed version 1.0
+	// -------------------------------------------------------------------------
+	template <class T>
+	EvalResult CRPNTypedEngine<T>::evaluate(string_view line, string& top)
+	{
+		parse(line);
+		if (m_error)
+		{
+			m_error = false;
+			return EVAL_ERROR;
+		}
+		if (m_stack.empty())
+			return EVAL_EMPTY;
+		SNumber<T>::format(m_stack.back(), top);
+		return EVAL_OK;
+	}
+	//-------------------------------------------------------------------------
+	//		method:			setProgram(const list<string>& program)
+	//		description:	replaces the program R runs.  The lines are
+	//						copied into m_programText, which is reset
+	//						first, and split as CRPNEngine::setProgram()
+	//						splits them, so a string holding several
+	//						lines is several program lines.
+	//		calls:			CRPNArena::reset()
+	//						CRPNArena::allocate()
+	//						splitLines()
+	//		called by:		embedding code
+	//		parameters:		const list<string>& program -- the program lines
+	//		returns:		n/a
+	//		History Log:
+	//					10/17/2026 HJ completed version 1.0
+	//					10/17/2026 HJ lines in an arena, version 1.1
+	//					10/17/2026 HJ lines split as in CRPNEngine, version 1.2
+	// -------------------------------------------------------------------------
+	template <class T>
+	void CRPNTypedEngine<T>::setProgram(const list<string>& program)
+	{
+		size_t size = 0;
+		for (const string& line : program)
+			size += line.size() + 1;
+		m_programText.reset();
+		char* text = static_cast<char*>(m_programText.allocate(size, 1));
+		char* next = text;
+		for (const string& line : program)
+		{
+			memcpy(next, line.data(), line.size());
+			next += line.size();
+			*next++ = '\n';
+		}
+		splitLines(string_view(text, size), m_program);
+	}
+	//-------------------------------------------------------------------------
+	//		method:			reset()
+	//		description:	empties the stack, zeroes the registers and
+	//						clears the error flag; the program and the
+	//						register names are kept
+	//		calls:			n/a
+	//		called by:		embedding code
+	//		parameters:		n/a
+	//		returns:		n/a
+	//		History Log:
+	//					10/17/2026 HJ completed version 1.0
+	//					10/17/2026 HJ named registers, version 1.1
+	// -------------------------------------------------------------------------
+	template <class T>
+	void CRPNTypedEngine<T>::reset()
+	{
+		m_stack.clear();
+		m_registers.assign(m_registers.size(), T());
+		m_error = false;
+	}
+	//-------------------------------------------------------------------------
+	//		method:			depth()
+	//		description:	the number of values on the stack
+	//		calls:			n/a
+	//		called by:		embedding code
+	//		parameters:		n/a
+	//		returns:		size_t -- the depth
+	//		History Log:
+	//					10/17/2026 HJ completed version 1.0
+	// -------------------------------------------------------------------------
+	template <class T>
+	size_t CRPNTypedEngine<T>::depth() const
+	{
+		return m_stack.size();
+	}
+	//-------------------------------------------------------------------------
+	//		method:			mode()
+	//		description:	the number type of this engine
+	//		calls:			n/a
+	//		called by:		embedding code
+	//		parameters:		n/a
+	//		returns:		NumericMode -- the mode for T
+	//		History Log:
+	//					10/17/2026 HJ completed version 1.0
+	// -------------------------------------------------------------------------
+	template <class T>
+	NumericMode CRPNTypedEngine<T>::mode() const
+	{
+		return SNumber<T>::mode();
+	}
+	//-------------------------------------------------------------------------
+	//		method:			push(const T& value)
+	//		description:	pushes a value, as entering the number would
+	//		calls:			n/a
+	//		called by:		embedding code
+	//		parameters:		const T& value -- the value
+	//		returns:		n/a
+	//		History Log:
+	//					10/17/2026 HJ completed version 1.0
+	// -------------------------------------------------------------------------
+	template <class T>
+	void CRPNTypedEngine<T>::push(const T& value)
+	{
+		m_stack.push_back(value);
+	}
+	//-------------------------------------------------------------------------
+	//		method:			parse(string_view line)
+	//		description:	parses the commands in line, token for token as
+	//						CRPNEngine::parse() does.  A literal the type
+	//						cannot hold (a decimal exponent out of range)
+	//						is an error and pushes nothing.
+	//		calls:			CRPNTokenizer::next()
+	//						SNumber<T>::fromToken()
+	//						binary()
+	//						neg()
+	//						registerSlot()
+	//						rotateDown()
+	//						rotateUp()
+	//						runProgram()
+	//		called by:		evaluate()
+	//						runProgram()
+	//		parameters:		string_view line -- the commands to parse
+	//		returns:		n/a
+	//		History Log:
+	//					10/17/2026 HJ completed version 1.0
+	//					10/17/2026 HJ named registers, version 1.1
+	//					10/17/2026 HJ U:k and D:k, version 1.2
+	//					10/17/2026 HJ operator table, version 1.3
+	//					10/17/2026 HJ labels and branches, version 1.4
+	//					10/17/2026 HJ R:name, version 1.5
+	// -------------------------------------------------------------------------
+	template <class T>
+	void CRPNTypedEngine<T>::parse(string_view line)
+	{
+		CRPNTokenizer tokenizer(line);
+		SToken token;
+		T value = T();
+		while (tokenizer.next(token))
+		{
+			switch (token.type)
+			{
+			case TOK_NUMBER:
+			case TOK_NEGZERO:
+				if (!SNumber<T>::fromToken(token, m_precision, value))
+				{
+					m_error = true;
+					break;
+				}
+				m_stack.push_back(value);
+				if (token.type == TOK_NEGZERO)
+					neg();
+				break;
+			case TOK_CLEARALL:
+				m_stack.clear();
+				break;
+			case TOK_SETREG:
+			{
+				const int reg = registerSlot(token);
+				if (reg >= 0 && !m_stack.empty())
+					m_registers[reg] = m_stack.back();
+				else
+					m_error = true;
+				break;
+			}
+			case TOK_GETREG:
+			{
+				const int reg = registerSlot(token);
+				if (reg >= 0)
+					m_stack.push_back(m_registers[reg]);
+				else
+					m_error = true;
+				break;
+			}
+			case TOK_ROTATE:
+				if (token.op == 'U')
+					rotateUp(token.reg);
+				else
+					rotateDown(token.reg);
+				break;
+			case TOK_LABEL:
+			case TOK_BRANCH:
+			case TOK_RUNPROGRAM:
+				// programs here are run a line at a time, so there is
+				// nowhere to branch to, and there is no library
+				m_error = true;
+				break;
+			case TOK_OPERATOR:
+			{
+				const SOperator& entry = CRPNOperators::find(token.op);
+				switch (entry.op)
+				{
+				case OP_ADD:
+				case OP_SUBTRACT:
+				case OP_MULTIPLY:
+				case OP_DIVIDE:
+				case OP_EXP:
+				case OP_MOD:
+					binary(entry.op);
+					break;
+				case OP_CLEARENTRY:
+					if (!m_stack.empty())
+						m_stack.pop_back();
+					break;
+				case OP_ROTATEDOWN: rotateDown(entry.arg); break;
+				case OP_NEG: neg(); break;
+				case OP_RUN:
+					//the rest of the line is ignored, as in CRPNEngine
+					runProgram();
+					return;
+				case OP_ROTATEUP: rotateUp(entry.arg); break;
+				case OP_HELP:
+				case OP_EXIT:
+					break;
+				default:
+					// includes L, P and F: there is no shell to ask,
+					// custom operators, whose kernels work on double,
+					// and ;, as there are no calls
+					m_error = true;
+					break;
+				}
+				break;
+			}
+			}
+		}
+	}
+	//-------------------------------------------------------------------------
+	//		method:			binary(OpCode op)
+	//		description:	pops the top two values, d1 from the top and d2
+	//						below it, and pushes d1 op d2.  If op fails the
+	//						two are pushed back, d1 first.  As in
+	//						CRPNEngine, once the error flag is set the
+	//						operands are popped and dropped.
+	//		calls:			binary_prep()
+	//						SNumber<T>::apply()
+	//		called by:		parse()
+	//		parameters:		OpCode op -- OP_ADD to OP_MOD
+	//		returns:		n/a
+	//		History Log:
+	//					10/17/2026 HJ completed version 1.0
+	// -------------------------------------------------------------------------
+	template <class T>
+	void CRPNTypedEngine<T>::binary(OpCode op)
+	{
+		T d1;
+		T d2;
+		if (!binary_prep(d1, d2) || m_error)
+			return;
+		T result;
+		if (SNumber<T>::apply(op, d1, d2, m_precision, result))
+		{
+			m_stack.push_back(move(result));
+			return;
+		}
+		m_error = true;
+		m_stack.push_back(move(d1));
+		m_stack.push_back(move(d2));
+	}
+	//-------------------------------------------------------------------------
+	//		method:			binary_prep(T& d1, T& d2)
+	//		description:	pops the top two values, or sets the error and
+	//						leaves the stack alone if there are fewer
+	//		calls:			n/a
+	//		called by:		binary()
+	//		parameters:		T& d1 -- receives the top
+	//						T& d2 -- receives the value below it
+	//		returns:		bool -- false on an underflow
+	//		History Log:
+	//					10/17/2026 HJ completed version 1.0
+	// -------------------------------------------------------------------------
+	template <class T>
+	bool CRPNTypedEngine<T>::binary_prep(T& d1, T& d2)
+	{
+		if (m_stack.size() < 2)
+		{
+			m_error = true;
+			return false;
+		}
+		d1 = move(m_stack.back());
+		m_stack.pop_back();
+		d2 = move(m_stack.back());
+		m_stack.pop_back();
+		return true;
+	}
+	//-------------------------------------------------------------------------
+	//		method:			neg()
+	//		description:	negates the top of the stack, or drops it if
+	//						the error flag is set, as CRPNEngine does
+	//		calls:			SNumber<T>::negate()
+	//		called by:		parse()
+	//		parameters:		n/a
+	//		returns:		n/a
+	//		History Log:
+	//					10/17/2026 HJ completed version 1.0
+	// -------------------------------------------------------------------------
+	template <class T>
+	void CRPNTypedEngine<T>::neg()
+	{
+		if (m_stack.empty())
+			m_error = true;
+		else if (m_error)
+			m_stack.pop_back();
+		else
+			SNumber<T>::negate(m_stack.back());
+	}
+	//-------------------------------------------------------------------------
+	//		method:			registerSlot(const SToken& token)
+	//		description:	the slot of a TOK_SETREG or TOK_GETREG token, as
+	//						CRPNEngine::registerSlot() finds it.  m_registers
+	//						grows when a name is given a new slot.
+	//		calls:			CRPNRegisterNames::slot()
+	//		called by:		parse()
+	//		parameters:		const SToken& token -- the token
+	//		returns:		int -- the slot, or -1 if the name cannot have
+	//						one
+	//		History Log:
+	//					10/17/2026 HJ completed version 1.0
+	// -------------------------------------------------------------------------
+	template <class T>
+	int CRPNTypedEngine<T>::registerSlot(const SToken& token)
+	{
+		if (token.reg >= 0)
+			return token.reg;
+		const int reg = m_registerNames.slot(token.text);
+		if (reg >= static_cast<int>(m_registers.size()))
+			m_registers.resize(reg + 1);
+		return reg;
+	}
+	//-------------------------------------------------------------------------
+	//		method:			rotateUp(int count)
+	//		description:	moves the top count values of the stack to the
+	//						bottom, as CRPNEngine::rotateUp() does
+	//		calls:			rotate()
+	//		called by:		parse()
+	//		parameters:		int count -- values to move, -1 if the count
+	//						was too large
+	//		returns:		n/a
+	//		History Log:
+	//					10/17/2026 HJ completed version 1.0
+	//					10/17/2026 HJ rotates by count, version 1.1
+	// -------------------------------------------------------------------------
+	template <class T>
+	void CRPNTypedEngine<T>::rotateUp(int count)
+	{
+		if (m_stack.empty() || count < 0)
+		{
+			m_error = true;
+			return;
+		}
+		const size_t k = static_cast<size_t>(count) % m_stack.size();
+		rotate(m_stack.begin(), m_stack.end() - k, m_stack.end());
+	}
+	//-------------------------------------------------------------------------
+	//		method:			rotateDown(int count)
+	//		description:	moves the bottom count values of the stack to
+	//						the top, as CRPNEngine::rotateDown() does
+	//		calls:			rotate()
+	//		called by:		parse()
+	//		parameters:		int count -- values to move, -1 if the count
+	//						was too large
+	//		returns:		n/a
+	//		History Log:
+	//					10/17/2026 HJ completed version 1.0
+	//					10/17/2026 HJ moves the bottom instead of copying
+	//						it over the top; rotates by count, version 1.1
+	// -------------------------------------------------------------------------
+	template <class T>
+	void CRPNTypedEngine<T>::rotateDown(int count)
+	{
+		if (m_stack.empty() || count < 0)
+		{
+			m_error = true;
+			return;
+		}
+		const size_t k = static_cast<size_t>(count) % m_stack.size();
+		rotate(m_stack.begin(), m_stack.begin() + k, m_stack.end());
+	}
+	//-------------------------------------------------------------------------
+	//		method:			runProgram()
+	//		description:	parses each program line in turn.  A program
+	//						that keeps running itself stops with an error
+	//						after MAXRUNDEPTH nested runs.
+	//		calls:			parse()
+	//		called by:		parse()
+	//		parameters:		n/a
+	//		returns:		n/a
+	//		History Log:
+	//					10/17/2026 HJ completed version 1.0
+	// -------------------------------------------------------------------------
+	template <class T>
+	void CRPNTypedEngine<T>::runProgram()
+	{
+		if (m_runDepth >= MAXRUNDEPTH)
+		{
+			m_error = true;
+			return;
+		}
+		m_runDepth++;
+		for (string_view line : m_program)
+			parse(line);
+		m_runDepth--;
+	}
+
+	template class CRPNTypedEngine<double>;
+	template class CRPNTypedEngine<long double>;
+	template class CRPNTypedEngine<CRPNDecimal>;
+
+	//-------------------------------------------------------------------------
+	//		function:		createNumericEngine(NumericMode mode,
+	//							unsigned precision)
+	//		description:	makes an engine for a number type
+	//		calls:			CRPNTypedEngine<T>()
+	//		called by:		main() (driver and benchmarks)
+	//		parameters:		NumericMode mode -- the number type
+	//						unsigned precision -- significant digits of
+	//						decimal results
+	//		returns:		unique_ptr<CRPNNumericEngine> -- the engine
+	//		History Log:
+	//					10/17/2026 HJ completed version 1.0
+	// -------------------------------------------------------------------------
+	unique_ptr<CRPNNumericEngine> createNumericEngine(NumericMode mode,
+		unsigned precision)
+	{
+		switch (mode)
+		{
+		case NUM_LONGDOUBLE:
+			return unique_ptr<CRPNNumericEngine>(
+				new CRPNTypedEngine<long double>(precision));
+		case NUM_DECIMAL:
+			return unique_ptr<CRPNNumericEngine>(
+				new CRPNTypedEngine<CRPNDecimal>(precision));
+		default:
+			return unique_ptr<CRPNNumericEngine>(
+				new CRPNTypedEngine<double>(precision));
+		}
+	}
+	//-------------------------------------------------------------------------
+	//		function:		parseNumericMode(string_view text,
+	//							NumericMode& mode, unsigned& precision)
+	//		description:	reads a mode name: "double", "long" or
+	//						"decimal", the last optionally followed by
+	//						":digits" ("decimal:50")
+	//		calls:			n/a
+	//		called by:		main() (driver)
+	//		parameters:		string_view text -- the name
+	//						NumericMode& mode -- receives the mode
+	//						unsigned& precision -- receives the digits, if
+	//						given; otherwise left alone
+	//		returns:		bool -- false if text is not a mode
+	//		History Log:
+	//					10/17/2026 HJ completed version 1.0
+	// -------------------------------------------------------------------------
+	bool parseNumericMode(string_view text, NumericMode& mode,
+		unsigned& precision)
+	{
+		if (text == "double")
+		{
+			mode = NUM_DOUBLE;
+			return true;
+		}
+		if (text == "long")
+		{
+			mode = NUM_LONGDOUBLE;
+			return true;
+		}
+		const string_view decimal = "decimal";
+		if (text.substr(0, decimal.size()) != decimal)
+			return false;
+		text.remove_prefix(decimal.size());
+		if (!text.empty())
+		{
+			if (text[0] != ':' || text.size() == 1)
+				return false;
+			unsigned digits = 0;
+			for (size_t i = 1; i < text.size(); i++)
+			{
+				if (text[i] < '0' || text[i] > '9' || digits > MAXPRECISION)
+					return false;
+				digits = digits * 10 + (text[i] - '0');
+			}
+			if (digits < 1 || digits > MAXPRECISION)
+				return false;
+			precision = digits;
+		}
+		mode = NUM_DECIMAL;
+		return true;
+	}
+}
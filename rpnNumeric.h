@@ -0,0 +1,223 @@
+//----------------------------------------------------------------------------
+//    File:		rpnNumeric.h
+//
+//    Class:	CRPNNumericEngine
+//				CRPNTypedEngine<T>
+//----------------------------------------------------------------------------
+#ifndef RPNNUMERIC_H
+#define RPNNUMERIC_H
+
+#include <cstddef>
+#include <list>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+#include "rpnArena.h"
+#include "rpnDecimal.h"
+#include "rpnEngine.h"
+#include "rpnTokenizer.h"
+//----------------------------------------------------------------------------
+//
+//    Title:		RPNNumericEngine Classes
+//
+//    Description:	This file contains the class definitions for
+//					CRPNNumericEngine, an engine whose number type is
+//					chosen at run time, and CRPNTypedEngine<T>, which
+//					implements it for one type: double, long double or
+//					CRPNDecimal.  createNumericEngine() picks the type.
+//
+//					A typed engine parses and runs lines exactly as
+//					CRPNEngine does -- the same tokens, operand order,
+//					errors -- but its stack and registers hold
+//					T, and literals are converted from their text, so
+//					"0.1" is exactly one tenth in decimal mode.  R runs
+//					the program by parsing its lines; the compiler, JIT,
+//					vector mode and result cache work on doubles and stay
+//					with CRPNEngine, which remains the fastest engine for
+//					double.  L, P and F are errors and H and X do nothing,
+//					as in an engine without a shell.  Custom operators
+//					(CRPNOperators) are errors: their kernels work on
+//					double.  So are labels, branches, calls and R:name,
+//					as programs here run a line at a time and there is
+//					no library.
+//
+//					A typed engine is a second interpreter, not
+//					CRPNEngine instantiated for T: CRPNEngine's compiler,
+//					JIT and cache are built on double.  The two share
+//					the tokenizer, the operator table and the register
+//					names, and must agree on everything else.  A command
+//					added to CRPNEngine must be added to parse() below,
+//					or made an error there.  The benchmarks' numeric
+//					group checks this: random lines of every shared
+//					command must give CRPNEngine's results on the double
+//					engine, and every CRPNEngine-only command must be an
+//					error in each typed engine.
+//
+//					The precision is the number of significant digits a
+//					decimal result keeps, and can be changed between
+//					lines; it does not affect double or long double.
+//
+//    Programmer:	Han Jung
+//
+//    Date:			10/17/2026
+//
+//    Version:		1.0
+//
+//    Environment:
+//       Hardware: Intel Xeon PC
+//       Software: Windows 10
+//       Compiles under Microsoft Visual C++ 2017 (/std:c++17)
+//
+//	  class CRPNNumericEngine:
+//
+//	  Properties:
+//		unsigned m_precision -- significant digits of decimal results
+//
+//	  Methods:
+//
+//		inline:
+//			unsigned precision() const;
+//
+//		non-inline:
+//		public:
+//			virtual ~CRPNNumericEngine();
+//			virtual EvalResult evaluate(string_view line, string& top) = 0;
+//			virtual void setProgram(const list<string>& program) = 0;
+//			virtual void reset() = 0;
+//			virtual size_t depth() const = 0;
+//			virtual NumericMode mode() const = 0;
+//			void setPrecision(unsigned digits);
+//		protected:
+//			CRPNNumericEngine(unsigned precision);
+//
+//	  class CRPNTypedEngine<T>:
+//
+//	  Properties:
+//		vector<T> m_stack -- operand stack, top last
+//		vector<T> m_registers -- S0-S9/G0-G9, then one per named register
+//		CRPNRegisterNames m_registerNames -- slots of the named registers
+//		CRPNArena m_programText -- the program's characters
+//		vector<string_view> m_program -- the program lines, viewing
+//			m_programText
+//		bool m_error -- set by any failed operation until cleared
+//		int m_runDepth -- nesting of R inside programs
+//
+//	  Methods:
+//
+//		inline:
+//			bool empty() const;
+//			const T& top() const;
+//			bool error() const;
+//
+//		non-inline:
+//		public:
+//			CRPNTypedEngine(unsigned precision);
+//			EvalResult evaluate(string_view line, string& top);
+//			void setProgram(const list<string>& program);
+//			void reset();
+//			size_t depth() const;
+//			NumericMode mode() const;
+//			void push(const T& value);
+//		private:
+//			void parse(string_view line);
+//			void binary(OpCode op);
+//			bool binary_prep(T& d1, T& d2);
+//			void neg();
+//			int registerSlot(const SToken& token);
+//			void rotateUp(int count);
+//			void rotateDown(int count);
+//			void runProgram();
+//
+//	  related functions:
+//			unique_ptr<CRPNNumericEngine> createNumericEngine(
+//				NumericMode mode, unsigned precision);
+//			bool parseNumericMode(string_view text, NumericMode& mode,
+//				unsigned& precision);
+//
+//    History Log:
+//			10/17/2026	HJ  long double and decimal engines, version 1.0
+//			10/17/2026	HJ  program lines in an arena, version 1.1
+//			10/17/2026	HJ  named registers, version 1.2
+//			10/17/2026	HJ  U:k and D:k, version 1.3
+//			10/17/2026	HJ  what must stay in step with CRPNEngine,
+//							version 1.4
+// ----------------------------------------------------------------------------
+
+using namespace std;
+
+namespace PB_CALC
+{
+	enum NumericMode
+	{
+		NUM_DOUBLE,		// double, as CRPNEngine
+		NUM_LONGDOUBLE,	// long double
+		NUM_DECIMAL		// CRPNDecimal at the engine's precision
+	};
+
+	class CRPNNumericEngine
+	{
+	public:
+		virtual ~CRPNNumericEngine();
+		// as CRPNEngine::evaluate(), with the top formatted for the type
+		virtual EvalResult evaluate(string_view line, string& top) = 0;
+		virtual void setProgram(const list<string>& program) = 0;
+		virtual void reset() = 0;
+		virtual size_t depth() const = 0;
+		virtual NumericMode mode() const = 0;
+		void setPrecision(unsigned digits);
+
+		unsigned precision() const { return m_precision; }
+
+	protected:
+		CRPNNumericEngine(unsigned precision);
+
+		unsigned m_precision;
+	};
+
+	template <class T>
+	class CRPNTypedEngine : public CRPNNumericEngine
+	{
+	public:
+		CRPNTypedEngine(unsigned precision = DEFAULTPRECISION);
+		EvalResult evaluate(string_view line, string& top);
+		void setProgram(const list<string>& program);
+		void reset();
+		size_t depth() const;
+		NumericMode mode() const;
+		void push(const T& value);
+
+		bool empty() const { return m_stack.empty(); }
+		const T& top() const { return m_stack.back(); }
+		bool error() const { return m_error; }
+
+	private:
+		void parse(string_view line);
+		void binary(OpCode op);
+		bool binary_prep(T& d1, T& d2);
+		void neg();
+		int registerSlot(const SToken& token);
+		void rotateUp(int count);
+		void rotateDown(int count);
+		void runProgram();
+
+		vector<T> m_stack;
+		vector<T> m_registers;
+		CRPNRegisterNames m_registerNames;
+		CRPNArena m_programText;
+		vector<string_view> m_program;
+		bool m_error;
+		int m_runDepth;
+	};
+
+	extern template class CRPNTypedEngine<double>;
+	extern template class CRPNTypedEngine<long double>;
+	extern template class CRPNTypedEngine<CRPNDecimal>;
+
+	unique_ptr<CRPNNumericEngine> createNumericEngine(NumericMode mode,
+		unsigned precision = DEFAULTPRECISION);
+	bool parseNumericMode(string_view text, NumericMode& mode,
+		unsigned& precision);
+}
+
+#endif
@@ -0,0 +1,179 @@
+#include "rpnOperators.h"
+#include <cctype>
+#include <cstring>
+//-------------------------------------------------------------------------------------------
+//    Class:		CRPNOperators
+//
+//    File:			rpnOperators.cpp
+//
+//    Description:	This file contains the function definitions for
+//					CRPNOperators, and the built-in operator table
+//
+//    Programmer:	Han Jung
+//
+//    Date:			10/17/2026
+//
+//    Version:		1.0
+//
+//    Environment:	Intel Xeon PC
+//                  Software:   MS Windows 10 for execution;
+//                  Compiles under Microsoft Visual C++ 2017 (/std:c++17)
+//
+//	  class:		CRPNOperators
+//
+//	  Properties:
+//				static STable s_table;
+//				static SOperator s_custom[MAXOPERATORS];
+//				static size_t s_customCount;
+//				static atomic<bool> s_frozen;
+//				static mutex s_mutex;
+//
+//	  Non-inline Methods:
+//				static bool add(char name, int arity, OperatorKernel kernel);
+//				static void freeze();
+//				static bool frozen();
+//				constexpr STable::STable();
+//
+//    History Log:
+//				10/17/2026	HJ operator table, custom operators, version 1.0
+//				10/17/2026	HJ ; returns, branch characters reserved,
+//							version 1.1
+//				10/17/2026	HJ table frozen by the first engine, version 1.2
+// ----------------------------------------------------------------------------
+namespace PB_CALC
+{
+	//-------------------------------------------------------------------------
+	//		method:			STable()
+	//		description:	constructor; the built-in operators, in both
+	//						cases for letters.  constexpr, so the table is
+	//						filled before any code runs and an operator
+	//						used during static initialization still finds
+	//						it.
+	//		calls:			n/a
+	//		called by:		n/a (s_table)
+	//		parameters:		n/a
+	//		returns:		n/a
+	//		History Log:
+	//					10/17/2026 HJ completed version 1.0
+	//					10/17/2026 HJ ; for OP_RETURN, version 1.1
+	// -------------------------------------------------------------------------
+	constexpr CRPNOperators::STable::STable() : entries()
+	{
+		struct SBuiltIn
+		{
+			char name;
+			OpCode op;
+		};
+		const SBuiltIn builtIns[] =
+		{
+			{ '+', OP_ADD }, { '-', OP_SUBTRACT }, { '*', OP_MULTIPLY },
+			{ '/', OP_DIVIDE }, { '^', OP_EXP }, { '%', OP_MOD },
+			{ 'C', OP_CLEARENTRY }, { 'D', OP_ROTATEDOWN },
+			{ 'F', OP_SAVE }, { 'H', OP_HELP }, { 'L', OP_LOAD },
+			{ 'M', OP_NEG }, { 'P', OP_RECORD }, { 'R', OP_RUN },
+			{ 'U', OP_ROTATEUP }, { 'X', OP_EXIT }, { ';', OP_RETURN }
+		};
+		for (SOperator& entry : entries)
+			entry = SOperator{ OP_ERROR, 0, 0, nullptr };
+		for (const SBuiltIn& builtIn : builtIns)
+		{
+			// plain U and D rotate by one
+			const SOperator entry = { builtIn.op, (builtIn.op == OP_ROTATEUP
+				|| builtIn.op == OP_ROTATEDOWN) ? 1 : 0, 0, nullptr };
+			entries[static_cast<unsigned char>(builtIn.name)] = entry;
+			if (builtIn.name >= 'A' && builtIn.name <= 'Z')
+				entries[static_cast<unsigned char>(builtIn.name - 'A' + 'a')]
+					= entry;
+		}
+	}
+
+	CRPNOperators::STable CRPNOperators::s_table;
+	SOperator CRPNOperators::s_custom[MAXOPERATORS];
+	size_t CRPNOperators::s_customCount = 0;
+	atomic<bool> CRPNOperators::s_frozen(false);
+	mutex CRPNOperators::s_mutex;
+
+	//-------------------------------------------------------------------------
+	//		method:			add(char name, int arity, OperatorKernel kernel)
+	//		description:	adds a custom operator.  The name is one
+	//						printable character that is not already an
+	//						operator and does not start a number or a
+	//						register, label or branch: not a digit, '.',
+	//						'-', 'S', 'G', ':', 'J', 'K', '<', '>', '=', '!'
+	//						or '@'.  A letter is added in both cases.
+	//						Fails once the table is frozen.
+	//		calls:			n/a
+	//		called by:		embedding code
+	//		parameters:		char name -- the operator's character
+	//						int arity -- operands it takes, 1 or 2
+	//						OperatorKernel kernel -- its arithmetic
+	//		returns:		bool -- false if the name is taken or not
+	//						allowed, the arity is not 1 or 2, the kernel is
+	//						null, MAXOPERATORS have been added, or an
+	//						engine has been constructed
+	//		History Log:
+	//					10/17/2026 HJ completed version 1.0
+	//					10/17/2026 HJ branch characters reserved, version 1.1
+	//					10/17/2026 HJ fails once frozen, version 1.2
+	// -------------------------------------------------------------------------
+	bool CRPNOperators::add(char name, int arity, OperatorKernel kernel)
+	{
+		lock_guard<mutex> lock(s_mutex);
+		if (s_frozen.load(memory_order_relaxed))
+			return false;
+		const unsigned char c = static_cast<unsigned char>(name);
+		const unsigned char other = isalpha(c)
+			? static_cast<unsigned char>(isupper(c) ? tolower(c) : toupper(c))
+			: c;
+		if (!isgraph(c) || isdigit(c) || c == '.' || c == '-'
+			|| toupper(c) == 'S' || toupper(c) == 'G'
+			|| strchr(":JK<>=!@", toupper(c)) != nullptr
+			|| s_table.entries[c].op != OP_ERROR
+			|| s_table.entries[other].op != OP_ERROR
+			|| (arity != 1 && arity != 2) || kernel == nullptr
+			|| s_customCount >= MAXOPERATORS)
+			return false;
+		const SOperator entry = { OP_CUSTOM, static_cast<int>(s_customCount),
+			arity, kernel };
+		s_custom[s_customCount++] = entry;
+		s_table.entries[c] = entry;
+		s_table.entries[other] = entry;
+		return true;
+	}
+
+	//-------------------------------------------------------------------------
+	//		method:			freeze()
+	//		description:	freezes the table; add() fails from then on.
+	//						Taking the lock orders every add() before it,
+	//						so a thread that sees the table frozen sees
+	//						every operator added.
+	//		calls:			n/a
+	//		called by:		CRPNEngine()
+	//						CRPNTypedEngine()
+	//		parameters:		n/a
+	//		returns:		n/a
+	//		History Log:
+	//					10/17/2026 HJ completed version 1.0
+	// -------------------------------------------------------------------------
+	void CRPNOperators::freeze()
+	{
+		if (s_frozen.load(memory_order_acquire))
+			return;
+		lock_guard<mutex> lock(s_mutex);
+		s_frozen.store(true, memory_order_release);
+	}
+	//-------------------------------------------------------------------------
+	//		method:			frozen()
+	//		description:	whether the table is frozen
+	//		calls:			n/a
+	//		called by:		embedding code
+	//		parameters:		n/a
+	//		returns:		bool -- true once an engine has been constructed
+	//		History Log:
+	//					10/17/2026 HJ completed version 1.0
+	// -------------------------------------------------------------------------
+	bool CRPNOperators::frozen()
+	{
+		return s_frozen.load(memory_order_acquire);
+	}
+}
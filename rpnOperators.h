@@ -0,0 +1,138 @@
+//----------------------------------------------------------------------------
+//    File:		rpnOperators.h
+//
+//    Class:	CRPNOperators
+//----------------------------------------------------------------------------
+#ifndef RPNOPERATORS_H
+#define RPNOPERATORS_H
+
+#include <atomic>
+#include <cstddef>
+#include <mutex>
+#include "rpnProgram.h"
+//----------------------------------------------------------------------------
+//
+//    Title:		RPNOperators Class
+//
+//    Description:	This file contains the class definition for
+//					CRPNOperators, the operator table.  Every byte of a
+//					single character operator token indexes a 256-entry
+//					table that gives the op it runs, so parsing and
+//					compiling an operator is one load whatever the byte.
+//					Bytes that are not operators give OP_ERROR.
+//
+//					An embedder adds operators of its own with add(): a
+//					character, one or two operands, and a kernel.  A
+//					custom operator is an OP_CUSTOM entry in the same
+//					table, and compiles to OP_CUSTOM with its index, so
+//					it is found and run as quickly as + or M.  Its
+//					operands are taken as a built-in's are: d1 is the
+//					top, a failed kernel sets the error and pushes the
+//					operands back, and once an error is set they are
+//					dropped.
+//
+//					The table is shared by every engine in the process,
+//					so it is frozen when the first engine is
+//					constructed: add() fails from then on, and engines
+//					on any thread read the table without locking.  Add
+//					operators at startup, before creating an engine.
+//					Kernels must depend on their
+//					operands alone, as the optimizer and the result
+//					cache take every operator to.  Custom operators run
+//					in CRPNEngine, and in vector mode on its scalar
+//					engine.  The JIT compiles each to a call to its
+//					kernel.  The typed engines reject them, as kernels
+//					work on double.
+//
+//    Programmer:	Han Jung
+//
+//    Date:			10/17/2026
+//
+//    Version:		1.0
+//
+//    Environment:
+//       Hardware: Intel Xeon PC
+//       Software: Windows 10
+//       Compiles under Microsoft Visual C++ 2017 (/std:c++17)
+//
+//	  class CRPNOperators:
+//
+//	  Properties:
+//		static STable s_table -- the entry for each byte
+//		static SOperator s_custom[MAXOPERATORS] -- the custom operators,
+//			by index
+//		static size_t s_customCount -- custom operators added
+//		static atomic<bool> s_frozen -- an engine has been constructed
+//		static mutex s_mutex -- serializes add() and freeze()
+//
+//	  Methods:
+//
+//		inline:
+//			static const SOperator& find(char c);
+//			static const SOperator& custom(int index);
+//			static size_t customCount();
+//
+//		non-inline:
+//		public:
+//			static bool add(char name, int arity, OperatorKernel kernel);
+//			static void freeze();
+//			static bool frozen();
+//
+//    History Log:
+//			10/17/2026	HJ  operator table, custom operators, version 1.0
+//			10/17/2026	HJ  table frozen by the first engine, version 1.1
+//			10/17/2026	HJ  comment: the JIT compiles custom operators,
+//							version 1.2
+// ----------------------------------------------------------------------------
+
+using namespace std;
+
+namespace PB_CALC
+{
+	const size_t MAXOPERATORS = 64;		// custom operators
+
+	// a custom operator's arithmetic: d1 is the top of the stack and d2
+	// the value below it (0 for one operand); false if it fails
+	typedef bool (*OperatorKernel)(double d1, double d2, double& result);
+
+	struct SOperator
+	{
+		OpCode op;				// what the byte runs, OP_ERROR if nothing
+		int arg;				// the instruction's arg: 1 for U and D, the
+								// index of a custom operator, else 0
+		int arity;				// operands a custom operator takes
+		OperatorKernel kernel;	// a custom operator's arithmetic
+	};
+
+	class CRPNOperators
+	{
+	public:
+		static bool add(char name, int arity, OperatorKernel kernel);
+		static void freeze();
+		static bool frozen();
+
+		// the entry for an operator token's byte
+		static const SOperator& find(char c)
+		{
+			return s_table.entries[static_cast<unsigned char>(c)];
+		}
+		// the custom operator of an OP_CUSTOM instruction's arg
+		static const SOperator& custom(int index) { return s_custom[index]; }
+		static size_t customCount() { return s_customCount; }
+
+	private:
+		struct STable
+		{
+			constexpr STable();
+			SOperator entries[256];
+		};
+
+		static STable s_table;
+		static SOperator s_custom[MAXOPERATORS];
+		static size_t s_customCount;
+		static atomic<bool> s_frozen;
+		static mutex s_mutex;
+	};
+}
+
+#endif
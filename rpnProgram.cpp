@@ -0,0 +1,784 @@
+#include "rpnProgram.h"
+#include "rpnLibrary.h"
+#include "rpnOperators.h"
+#include "rpnRegisters.h"
+#include "rpnTokenizer.h"
+#include <algorithm>
+#include <cctype>
+#include <cmath>
+//-------------------------------------------------------------------------------------------
+//    Class:		CRPNProgram
+//
+//    File:			rpnProgram.cpp
+//
+//    Description:	This file contains the function definitions for
+//					CRPNProgram
+//
+//    Programmer:	Han Jung
+//
+//    Date:			10/17/2026
+//
+//    Version:		1.0
+//
+//    Environment:	Intel Xeon PC
+//                  Software:   MS Windows 10 for execution;
+//                  Compiles under Microsoft Visual C++ 2017 (/std:c++17)
+//
+//	  class:		CRPNProgram
+//
+//	  Properties:
+//				vector<SInstruction> m_code;
+//				vector<double> m_constants;
+//				vector<size_t> m_resume;
+//				vector<size_t> m_depths;
+//				vector<size_t> m_starts;
+//				vector<bool> m_joins;
+//				unordered_map<string, size_t> m_labels;
+//				vector<SBranch> m_branches;
+//				const SInstruction* m_codeData;
+//				size_t m_size;
+//				const double* m_constantData;
+//				size_t m_constantCount;
+//				const size_t* m_resumeData;
+//				bool m_mapped;
+//
+//	  Non-inline Methods:
+//				CRPNProgram();
+//				void assign(const CRPNProgram& source);
+//				void clear();
+//				void compile(const vector<string_view>& lines,
+//					CRPNRegisterNames& names, CRPNLibrary* library);
+//				void compileLine(string_view line, CRPNRegisterNames& names,
+//					CRPNLibrary* library);
+//				void optimize(const CRPNProgram& source);
+//				void map(const SInstruction* code, size_t size,
+//					const double* constants, size_t constantCount,
+//					const size_t* resume);
+//				static OpCode opFromChar(char c);
+//				static bool fold(OpCode op, double d1, double d2,
+//					double& result);
+//
+//				private:
+//					void emit(OpCode op, int arg);
+//					int addConstant(double value);
+//					void dropLast();
+//					bool reduceLast(vector<size_t>& depths, size_t barrier);
+//					static size_t depthAfter(const SInstruction& instruction,
+//						size_t depth);
+//					void own();
+//
+//    History Log:
+//				10/17/2026	HJ bytecode for recorded programs, version 1.0
+//				10/17/2026	HJ peephole optimizer, version 1.1
+//				10/17/2026	HJ rotations carry their count, version 1.2
+//				10/17/2026	HJ operators from CRPNOperators, version 1.3
+//				10/17/2026	HJ labels, branches, loops and calls, version 1.4
+//				10/17/2026	HJ library programs, version 1.5
+//				10/17/2026	HJ run in place from a mapping, version 1.6
+//				10/17/2026	HJ assign(), version 1.7
+// ----------------------------------------------------------------------------
+namespace PB_CALC
+{
+	namespace
+	{
+		//--------------------------------------------------------------------
+		//	Function:		labelKey(string_view name)
+		//	Description:	a label's name in upper case; labels, like
+		//					register names, ignore case
+		//--------------------------------------------------------------------
+		string labelKey(string_view name)
+		{
+			string key(name);
+			for (char& c : key)
+				c = static_cast<char>(toupper(static_cast<unsigned char>(c)));
+			return key;
+		}
+
+		//--------------------------------------------------------------------
+		//	Function:		branchOp(char c)
+		//	Description:	the op of a TOK_BRANCH token's character
+		//--------------------------------------------------------------------
+		OpCode branchOp(char c)
+		{
+			switch (c)
+			{
+			case 'J': return OP_JUMP;
+			case '<': return OP_BRANCHLESS;
+			case '>': return OP_BRANCHGREATER;
+			case '=': return OP_BRANCHEQUAL;
+			case '!': return OP_BRANCHNOTEQUAL;
+			case 'K': return OP_LOOP;
+			default: return OP_CALL;
+			}
+		}
+	}
+
+	//-------------------------------------------------------------------------
+	//		method:			CRPNProgram()
+	//		description:	constructor; creates an empty program
+	//		calls:			n/a
+	//		called by:		CRPNCalc::CRPNCalc()
+	//		parameters:		n/a
+	//		returns:		n/a
+	//		History Log:
+	//					10/17/2026 HJ completed version 1.0
+	// -------------------------------------------------------------------------
+	CRPNProgram::CRPNProgram() : m_codeData(nullptr), m_size(0),
+		m_constantData(nullptr), m_constantCount(0), m_resumeData(nullptr),
+		m_mapped(false)
+	{
+	}
+	//-------------------------------------------------------------------------
+	//		method:			assign(const CRPNProgram& source)
+	//		description:	makes the program a copy of source, in vectors
+	//						of its own even if source is mapped.  Register
+	//						and library slots are copied as they are, so
+	//						the copy must run where those slots mean the
+	//						same.
+	//		calls:			clear()
+	//						own()
+	//		called by:		CRPNLibrary::assign()
+	//		parameters:		const CRPNProgram& source -- the program to
+	//						copy
+	//		returns:		n/a
+	//		History Log:
+	//					10/17/2026 HJ completed version 1.0
+	// -------------------------------------------------------------------------
+	void CRPNProgram::assign(const CRPNProgram& source)
+	{
+		if (&source == this)
+			return;
+		clear();
+		m_code.assign(source.m_codeData, source.m_codeData + source.m_size);
+		m_constants.assign(source.m_constantData,
+			source.m_constantData + source.m_constantCount);
+		if (source.m_resumeData != nullptr)
+			m_resume.assign(source.m_resumeData,
+				source.m_resumeData + source.m_size);
+		own();
+	}
+	//-------------------------------------------------------------------------
+	//		method:			clear()
+	//		description:	removes all instructions and constants, and
+	//						lets go of a mapping
+	//		calls:			own()
+	//		called by:		compile()
+	//						optimize()
+	//						map()
+	//		parameters:		n/a
+	//		returns:		n/a
+	//		History Log:
+	//					10/17/2026 HJ completed version 1.0
+	//					10/17/2026 HJ mappings, version 1.1
+	// -------------------------------------------------------------------------
+	void CRPNProgram::clear()
+	{
+		m_code.clear();
+		m_constants.clear();
+		m_resume.clear();
+		own();
+	}
+	//-------------------------------------------------------------------------
+	//		method:			map(const SInstruction* code, size_t size,
+	//							const double* constants,
+	//							size_t constantCount,
+	//							const size_t* resume)
+	//		description:	makes the program the one at code, as saved by
+	//						CRPNProgramFile, without copying it.  The
+	//						memory must stay mapped, and unchanged, until
+	//						the program is cleared or replaced.
+	//		calls:			clear()
+	//		called by:		CRPNEngine::loadProgramFile()
+	//		parameters:		const SInstruction* code -- the instructions
+	//						size_t size -- how many
+	//						const double* constants -- the constant pool
+	//						size_t constantCount -- how many
+	//						const size_t* resume -- the resume table of an
+	//						optimized program, else nullptr
+	//		returns:		n/a
+	//		History Log:
+	//					10/17/2026 HJ completed version 1.0
+	// -------------------------------------------------------------------------
+	void CRPNProgram::map(const SInstruction* code, size_t size,
+		const double* constants, size_t constantCount, const size_t* resume)
+	{
+		clear();
+		m_codeData = code;
+		m_size = size;
+		m_constantData = constants;
+		m_constantCount = constantCount;
+		m_resumeData = resume;
+		m_mapped = true;
+	}
+	//-------------------------------------------------------------------------
+	//		method:			compile(const vector<string_view>& lines,
+	//							CRPNRegisterNames& names,
+	//							CRPNLibrary* library)
+	//		description:	replaces the program with the compiled form of
+	//						lines.  Branches are compiled to OP_ERROR, and
+	//						become the branch once every line has been
+	//						compiled and their label is known; a branch to
+	//						a label the program does not have stays an
+	//						error.
+	//		calls:			clear()
+	//						compileLine()
+	//						labelKey()
+	//		called by:		CRPNEngine::compileProgram()
+	//						CRPNVector::compile()
+	//						CRPNLibrary::define()
+	//		parameters:		const vector<string_view>& lines -- the recorded
+	//						program
+	//						CRPNRegisterNames& names -- gives named
+	//						registers their slots
+	//						CRPNLibrary* library -- gives library programs
+	//						their slots; null if there is none
+	//		returns:		n/a
+	//		History Log:
+	//					10/17/2026 HJ completed version 1.0
+	//					10/17/2026 HJ take line views, version 1.1
+	//					10/17/2026 HJ named registers, version 1.2
+	//					10/17/2026 HJ labels, version 1.3
+	//					10/17/2026 HJ library programs, version 1.4
+	// -------------------------------------------------------------------------
+	void CRPNProgram::compile(const vector<string_view>& lines,
+		CRPNRegisterNames& names, CRPNLibrary* library)
+	{
+		clear();
+		m_labels.clear();
+		m_branches.clear();
+		for (string_view line : lines)
+			compileLine(line, names, library);
+		for (const SBranch& branch : m_branches)
+		{
+			unordered_map<string, size_t>::const_iterator it
+				= m_labels.find(labelKey(branch.label));
+			if (it == m_labels.end())
+				continue;
+			m_code[branch.at] = branch.instruction;
+			m_code[branch.at].arg = static_cast<int>(it->second);
+		}
+		own();
+	}
+	//-------------------------------------------------------------------------
+	//		method:			compileLine(string_view line,
+	//							CRPNRegisterNames& names,
+	//							CRPNLibrary* library)
+	//		description:	appends the instructions for one program line.
+	//						Like parse(), an 'R' ends the line: the rest of
+	//						it is never executed, so it is not compiled.
+	//						A named register becomes its slot, so the run
+	//						does not look the name up; a name that cannot
+	//						have one compiles to OP_ERROR.
+	//						A label is the index of the next instruction;
+	//						a second label of the same name compiles to
+	//						OP_ERROR.  A branch is left for compile().
+	//						"R:name" becomes the library slot of the name,
+	//						which need not have code yet.
+	//		calls:			CRPNTokenizer::next()
+	//						CRPNRegisterNames::slot()
+	//						addConstant()
+	//						emit()
+	//						CRPNOperators::find()
+	//						labelKey()
+	//						branchOp()
+	//						CRPNLibrary::slot()
+	//		called by:		compile()
+	//		parameters:		string_view line -- one line of program text
+	//						CRPNRegisterNames& names -- gives named
+	//						registers their slots
+	//						CRPNLibrary* library -- gives library programs
+	//						their slots; null if there is none
+	//		returns:		n/a
+	//		History Log:
+	//					10/17/2026 HJ completed version 1.0
+	//					10/17/2026 HJ named registers, version 1.1
+	//					10/17/2026 HJ U:k and D:k, version 1.2
+	//					10/17/2026 HJ operators from CRPNOperators, version 1.3
+	//					10/17/2026 HJ labels and branches, version 1.4
+	//					10/17/2026 HJ R:name, version 1.5
+	//					10/17/2026 HJ mappings, version 1.6
+	// -------------------------------------------------------------------------
+	void CRPNProgram::compileLine(string_view line, CRPNRegisterNames& names,
+		CRPNLibrary* library)
+	{
+		CRPNTokenizer tokenizer(line);
+		SToken token;
+		bool run = false;
+		while (!run && tokenizer.next(token))
+		{
+			switch (token.type)
+			{
+			case TOK_NUMBER:
+				emit(OP_PUSH, addConstant(token.value));
+				break;
+			case TOK_NEGZERO:
+				emit(OP_NEGZERO, addConstant(token.value));
+				break;
+			case TOK_CLEARALL:
+				emit(OP_CLEARALL, 0);
+				break;
+			case TOK_SETREG:
+			case TOK_GETREG:
+			{
+				const int reg = (token.reg >= 0) ? token.reg
+					: names.slot(token.text);
+				if (reg < 0)
+					emit(OP_ERROR, 0);
+				else
+					emit(token.type == TOK_SETREG ? OP_SETREG : OP_GETREG, reg);
+				break;
+			}
+			case TOK_ROTATE:
+				if (token.reg < 0)
+					emit(OP_ERROR, 0);
+				else
+					emit(token.op == 'U' ? OP_ROTATEUP : OP_ROTATEDOWN,
+						token.reg);
+				break;
+			case TOK_RUNPROGRAM:
+			{
+				const int slot = (library != nullptr)
+					? library->slot(token.text) : -1;
+				if (slot < 0)
+					emit(OP_ERROR, 0);
+				else
+					emit(OP_RUNPROGRAM, slot);
+				break;
+			}
+			case TOK_LABEL:
+				if (!m_labels.emplace(labelKey(token.text),
+					m_code.size()).second)
+					emit(OP_ERROR, 0);
+				break;
+			case TOK_BRANCH:
+			{
+				SBranch branch;
+				branch.at = m_code.size();
+				branch.instruction.op = branchOp(token.op);
+				branch.instruction.reg = static_cast<unsigned short>(
+					token.op == 'K' ? token.reg : 0);
+				branch.instruction.arg = 0;
+				branch.label = token.text;
+				m_branches.push_back(branch);
+				emit(OP_ERROR, 0);
+				break;
+			}
+			case TOK_OPERATOR:
+			{
+				const SOperator& entry = CRPNOperators::find(token.op);
+				emit(entry.op, entry.arg);
+				run = (entry.op == OP_RUN);
+				break;
+			}
+			}
+		}
+		own();
+	}
+	//-------------------------------------------------------------------------
+	//		method:			optimize(const CRPNProgram& source)
+	//		description:	replaces the program with an optimized copy of
+	//						source:
+	//						- constant arithmetic is folded, unless the op
+	//						  would fail (divide or mod by zero, 0^0)
+	//						- "-0" becomes a push of -0
+	//						- M M and a push followed by C are removed
+	//						- a push followed by a binary op becomes one
+	//						  superinstruction
+	//						- back to back rotations become one, or none
+	//						  when they cancel
+	//						A branch target, and the instruction after a
+	//						call, can be reached with any values on the
+	//						stack, so rewrites never reach back across one;
+	//						branches are given their targets' places in the
+	//						optimized code.
+	//						The result only matches source while no error
+	//						is set.  m_resume gives, for each instruction,
+	//						the source instruction to continue from once it
+	//						has set one, so the run can finish in source.
+	//		calls:			addConstant()
+	//						emit()
+	//						reduceLast()
+	//						depthAfter()
+	//		called by:		CRPNEngine::compileProgram()
+	//						CRPNVector::compile()
+	//		parameters:		const CRPNProgram& source -- compiled program
+	//		returns:		n/a
+	//		History Log:
+	//					10/17/2026 HJ completed version 1.0
+	//					10/17/2026 HJ reuse the depth scratch, version 1.1
+	//					10/17/2026 HJ merged rotations, version 1.2
+	//					10/17/2026 HJ branches, version 1.3
+	// -------------------------------------------------------------------------
+	void CRPNProgram::optimize(const CRPNProgram& source)
+	{
+		clear();
+		const size_t count = source.m_size;
+		vector<bool>& joins = m_joins;
+		joins.assign(count + 1, false);
+		for (size_t i = 0; i < count; i++)
+		{
+			const SInstruction& instruction = source.m_codeData[i];
+			if (isBranch(instruction.op))
+				joins[instruction.arg] = true;
+			if (instruction.op == OP_CALL)
+				joins[i + 1] = true;
+		}
+		// depths[i] is how many values instruction i can count on being
+		// on the stack: those pushed by this program and not yet used
+		vector<size_t>& depths = m_depths;
+		vector<size_t>& starts = m_starts;
+		depths.clear();
+		starts.clear();
+		size_t depth = 0;
+		size_t barrier = 0;
+		for (size_t i = 0; i < count; i++)
+		{
+			if (joins[i])
+			{
+				barrier = m_code.size();
+				depth = 0;
+			}
+			starts.push_back(m_code.size());
+			OpCode op = source.m_codeData[i].op;
+			int arg = source.m_codeData[i].arg;
+			if (op == OP_PUSH || op == OP_NEGZERO)
+			{
+				double value = source.m_constantData[arg];
+				if (op == OP_NEGZERO)
+					value *= -1.0;		// as neg() does it
+				op = OP_PUSH;
+				arg = addConstant(value);
+			}
+			depths.push_back(depth);
+			emit(op, arg);
+			m_code.back().reg = source.m_codeData[i].reg;
+			m_resume.push_back(i + 1);
+			while (reduceLast(depths, barrier))
+				;
+			depth = m_code.empty() ? 0
+				: depthAfter(m_code.back(), depths.back());
+		}
+		starts.push_back(m_code.size());
+		for (SInstruction& instruction : m_code)
+			if (isBranch(instruction.op))
+				instruction.arg = static_cast<int>(starts[instruction.arg]);
+		own();
+	}
+	//-------------------------------------------------------------------------
+	//		method:			fold(OpCode op, double d1, double d2,
+	//							double& result)
+	//		description:	the arithmetic of add() through mod(), with d1
+	//						the top of the stack as in binary_prep()
+	//		calls:			pow()
+	//						fmod()
+	//		called by:		reduceLast()
+	//						CRPNEngine::constantOp()
+	//		parameters:		OpCode op -- OP_ADD through OP_MOD
+	//						double d1 -- top operand
+	//						double d2 -- next operand
+	//						double& result -- receives the result
+	//		returns:		bool -- false if the op fails: divide or mod by
+	//						zero, or 0^0
+	//		History Log:
+	//					10/17/2026 HJ completed version 1.0
+	// -------------------------------------------------------------------------
+	bool CRPNProgram::fold(OpCode op, double d1, double d2, double& result)
+	{
+		switch (op)
+		{
+		case OP_ADD: result = d1 + d2; return true;
+		case OP_SUBTRACT: result = d1 - d2; return true;
+		case OP_MULTIPLY: result = d1 * d2; return true;
+		case OP_DIVIDE:
+			if (d2 == 0)
+				return false;
+			result = d1 / d2;
+			return true;
+		case OP_EXP:
+			if (d1 == 0 && d2 == 0)
+				return false;
+			result = pow(d1, d2);
+			return true;
+		case OP_MOD:
+			if (d2 == 0)
+				return false;
+			result = fmod(d1, d2);
+			return true;
+		default:
+			return false;
+		}
+	}
+	//-------------------------------------------------------------------------
+	//		method:			opFromChar(char c)
+	//		description:	maps a single character operator to its opcode
+	//		calls:			CRPNOperators::find()
+	//		called by:		embedding code
+	//		parameters:		char c -- the operator, either case
+	//		returns:		OpCode -- OP_ERROR if c is not an operator
+	//		History Log:
+	//					10/17/2026 HJ completed version 1.0
+	//					10/17/2026 HJ from the operator table, version 1.1
+	// -------------------------------------------------------------------------
+	OpCode CRPNProgram::opFromChar(char c)
+	{
+		return CRPNOperators::find(c).op;
+	}
+	//-------------------------------------------------------------------------
+	//		method:			emit(OpCode op, int arg)
+	//		description:	appends one instruction
+	//		calls:			n/a
+	//		called by:		compileLine()
+	//		parameters:		OpCode op -- the opcode
+	//						int arg -- register or constant index
+	//		returns:		n/a
+	//		History Log:
+	//					10/17/2026 HJ completed version 1.0
+	// -------------------------------------------------------------------------
+	void CRPNProgram::emit(OpCode op, int arg)
+	{
+		SInstruction instruction;
+		instruction.op = op;
+		instruction.reg = 0;
+		instruction.arg = arg;
+		m_code.push_back(instruction);
+	}
+	//-------------------------------------------------------------------------
+	//		method:			addConstant(double value)
+	//		description:	appends value to the constant pool
+	//		calls:			n/a
+	//		called by:		compileLine()
+	//		parameters:		double value -- the constant
+	//		returns:		int -- its index in the pool
+	//		History Log:
+	//					10/17/2026 HJ completed version 1.0
+	// -------------------------------------------------------------------------
+	int CRPNProgram::addConstant(double value)
+	{
+		m_constants.push_back(value);
+		return static_cast<int>(m_constants.size() - 1);
+	}
+	//-------------------------------------------------------------------------
+	//		method:			dropLast()
+	//		description:	removes the last instruction, and its constant
+	//						when that is the last in the pool
+	//		calls:			n/a
+	//		called by:		reduceLast()
+	//		parameters:		n/a
+	//		returns:		n/a
+	//		History Log:
+	//					10/17/2026 HJ completed version 1.0
+	// -------------------------------------------------------------------------
+	void CRPNProgram::dropLast()
+	{
+		const SInstruction& last = m_code.back();
+		if ((last.op == OP_PUSH || last.op >= OP_ADDCONST)
+			&& last.arg == static_cast<int>(m_constants.size()) - 1)
+			m_constants.pop_back();
+		m_code.pop_back();
+		m_resume.pop_back();
+	}
+	//-------------------------------------------------------------------------
+	//		method:			reduceLast(vector<size_t>& depths,
+	//							size_t barrier)
+	//		description:	applies one rewrite to the end of the program,
+	//						if one matches and only changes instructions
+	//						from barrier on
+	//		calls:			fold()
+	//						dropLast()
+	//						emit()
+	//						addConstant()
+	//		called by:		optimize()
+	//		parameters:		vector<size_t>& depths -- known stack depth
+	//						before each instruction, kept in step
+	//						size_t barrier -- the first instruction a
+	//						branch can reach since the last one
+	//		returns:		bool -- true if the program changed
+	//		History Log:
+	//					10/17/2026 HJ completed version 1.0
+	//					10/17/2026 HJ merged rotations, version 1.1
+	//					10/17/2026 HJ not across a branch target, version 1.2
+	// -------------------------------------------------------------------------
+	bool CRPNProgram::reduceLast(vector<size_t>& depths, size_t barrier)
+	{
+		const size_t n = m_code.size();
+		if (n < barrier + 2)
+			return false;
+		const SInstruction last = m_code[n - 1];
+		const SInstruction prev = m_code[n - 2];
+		const bool binary = (last.op >= OP_ADD && last.op <= OP_MOD);
+		const size_t resume = m_resume[n - 1];
+		double result = 0.0;
+
+		// a b op -> (b op a); b is the top, so it is d1
+		if (binary && n >= barrier + 3 && prev.op == OP_PUSH
+			&& m_code[n - 3].op == OP_PUSH
+			&& fold(last.op, m_constants[prev.arg],
+				m_constants[m_code[n - 3].arg], result))
+		{
+			const size_t depth = depths[n - 3];
+			for (int i = 0; i < 3; i++)
+			{
+				dropLast();
+				depths.pop_back();
+			}
+			emit(OP_PUSH, addConstant(result));
+			m_resume.push_back(resume);
+			depths.push_back(depth);
+			return true;
+		}
+
+		// a M -> (-a)
+		if (last.op == OP_NEG && prev.op == OP_PUSH)
+		{
+			result = m_constants[prev.arg] * -1.0;
+			m_constants[prev.arg] = result;
+			dropLast();
+			depths.pop_back();
+			m_resume.back() = resume;
+			return true;
+		}
+
+		// M M and a C are no-ops, provided the first M cannot fail
+		if ((last.op == OP_NEG && prev.op == OP_NEG && depths[n - 2] >= 1)
+			|| (last.op == OP_CLEARENTRY && prev.op == OP_PUSH))
+		{
+			dropLast();
+			dropLast();
+			depths.resize(n - 2);
+			return true;
+		}
+
+		// U:a D:b -> U:(a - b), provided the first cannot fail; the
+		// counts wrap at the same depth, so they add
+		if ((last.op == OP_ROTATEUP || last.op == OP_ROTATEDOWN)
+			&& (prev.op == OP_ROTATEUP || prev.op == OP_ROTATEDOWN)
+			&& depths[n - 2] >= 1)
+		{
+			const long long net
+				= ((prev.op == OP_ROTATEUP) ? prev.arg : -prev.arg)
+				+ ((last.op == OP_ROTATEUP) ? last.arg : -last.arg);
+			if (net > MAXROTATE || net < -MAXROTATE)
+				return false;
+			const size_t depth = depths[n - 2];
+			dropLast();
+			dropLast();
+			depths.resize(n - 2);
+			if (net != 0)
+			{
+				emit(net > 0 ? OP_ROTATEUP : OP_ROTATEDOWN,
+					static_cast<int>(net > 0 ? net : -net));
+				m_resume.push_back(resume);
+				depths.push_back(depth);
+			}
+			return true;
+		}
+
+		// a op -> one instruction
+		if (binary && prev.op == OP_PUSH)
+		{
+			const int constant = prev.arg;
+			const size_t depth = depths[n - 2];
+			m_code.resize(n - 2);
+			m_resume.resize(n - 2);
+			depths.resize(n - 2);
+			emit(static_cast<OpCode>(OP_ADDCONST + (last.op - OP_ADD)),
+				constant);
+			m_resume.push_back(resume);
+			depths.push_back(depth);
+			return true;
+		}
+		return false;
+	}
+	//-------------------------------------------------------------------------
+	//		method:			depthAfter(const SInstruction& instruction,
+	//							size_t depth)
+	//		description:	the known stack depth after an instruction,
+	//						given the known depth before it.  An optimized
+	//						run leaves for the source program at its first
+	//						error, so every op before this one is known to
+	//						have succeeded.
+	//		calls:			CRPNOperators::custom()
+	//		called by:		optimize()
+	//		parameters:		const SInstruction& instruction -- the
+	//						instruction
+	//						size_t depth -- known depth before it
+	//		returns:		size_t -- known depth after it
+	//		History Log:
+	//					10/17/2026 HJ completed version 1.0
+	//					10/17/2026 HJ custom operators, version 1.1
+	//					10/17/2026 HJ branches, version 1.2
+	// -------------------------------------------------------------------------
+	size_t CRPNProgram::depthAfter(const SInstruction& instruction,
+		size_t depth)
+	{
+		switch (instruction.op)
+		{
+		case OP_PUSH:
+		case OP_NEGZERO:
+		case OP_GETREG:
+			return depth + 1;
+		case OP_ADD:
+		case OP_SUBTRACT:
+		case OP_MULTIPLY:
+		case OP_DIVIDE:
+		case OP_EXP:
+		case OP_MOD:
+			return max(depth, size_t(2)) - 1;
+		case OP_NEG:
+		case OP_ROTATEDOWN:
+		case OP_ROTATEUP:
+		case OP_SETREG:
+		case OP_ADDCONST:
+		case OP_SUBTRACTCONST:
+		case OP_MULTIPLYCONST:
+		case OP_DIVIDECONST:
+		case OP_EXPCONST:
+		case OP_MODCONST:
+			return max(depth, size_t(1));
+		case OP_CUSTOM:
+			return (CRPNOperators::custom(instruction.arg).arity == 2)
+				? max(depth, size_t(2)) - 1 : max(depth, size_t(1));
+		case OP_CLEARENTRY:
+			return (depth > 0) ? depth - 1 : 0;
+		case OP_BRANCHLESS:
+		case OP_BRANCHGREATER:
+		case OP_BRANCHEQUAL:
+		case OP_BRANCHNOTEQUAL:
+			return max(depth, size_t(2)) - 2;
+		case OP_CLEARALL:
+		case OP_LOAD:
+		case OP_RECORD:
+		case OP_RUN:
+		case OP_RUNPROGRAM:
+		case OP_JUMP:
+		case OP_CALL:
+		case OP_RETURN:
+			return 0;
+		default:
+			return depth;
+		}
+	}
+	//-------------------------------------------------------------------------
+	//		method:			own()
+	//		description:	points code() and the other accessors at the
+	//						program's own vectors, after they change
+	//		calls:			n/a
+	//		called by:		clear()
+	//						compile()
+	//						compileLine()
+	//						optimize()
+	//		parameters:		n/a
+	//		returns:		n/a
+	//		History Log:
+	//					10/17/2026 HJ completed version 1.0
+	// -------------------------------------------------------------------------
+	void CRPNProgram::own()
+	{
+		m_codeData = m_code.data();
+		m_size = m_code.size();
+		m_constantData = m_constants.data();
+		m_constantCount = m_constants.size();
+		m_resumeData = m_resume.empty() ? nullptr : m_resume.data();
+		m_mapped = false;
+	}
+}
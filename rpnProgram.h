@@ -0,0 +1,246 @@
+//----------------------------------------------------------------------------
+//    File:		rpnProgram.h
+//
+//    Class:	CRPNProgram
+//----------------------------------------------------------------------------
+#ifndef RPNPROGRAM_H
+#define RPNPROGRAM_H
+
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+//----------------------------------------------------------------------------
+//
+//    Title:		RPNProgram Class
+//
+//    Description:	This file contains the class definition for CRPNProgram,
+//					a recorded program compiled to an opcode array and a
+//					constant pool so it can be run without re-parsing.
+//					optimize() rewrites a compiled program with constant
+//					folding, inverse pair removal and superinstructions.
+//
+//					Labels (":name") mark places in the program, and
+//					jumps, compare-and-branch, counted loops and calls
+//					go to them.  A program's labels are resolved when it
+//					is compiled, across all of its lines, so a branch is
+//					an instruction index and costs no lookup at run time.
+//
+//					A program can also run in place from a program file's
+//					mapping (map()), so a saved program loads without
+//					being parsed or copied.  code() and the other
+//					accessors hand out the program wherever it lives.
+//
+//    Programmer:	Han Jung
+//
+//    Date:			10/17/2026
+//
+//    Version:		1.0
+//
+//    Environment:
+//       Hardware: Intel Xeon PC
+//       Software: Windows 10
+//       Compiles under Microsoft Visual C++ 2017 (/std:c++17)
+//
+//	  class CRPNProgram:
+//
+//	  Properties:
+//		vector<SInstruction> m_code -- the compiled instructions
+//		vector<double> m_constants -- values pushed by OP_PUSH/OP_NEGZERO
+//		vector<size_t> m_resume -- optimized programs only: for each
+//			instruction, where the source program continues if it fails
+//		vector<size_t> m_depths -- scratch for optimize(), kept so that
+//			optimizing a program again does not allocate
+//		vector<size_t> m_starts -- scratch for optimize(): where each
+//			source instruction starts in the optimized code
+//		vector<bool> m_joins -- scratch for optimize(): the source
+//			instructions a branch or a return can reach
+//		unordered_map<string, size_t> m_labels -- scratch for compile():
+//			the instruction of each label, by upper case name
+//		vector<SBranch> m_branches -- scratch for compile(): the branches
+//			waiting for their label
+//		const SInstruction* m_codeData -- the instructions: m_code, or a
+//			mapping after map()
+//		size_t m_size -- instructions at m_codeData
+//		const double* m_constantData -- the constants
+//		size_t m_constantCount -- constants at m_constantData
+//		const size_t* m_resumeData -- the resume table, nullptr unless the
+//			program is optimized
+//		bool m_mapped -- the program is in a mapping, not in m_code
+//
+//	  Methods:
+//
+//		inline:
+//			const SInstruction* code() const;
+//			const double* constants() const;
+//			size_t constantCount() const;
+//			const size_t* resume() const;
+//			size_t size() const;
+//			bool empty() const;
+//			bool mapped() const;
+//			static bool isBranch(OpCode op);
+//
+//		non-inline:
+//		public:
+//			CRPNProgram();
+//			void assign(const CRPNProgram& source);
+//			void clear();
+//			void compile(const vector<string_view>& lines,
+//				CRPNRegisterNames& names, CRPNLibrary* library);
+//			void compileLine(string_view line, CRPNRegisterNames& names,
+//				CRPNLibrary* library);
+//			void optimize(const CRPNProgram& source);
+//			void map(const SInstruction* code, size_t size,
+//				const double* constants, size_t constantCount,
+//				const size_t* resume);
+//			static OpCode opFromChar(char c);
+//			static bool fold(OpCode op, double d1, double d2,
+//				double& result);
+//		private:
+//			void emit(OpCode op, int arg);
+//			int addConstant(double value);
+//			void dropLast();
+//			bool reduceLast(vector<size_t>& depths, size_t barrier);
+//			static size_t depthAfter(const SInstruction& instruction,
+//				size_t depth);
+//			void own();
+//
+//    History Log:
+//			10/17/2026	HJ  bytecode for recorded programs, version 1.0
+//			10/17/2026	HJ  peephole optimizer, version 1.1
+//			10/17/2026	HJ  optimize() scratch kept, version 1.2
+//			10/17/2026	HJ  named registers compiled to slots, version 1.3
+//			10/17/2026	HJ  rotations carry their count, version 1.4
+//			10/17/2026	HJ  operators from CRPNOperators, version 1.5
+//			10/17/2026	HJ  labels, branches, loops and calls, version 1.6
+//			10/17/2026	HJ  library programs, version 1.7
+//			10/17/2026	HJ  run in place from a mapping, version 1.8
+//			10/17/2026	HJ  assign(), version 1.9
+// ----------------------------------------------------------------------------
+
+using namespace std;
+
+namespace PB_CALC
+{
+	enum OpCode : unsigned char
+	{
+		OP_PUSH,		// push m_constants[arg]
+		OP_NEGZERO,		// push m_constants[arg], then negate it
+		OP_ADD,
+		OP_SUBTRACT,
+		OP_MULTIPLY,
+		OP_DIVIDE,
+		OP_EXP,
+		OP_MOD,
+		OP_NEG,
+		OP_CLEARENTRY,
+		OP_CLEARALL,
+		OP_ROTATEDOWN,	// arg is the count, 1 for plain D
+		OP_ROTATEUP,	// arg is the count, 1 for plain U
+		OP_SETREG,		// arg is the register slot
+		OP_GETREG,		// arg is the register slot
+		OP_SAVE,
+		OP_HELP,
+		OP_LOAD,
+		OP_RECORD,
+		OP_RUN,			// the rest of its line is never compiled
+		OP_RUNPROGRAM,	// arg is the CRPNLibrary slot
+		OP_EXIT,
+		OP_CUSTOM,		// arg is the CRPNOperators custom operator index
+		OP_JUMP,		// arg is the instruction to jump to
+		OP_BRANCHLESS,	// pop d1 and d2, jump to arg if d1 < d2
+		OP_BRANCHGREATER,	// ... if d1 > d2
+		OP_BRANCHEQUAL,		// ... if d1 == d2
+		OP_BRANCHNOTEQUAL,	// ... if d1 != d2
+		OP_LOOP,		// count register reg down, jump to arg while > 0
+		OP_CALL,		// jump to arg, returning to the next instruction
+		OP_RETURN,		// back after the last call, or the end of the run
+		OP_ERROR,		// a token parse() would reject
+
+		// superinstructions made by optimize(): push m_constants[arg],
+		// then apply the op
+		OP_ADDCONST,
+		OP_SUBTRACTCONST,
+		OP_MULTIPLYCONST,
+		OP_DIVIDECONST,
+		OP_EXPCONST,
+		OP_MODCONST
+	};
+
+	class CRPNLibrary;
+	class CRPNRegisterNames;
+
+	struct SInstruction
+	{
+		OpCode op;
+		unsigned short reg;		// OP_LOOP's register; in what would be
+								// padding, so this stays 8 bytes
+		int arg;
+	};
+
+	class CRPNProgram
+	{
+	public:
+		CRPNProgram();
+		void assign(const CRPNProgram& source);
+		void clear();
+		void compile(const vector<string_view>& lines,
+			CRPNRegisterNames& names, CRPNLibrary* library);
+		void compileLine(string_view line, CRPNRegisterNames& names,
+			CRPNLibrary* library);
+		void optimize(const CRPNProgram& source);
+		void map(const SInstruction* code, size_t size,
+			const double* constants, size_t constantCount,
+			const size_t* resume);
+		const SInstruction* code() const { return m_codeData; }
+		const double* constants() const { return m_constantData; }
+		size_t constantCount() const { return m_constantCount; }
+		// for each instruction of an optimized program, where its source
+		// continues after an error; nullptr for other programs
+		const size_t* resume() const { return m_resumeData; }
+		size_t size() const { return m_size; }
+		bool empty() const { return m_size == 0; }
+		bool mapped() const { return m_mapped; }
+
+		static OpCode opFromChar(char c);
+		static bool fold(OpCode op, double d1, double d2, double& result);
+		// ops whose arg is an instruction to go to
+		static bool isBranch(OpCode op)
+		{
+			return op >= OP_JUMP && op <= OP_CALL;
+		}
+
+	private:
+		struct SBranch
+		{
+			size_t at;					// where the branch is
+			SInstruction instruction;	// the branch, but for its target
+			string_view label;			// its label, in the program text
+		};
+
+		void emit(OpCode op, int arg);
+		int addConstant(double value);
+		void dropLast();
+		bool reduceLast(vector<size_t>& depths, size_t barrier);
+		static size_t depthAfter(const SInstruction& instruction,
+			size_t depth);
+		void own();
+
+		vector<SInstruction> m_code;
+		vector<double> m_constants;
+		vector<size_t> m_resume;
+		vector<size_t> m_depths;
+		vector<size_t> m_starts;
+		vector<bool> m_joins;
+		unordered_map<string, size_t> m_labels;
+		vector<SBranch> m_branches;
+		const SInstruction* m_codeData;
+		size_t m_size;
+		const double* m_constantData;
+		size_t m_constantCount;
+		const size_t* m_resumeData;
+		bool m_mapped;
+	};
+}
+
+#endif
@@ -0,0 +1,486 @@
+#include "rpnProgramFile.h"
+#include "rpnLibrary.h"
+#include "rpnOperators.h"
+#include "rpnRegisters.h"
+#include <cstring>
+#include <fstream>
+//-------------------------------------------------------------------------------------------
+//    Class:		CRPNProgramFile
+//
+//    File:			rpnProgramFile.cpp
+//
+//    Description:	This file contains the function definitions for
+//					CRPNProgramFile
+//
+//    Programmer:	Han Jung
+//
+//    Date:			10/17/2026
+//
+//    Version:		1.0
+//
+//    Environment:	Intel Xeon PC
+//                  Software:   MS Windows 10 for execution;
+//                  Compiles under Microsoft Visual C++ 2017 (/std:c++17)
+//
+//	  class:		CRPNProgramFile
+//
+//	  Non-inline Methods:
+//				static bool isProgramFile(string_view data);
+//				static bool read(string_view data, SProgramImage& image);
+//				static bool write(const string& filename,
+//					const vector<string_view>& lines,
+//					const CRPNProgram& compiled,
+//					const CRPNProgram& optimized,
+//					const CRPNRegisterNames& names,
+//					const CRPNLibrary& library);
+//				static bool bind(string_view bindings,
+//					CRPNRegisterNames& names, CRPNLibrary& library);
+//				static uint64_t checksum(const char* data, size_t size);
+//
+//				private:
+//					static bool valid(const SInstruction* code, size_t size,
+//						size_t constants, const size_t* resume,
+//						size_t sourceSize, const size_t* bound);
+//
+//    History Log:
+//				10/17/2026	HJ binary program files, version 1.0
+// ----------------------------------------------------------------------------
+namespace PB_CALC
+{
+	namespace
+	{
+		const uint32_t byteOrderMark = 0x01020304;
+		const size_t sectionAlign = 8;
+
+		// the layout field of a file this machine writes
+		const uint32_t nativeLayout = static_cast<uint32_t>(
+			sizeof(SInstruction) | sizeof(double) << 8 | sizeof(size_t) << 16);
+
+		// binding kinds, the first character of a binding line
+		const char bindRegister = 'r';
+		const char bindProgram = 'p';
+		const char bindOperator = 'o';
+
+		//--------------------------------------------------------------------
+		//	Function:		section(size_t fileSize, size_t& offset,
+		//						uint64_t count, size_t unit, size_t& at)
+		//	Description:	places a section of count items of unit bytes
+		//					at the next aligned offset, and moves offset
+		//					past it
+		//	Returns:		false if the section runs past the file
+		//--------------------------------------------------------------------
+		bool section(size_t fileSize, size_t& offset, uint64_t count,
+			size_t unit, size_t& at)
+		{
+			at = (offset + sectionAlign - 1) / sectionAlign * sectionAlign;
+			if (at > fileSize || count > (fileSize - at) / unit)
+				return false;
+			offset = at + static_cast<size_t>(count) * unit;
+			return true;
+		}
+
+		//--------------------------------------------------------------------
+		//	Function:		append(vector<char>& buffer, const void* data,
+		//						size_t size)
+		//	Description:	appends a section to a file being written,
+		//					starting it at the next aligned offset
+		//	Returns:		n/a
+		//--------------------------------------------------------------------
+		void append(vector<char>& buffer, const void* data, size_t size)
+		{
+			buffer.resize((buffer.size() + sectionAlign - 1) / sectionAlign
+				* sectionAlign, '\0');
+			const char* const bytes = static_cast<const char*>(data);
+			buffer.insert(buffer.end(), bytes, bytes + size);
+		}
+
+		//--------------------------------------------------------------------
+		//	Function:		nextBinding(string_view& rest, char& kind,
+		//						string_view& name)
+		//	Description:	takes the first binding line, "kind name", off
+		//					rest
+		//	Returns:		false at the end, or at a line that is not a
+		//					binding
+		//--------------------------------------------------------------------
+		bool nextBinding(string_view& rest, char& kind, string_view& name)
+		{
+			const size_t end = rest.find('\n');
+			if (end == string_view::npos || end < 3 || rest[1] != ' ')
+				return false;
+			kind = rest[0];
+			name = rest.substr(2, end - 2);
+			rest.remove_prefix(end + 1);
+			return kind == bindRegister || kind == bindProgram
+				|| kind == bindOperator;
+		}
+	}
+
+	//-------------------------------------------------------------------------
+	//		method:			isProgramFile(string_view data)
+	//		description:	tells a program file from program text
+	//		calls:			n/a
+	//		called by:		read()
+	//						CRPNEngine::loadProgramFile()
+	//		parameters:		string_view data -- the file's contents
+	//		returns:		bool -- true if data starts with
+	//						PROGRAMFILEMAGIC
+	//		History Log:
+	//					10/17/2026 HJ completed version 1.0
+	// -------------------------------------------------------------------------
+	bool CRPNProgramFile::isProgramFile(string_view data)
+	{
+		return data.size() >= sizeof(PROGRAMFILEMAGIC)
+			&& memcmp(data.data(), PROGRAMFILEMAGIC,
+				sizeof(PROGRAMFILEMAGIC)) == 0;
+	}
+	//-------------------------------------------------------------------------
+	//		method:			read(string_view data, SProgramImage& image)
+	//		description:	finds the sections of a program file, without
+	//						copying them.  The checksum must match, and
+	//						the code is checked for arguments that would
+	//						reach outside its constants, its own length,
+	//						the registers or the names it was bound to, so
+	//						a damaged file cannot make the engine read
+	//						out of bounds.  A file written on a machine
+	//						with another layout reads with native false:
+	//						only its text and bindings are usable.
+	//		calls:			isProgramFile()
+	//						checksum()
+	//						valid()
+	//		called by:		CRPNEngine::loadProgramFile()
+	//		parameters:		string_view data -- the file, mapped; it must
+	//						start on a multiple of 8 bytes
+	//						SProgramImage& image -- receives the sections
+	//		returns:		bool -- false if data is not a program file of
+	//						this version, is damaged or is misaligned
+	//		History Log:
+	//					10/17/2026 HJ completed version 1.0
+	// -------------------------------------------------------------------------
+	bool CRPNProgramFile::read(string_view data, SProgramImage& image)
+	{
+		SProgramFileHeader header;
+		if (!isProgramFile(data) || data.size() < sizeof(header)
+			|| reinterpret_cast<uintptr_t>(data.data()) % sectionAlign != 0)
+			return false;
+		memcpy(&header, data.data(), sizeof(header));
+		const char* const base = data.data();
+		const size_t size = data.size();
+		if (header.byteOrder != byteOrderMark
+			|| header.version != PROGRAMFILEVERSION
+			|| header.checksum != checksum(base + sizeof(header),
+				size - sizeof(header)))
+			return false;
+
+		size_t offset = sizeof(header);
+		size_t at = 0;
+		if (!section(size, offset, header.textSize, 1, at))
+			return false;
+		image.text = string_view(base + at, offset - at);
+		if (!section(size, offset, header.bindingSize, 1, at))
+			return false;
+		image.bindings = string_view(base + at, offset - at);
+		// bound[] counts the registers, programs and operators named
+		size_t bound[3] = { 0, 0, 0 };
+		string_view rest = image.bindings;
+		char kind = '\0';
+		string_view name;
+		while (nextBinding(rest, kind, name))
+			bound[kind == bindRegister ? 0 : kind == bindProgram ? 1 : 2]++;
+		if (!rest.empty())
+			return false;
+
+		image.native = (header.layout == nativeLayout);
+		image.compiled = nullptr;
+		image.compiledSize = 0;
+		image.compiledConstants = nullptr;
+		image.compiledConstantCount = 0;
+		image.optimized = nullptr;
+		image.optimizedSize = 0;
+		image.optimizedConstants = nullptr;
+		image.optimizedConstantCount = 0;
+		image.resume = nullptr;
+		if (!image.native)
+			return true;
+
+		if (!section(size, offset, header.compiledSize, sizeof(SInstruction),
+			at))
+			return false;
+		image.compiled = reinterpret_cast<const SInstruction*>(base + at);
+		image.compiledSize = static_cast<size_t>(header.compiledSize);
+		if (!section(size, offset, header.compiledConstants, sizeof(double),
+			at))
+			return false;
+		image.compiledConstants = reinterpret_cast<const double*>(base + at);
+		image.compiledConstantCount
+			= static_cast<size_t>(header.compiledConstants);
+		if (!section(size, offset, header.optimizedSize, sizeof(SInstruction),
+			at))
+			return false;
+		image.optimized = reinterpret_cast<const SInstruction*>(base + at);
+		image.optimizedSize = static_cast<size_t>(header.optimizedSize);
+		if (!section(size, offset, header.optimizedConstants, sizeof(double),
+			at))
+			return false;
+		image.optimizedConstants = reinterpret_cast<const double*>(base + at);
+		image.optimizedConstantCount
+			= static_cast<size_t>(header.optimizedConstants);
+		if (!section(size, offset, header.optimizedSize, sizeof(size_t), at))
+			return false;
+		if (image.optimizedSize > 0)
+			image.resume = reinterpret_cast<const size_t*>(base + at);
+		return offset == size
+			&& valid(image.compiled, image.compiledSize,
+				image.compiledConstantCount, nullptr, 0, bound)
+			&& valid(image.optimized, image.optimizedSize,
+				image.optimizedConstantCount, image.resume,
+				image.compiledSize, bound);
+	}
+	//-------------------------------------------------------------------------
+	//		method:			write(const string& filename,
+	//							const vector<string_view>& lines,
+	//							const CRPNProgram& compiled,
+	//							const CRPNProgram& optimized,
+	//							const CRPNRegisterNames& names,
+	//							const CRPNLibrary& library)
+	//		description:	writes a program file.  The bindings are every
+	//						named register, library program and custom
+	//						operator in slot order, so an engine that
+	//						gives the same names the same slots can run
+	//						the code as it is.
+	//		calls:			checksum()
+	//		called by:		CRPNEngine::saveProgramBinary()
+	//		parameters:		const string& filename -- the file to write
+	//						const vector<string_view>& lines -- the text
+	//						const CRPNProgram& compiled -- lines, compiled
+	//						const CRPNProgram& optimized -- compiled,
+	//						optimized
+	//						const CRPNRegisterNames& names -- the slots of
+	//						the named registers
+	//						const CRPNLibrary& library -- the slots of the
+	//						library programs
+	//		returns:		bool -- false if the file could not be written
+	//		History Log:
+	//					10/17/2026 HJ completed version 1.0
+	// -------------------------------------------------------------------------
+	bool CRPNProgramFile::write(const string& filename,
+		const vector<string_view>& lines, const CRPNProgram& compiled,
+		const CRPNProgram& optimized, const CRPNRegisterNames& names,
+		const CRPNLibrary& library)
+	{
+		string bindings;
+		for (size_t i = 0; i < names.size(); i++)
+		{
+			bindings += bindRegister;
+			bindings += ' ';
+			bindings += names.name(NUMREGS + static_cast<int>(i));
+			bindings += '\n';
+		}
+		for (size_t i = 0; i < library.size(); i++)
+		{
+			bindings += bindProgram;
+			bindings += ' ';
+			bindings += library.program(static_cast<int>(i)).name;
+			bindings += '\n';
+		}
+		// the first character found for each custom operator; bind()
+		// only needs one of them to lead to the same index
+		for (size_t i = 0; i < CRPNOperators::customCount(); i++)
+			for (int c = 1; c < 256; c++)
+			{
+				const SOperator& entry = CRPNOperators::find(
+					static_cast<char>(c));
+				if (entry.op == OP_CUSTOM
+					&& entry.arg == static_cast<int>(i))
+				{
+					bindings += bindOperator;
+					bindings += ' ';
+					bindings += static_cast<char>(c);
+					bindings += '\n';
+					break;
+				}
+			}
+
+		SProgramFileHeader header;
+		memset(&header, 0, sizeof(header));
+		memcpy(header.magic, PROGRAMFILEMAGIC, sizeof(header.magic));
+		header.version = PROGRAMFILEVERSION;
+		header.byteOrder = byteOrderMark;
+		header.layout = nativeLayout;
+		header.bindingSize = bindings.size();
+		header.compiledSize = compiled.size();
+		header.compiledConstants = compiled.constantCount();
+		header.optimizedSize = optimized.size();
+		header.optimizedConstants = optimized.constantCount();
+
+		vector<char> buffer(sizeof(header));
+		for (string_view line : lines)
+		{
+			buffer.insert(buffer.end(), line.begin(), line.end());
+			buffer.push_back('\n');
+		}
+		header.textSize = buffer.size() - sizeof(header);
+		append(buffer, bindings.data(), bindings.size());
+		append(buffer, compiled.code(),
+			compiled.size() * sizeof(SInstruction));
+		append(buffer, compiled.constants(),
+			compiled.constantCount() * sizeof(double));
+		append(buffer, optimized.code(),
+			optimized.size() * sizeof(SInstruction));
+		append(buffer, optimized.constants(),
+			optimized.constantCount() * sizeof(double));
+		append(buffer, optimized.resume(),
+			optimized.resume() != nullptr ? optimized.size() * sizeof(size_t)
+			: 0);
+		header.checksum = checksum(buffer.data() + sizeof(header),
+			buffer.size() - sizeof(header));
+		memcpy(buffer.data(), &header, sizeof(header));
+
+		ofstream fout(filename, ios::out | ios::trunc | ios::binary);
+		if (!fout.is_open())
+			return false;
+		fout.write(buffer.data(), static_cast<streamsize>(buffer.size()));
+		fout.close();
+		return !fout.fail();
+	}
+	//-------------------------------------------------------------------------
+	//		method:			bind(string_view bindings,
+	//							CRPNRegisterNames& names,
+	//							CRPNLibrary& library)
+	//		description:	gives each name in a file's bindings its slot,
+	//						as compiling the text would, and checks that it
+	//						is the slot the code was compiled with.  Each
+	//						custom operator must be the one at its index.
+	//		calls:			CRPNRegisterNames::slot()
+	//						CRPNLibrary::slot()
+	//						CRPNOperators::find()
+	//		called by:		CRPNEngine::loadProgramFile()
+	//		parameters:		string_view bindings -- the file's bindings,
+	//						from read()
+	//						CRPNRegisterNames& names -- the engine's names
+	//						CRPNLibrary& library -- the engine's library
+	//		returns:		bool -- false if a slot differs, in which case
+	//						the code cannot be used and the text must be
+	//						compiled
+	//		History Log:
+	//					10/17/2026 HJ completed version 1.0
+	// -------------------------------------------------------------------------
+	bool CRPNProgramFile::bind(string_view bindings, CRPNRegisterNames& names,
+		CRPNLibrary& library)
+	{
+		int count[3] = { 0, 0, 0 };
+		char kind = '\0';
+		string_view name;
+		while (nextBinding(bindings, kind, name))
+		{
+			if (kind == bindRegister)
+			{
+				if (names.slot(name) != NUMREGS + count[0]++)
+					return false;
+			}
+			else if (kind == bindProgram)
+			{
+				if (library.slot(name) != count[1]++)
+					return false;
+			}
+			else
+			{
+				const SOperator& entry = CRPNOperators::find(name[0]);
+				if (name.size() != 1 || entry.op != OP_CUSTOM
+					|| entry.arg != count[2]++)
+					return false;
+			}
+		}
+		return true;
+	}
+	//-------------------------------------------------------------------------
+	//		method:			checksum(const char* data, size_t size)
+	//		description:	the checksum of a program file.  It runs over
+	//						8-byte words in four independent lanes, so a
+	//						file of millions of instructions checks in a
+	//						fraction of the time it takes to fault it in;
+	//						every step is invertible, so a change to any
+	//						one word always changes the result.
+	//		calls:			n/a
+	//		called by:		read()
+	//						write()
+	//		parameters:		const char* data -- the bytes
+	//						size_t size -- how many
+	//		returns:		uint64_t -- the checksum
+	//		History Log:
+	//					10/17/2026 HJ completed version 1.0
+	// -------------------------------------------------------------------------
+	uint64_t CRPNProgramFile::checksum(const char* data, size_t size)
+	{
+		const uint64_t prime = 0x100000001B3ULL;		// FNV-1a's
+		const uint64_t basis = 0xCBF29CE484222325ULL;
+		uint64_t lanes[4] = { basis, basis + 1, basis + 2, basis + 3 };
+		size_t i = 0;
+		for (; i + 4 * sizeof(uint64_t) <= size; i += 4 * sizeof(uint64_t))
+			for (int lane = 0; lane < 4; lane++)
+			{
+				uint64_t word;
+				memcpy(&word, data + i + lane * sizeof(uint64_t),
+					sizeof(word));
+				lanes[lane] = (lanes[lane] ^ word) * prime;
+			}
+		uint64_t hash = basis ^ size;
+		for (int lane = 0; lane < 4; lane++)
+			hash = (hash ^ lanes[lane]) * prime;
+		for (; i < size; i++)
+			hash = (hash ^ static_cast<unsigned char>(data[i])) * prime;
+		return hash ^ (hash >> 32);
+	}
+	//-------------------------------------------------------------------------
+	//		method:			valid(const SInstruction* code, size_t size,
+	//							size_t constants, const size_t* resume,
+	//							size_t sourceSize, const size_t* bound)
+	//		description:	checks that a program's arguments stay inside
+	//						what the engine will index with them
+	//		calls:			CRPNProgram::isBranch()
+	//		called by:		read()
+	//		parameters:		const SInstruction* code -- the instructions
+	//						size_t size -- how many
+	//						size_t constants -- the size of the constant
+	//						pool
+	//						const size_t* resume -- the resume table, or
+	//						nullptr for a compiled program
+	//						size_t sourceSize -- instructions of the
+	//						program resume leads into
+	//						const size_t* bound -- the number of named
+	//						registers, library programs and custom
+	//						operators in the bindings
+	//		returns:		bool -- false if an argument is out of range
+	//		History Log:
+	//					10/17/2026 HJ completed version 1.0
+	// -------------------------------------------------------------------------
+	bool CRPNProgramFile::valid(const SInstruction* code, size_t size,
+		size_t constants, const size_t* resume, size_t sourceSize,
+		const size_t* bound)
+	{
+		// one past the largest argument of each op; 0 for bytes that are
+		// not ops, which no argument passes
+		size_t limits[256] = {};
+		for (int op = 0; op <= OP_MODCONST; op++)
+			limits[op] = CRPNProgram::isBranch(static_cast<OpCode>(op))
+				? size + 1 : SIZE_MAX;
+		limits[OP_PUSH] = limits[OP_NEGZERO] = constants;
+		for (int op = OP_ADDCONST; op <= OP_MODCONST; op++)
+			limits[op] = constants;
+		limits[OP_SETREG] = limits[OP_GETREG] = NUMREGS + bound[0];
+		limits[OP_RUNPROGRAM] = bound[1];
+		limits[OP_CUSTOM] = bound[2];
+		for (size_t i = 0; i < size; i++)
+		{
+			const SInstruction& instruction = code[i];
+			if (instruction.arg < 0 || static_cast<size_t>(instruction.arg)
+				>= limits[instruction.op] || (instruction.op == OP_LOOP
+					&& instruction.reg >= NUMREGS))
+				return false;
+		}
+		if (resume != nullptr)
+			for (size_t i = 0; i < size; i++)
+				if (resume[i] > sourceSize)
+					return false;
+		return true;
+	}
+}
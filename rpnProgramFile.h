@@ -0,0 +1,142 @@
+//----------------------------------------------------------------------------
+//    File:		rpnProgramFile.h
+//
+//    Class:	CRPNProgramFile
+//----------------------------------------------------------------------------
+#ifndef RPNPROGRAMFILE_H
+#define RPNPROGRAMFILE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+#include "rpnProgram.h"
+//----------------------------------------------------------------------------
+//
+//    Title:		RPNProgramFile Class
+//
+//    Description:	This file contains the class definition for
+//					CRPNProgramFile, the binary program file format.  A
+//					program file holds a program compiled and optimized,
+//					so loading it needs no parsing: the file is mapped,
+//					checked, and its instructions and constants are run
+//					where they lie.  It also holds the program's text,
+//					for P, for saving it as text again and for engines
+//					the code does not fit, and the names the code was
+//					compiled against (named registers, library programs
+//					and custom operators), since instructions hold their
+//					slots and not their names.
+//
+//					Layout: an SProgramFileHeader, then the text, the
+//					binding lines, the compiled code and constants, and
+//					the optimized code, constants and resume table, each
+//					starting on a multiple of 8 bytes.  The header gives
+//					every size, and a checksum of everything after it.
+//					Code is stored as the machine that wrote it holds it;
+//					a machine with another layout uses the text instead.
+//
+//    Programmer:	Han Jung
+//
+//    Date:			10/17/2026
+//
+//    Version:		1.0
+//
+//    Environment:
+//       Hardware: Intel Xeon PC
+//       Software: Windows 10
+//       Compiles under Microsoft Visual C++ 2017 (/std:c++17)
+//
+//	  class CRPNProgramFile:
+//
+//	  Methods:
+//
+//		non-inline:
+//		public:
+//			static bool isProgramFile(string_view data);
+//			static bool read(string_view data, SProgramImage& image);
+//			static bool write(const string& filename,
+//				const vector<string_view>& lines,
+//				const CRPNProgram& compiled, const CRPNProgram& optimized,
+//				const CRPNRegisterNames& names,
+//				const CRPNLibrary& library);
+//			static bool bind(string_view bindings,
+//				CRPNRegisterNames& names, CRPNLibrary& library);
+//			static uint64_t checksum(const char* data, size_t size);
+//		private:
+//			static bool valid(const SInstruction* code, size_t size,
+//				size_t constants, const size_t* resume, size_t sourceSize,
+//				const size_t* bound);
+//
+//    History Log:
+//			10/17/2026	HJ  binary program files, version 1.0
+// ----------------------------------------------------------------------------
+
+using namespace std;
+
+namespace PB_CALC
+{
+	// first bytes of every program file
+	const char PROGRAMFILEMAGIC[8] = { 'R', 'P', 'N', 'P', 'R', 'O', 'G',
+		'\x1A' };
+	// raise it whenever OpCode or SInstruction changes
+	const uint32_t PROGRAMFILEVERSION = 1;
+	// the shell saves a program with this extension as a program file
+	const char PROGRAMFILEEXTENSION[] = ".rpnb";
+
+	struct SProgramFileHeader
+	{
+		char magic[8];				// PROGRAMFILEMAGIC
+		uint32_t version;			// PROGRAMFILEVERSION
+		uint32_t byteOrder;			// 0x01020304 as the writer stores it
+		uint32_t layout;			// sizes of SInstruction, double, size_t
+		uint32_t reserved;			// 0
+		uint64_t checksum;			// of every byte after the header
+		uint64_t textSize;			// bytes of program text
+		uint64_t bindingSize;		// bytes of binding lines
+		uint64_t compiledSize;		// instructions
+		uint64_t compiledConstants;
+		uint64_t optimizedSize;		// instructions, and resume entries
+		uint64_t optimizedConstants;
+	};
+
+	// a program file's sections, as read() finds them in the mapping
+	struct SProgramImage
+	{
+		string_view text;
+		string_view bindings;
+		bool native;				// the code below is usable here
+		const SInstruction* compiled;
+		size_t compiledSize;
+		const double* compiledConstants;
+		size_t compiledConstantCount;
+		const SInstruction* optimized;
+		size_t optimizedSize;
+		const double* optimizedConstants;
+		size_t optimizedConstantCount;
+		const size_t* resume;
+	};
+
+	class CRPNLibrary;
+
+	class CRPNProgramFile
+	{
+	public:
+		static bool isProgramFile(string_view data);
+		static bool read(string_view data, SProgramImage& image);
+		static bool write(const string& filename,
+			const vector<string_view>& lines, const CRPNProgram& compiled,
+			const CRPNProgram& optimized, const CRPNRegisterNames& names,
+			const CRPNLibrary& library);
+		static bool bind(string_view bindings, CRPNRegisterNames& names,
+			CRPNLibrary& library);
+		static uint64_t checksum(const char* data, size_t size);
+
+	private:
+		static bool valid(const SInstruction* code, size_t size,
+			size_t constants, const size_t* resume, size_t sourceSize,
+			const size_t* bound);
+	};
+}
+
+#endif
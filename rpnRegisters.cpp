@@ -0,0 +1,180 @@
+#include "rpnRegisters.h"
+#include <cctype>
+//-------------------------------------------------------------------------------------------
+//    Class:		CRPNRegisterNames
+//
+//    File:			rpnRegisters.cpp
+//
+//    Description:	This file contains the function definitions for
+//					CRPNRegisterNames
+//
+//    Programmer:	Han Jung
+//
+//    Date:			10/17/2026
+//
+//    Version:		1.0
+//
+//    Environment:	Intel Xeon PC
+//                  Software:   MS Windows 10 for execution;
+//                  Compiles under Microsoft Visual C++ 2017 (/std:c++17)
+//
+//	  class:		CRPNRegisterNames
+//
+//	  Properties:
+//				CRPNArena m_text;
+//				unordered_map<string_view, int> m_slots;
+//				vector<string_view> m_names;
+//
+//	  Non-inline Methods:
+//				CRPNRegisterNames();
+//				void assign(const CRPNRegisterNames& source);
+//				int slot(string_view name);
+//				int find(string_view name) const;
+//				string_view name(int slot) const;
+//
+//				private:
+//					static bool fold(string_view name, char* buffer);
+//
+//    History Log:
+//				10/17/2026	HJ named registers, version 1.0
+//				10/17/2026	HJ assign(), version 1.1
+// ----------------------------------------------------------------------------
+namespace PB_CALC
+{
+	//-------------------------------------------------------------------------
+	//		method:			CRPNRegisterNames()
+	//		description:	constructor; no names
+	//		calls:			n/a
+	//		called by:		CRPNEngine()
+	//						CRPNTypedEngine<T>()
+	//		parameters:		n/a
+	//		returns:		n/a
+	//		History Log:
+	//					10/17/2026 HJ completed version 1.0
+	// -------------------------------------------------------------------------
+	CRPNRegisterNames::CRPNRegisterNames() : m_text(MAXREGNAME * 64)
+	{
+	}
+	//-------------------------------------------------------------------------
+	//		method:			assign(const CRPNRegisterNames& source)
+	//		description:	makes the names, and their slots, those of
+	//						source, so that code compiled against source
+	//						reads the same registers here
+	//		calls:			slot()
+	//						CRPNArena::reset()
+	//		called by:		CRPNEngine::copyLibrary()
+	//		parameters:		const CRPNRegisterNames& source -- the names
+	//						to copy
+	//		returns:		n/a
+	//		History Log:
+	//					10/17/2026 HJ completed version 1.0
+	// -------------------------------------------------------------------------
+	void CRPNRegisterNames::assign(const CRPNRegisterNames& source)
+	{
+		if (&source == this)
+			return;
+		m_text.reset();
+		m_slots.clear();
+		m_names.clear();
+		// in slot order, so each name gets the slot it has in source
+		for (string_view name : source.m_names)
+			slot(name);
+	}
+	//-------------------------------------------------------------------------
+	//		method:			slot(string_view name)
+	//		description:	the slot of a named register, giving the name
+	//						the next free slot if it has none yet
+	//		calls:			fold()
+	//						CRPNArena::copy()
+	//		called by:		CRPNEngine::registerSlot()
+	//						CRPNTypedEngine<T>::registerSlot()
+	//						CRPNProgram::compileLine()
+	//		parameters:		string_view name -- the name, without "S:"
+	//		returns:		int -- the slot, or -1 if the name is not valid
+	//						or every slot is taken
+	//		History Log:
+	//					10/17/2026 HJ completed version 1.0
+	// -------------------------------------------------------------------------
+	int CRPNRegisterNames::slot(string_view name)
+	{
+		char buffer[MAXREGNAME];
+		if (!fold(name, buffer))
+			return -1;
+		const string_view key(buffer, name.size());
+		unordered_map<string_view, int>::const_iterator it = m_slots.find(key);
+		if (it != m_slots.end())
+			return it->second;
+		if (registerCount() >= MAXREGS)
+			return -1;
+		const int slot = registerCount();
+		const string_view stored = m_text.copy(key);
+		m_slots.emplace(stored, slot);
+		m_names.push_back(stored);
+		return slot;
+	}
+	//-------------------------------------------------------------------------
+	//		method:			find(string_view name) const
+	//		description:	the slot of a named register, without giving it
+	//						one
+	//		calls:			fold()
+	//		called by:		embedding code
+	//		parameters:		string_view name -- the name, without "S:"
+	//		returns:		int -- the slot, or -1 if the name has none
+	//		History Log:
+	//					10/17/2026 HJ completed version 1.0
+	// -------------------------------------------------------------------------
+	int CRPNRegisterNames::find(string_view name) const
+	{
+		char buffer[MAXREGNAME];
+		if (!fold(name, buffer))
+			return -1;
+		unordered_map<string_view, int>::const_iterator it
+			= m_slots.find(string_view(buffer, name.size()));
+		return (it != m_slots.end()) ? it->second : -1;
+	}
+	//-------------------------------------------------------------------------
+	//		method:			name(int slot) const
+	//		description:	the name given a slot
+	//		calls:			n/a
+	//		called by:		embedding code
+	//		parameters:		int slot -- the slot
+	//		returns:		string_view -- the name in upper case, or empty
+	//						for S0-S9 and slots not given out
+	//		History Log:
+	//					10/17/2026 HJ completed version 1.0
+	// -------------------------------------------------------------------------
+	string_view CRPNRegisterNames::name(int slot) const
+	{
+		if (slot < NUMREGS || slot >= registerCount())
+			return string_view();
+		return m_names[slot - NUMREGS];
+	}
+	//-------------------------------------------------------------------------
+	//		method:			fold(string_view name, char* buffer)
+	//		description:	checks a name and copies it to buffer in upper
+	//						case
+	//		calls:			n/a
+	//		called by:		slot()
+	//						find()
+	//		parameters:		string_view name -- the name
+	//						char* buffer -- MAXREGNAME characters
+	//		returns:		bool -- false if the name is empty, too long or
+	//						has a character other than a letter, digit or
+	//						'_'
+	//		History Log:
+	//					10/17/2026 HJ completed version 1.0
+	// -------------------------------------------------------------------------
+	bool CRPNRegisterNames::fold(string_view name, char* buffer)
+	{
+		if (name.empty() || name.size() > MAXREGNAME)
+			return false;
+		for (size_t i = 0; i < name.size(); i++)
+		{
+			const unsigned char c = static_cast<unsigned char>(name[i]);
+			if (!isalnum(c) && c != '_')
+				return false;
+			buffer[i] = static_cast<char>(toupper(c));
+		}
+		return true;
+	}
+}
@@ -0,0 +1,108 @@
+//----------------------------------------------------------------------------
+//    File:		rpnRegisters.h
+//
+//    Class:	CRPNRegisterNames
+//----------------------------------------------------------------------------
+#ifndef RPNREGISTERS_H
+#define RPNREGISTERS_H
+
+#include <cstddef>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+#include "rpnArena.h"
+//----------------------------------------------------------------------------
+//
+//    Title:		RPNRegisterNames Class
+//
+//    Description:	This file contains the class definition for
+//					CRPNRegisterNames, the names of an engine's named
+//					registers.  The register file has MAXREGS slots: S0-S9
+//					are slots 0 to 9, and "S:name"/"G:name" give a name a
+//					slot of its own the first time it is used, counting up
+//					from NUMREGS.  A compiled program holds slots, so the
+//					lookup is paid once per program, not once per run.
+//
+//					Names are letters, digits and '_', at most
+//					MAXREGNAME of them, and are not case sensitive, like
+//					the rest of the commands.  A name keeps its slot for
+//					the life of the table.
+//
+//    Programmer:	Han Jung
+//
+//    Date:			10/17/2026
+//
+//    Version:		1.0
+//
+//    Environment:
+//       Hardware: Intel Xeon PC
+//       Software: Windows 10
+//       Compiles under Microsoft Visual C++ 2017 (/std:c++17)
+//
+//	  class CRPNRegisterNames:
+//
+//	  Properties:
+//		CRPNArena m_text -- the names, upper case
+//		unordered_map<string_view, int> m_slots -- slot of each name,
+//			keyed by views of m_text
+//		vector<string_view> m_names -- the names by slot, from NUMREGS
+//
+//	  Methods:
+//
+//		inline:
+//			size_t size() const;
+//			int registerCount() const;
+//
+//		non-inline:
+//		public:
+//			CRPNRegisterNames();
+//			void assign(const CRPNRegisterNames& source);
+//			int slot(string_view name);
+//			int find(string_view name) const;
+//			string_view name(int slot) const;
+//		private:
+//			static bool fold(string_view name, char* buffer);
+//
+//    History Log:
+//			10/17/2026	HJ  named registers, version 1.0
+//			10/17/2026	HJ  assign(), version 1.1
+// ----------------------------------------------------------------------------
+
+using namespace std;
+
+namespace PB_CALC
+{
+	const unsigned short NUMREGS = 10;		// S0-S9
+	const unsigned short MAXREGS = 1024;	// S0-S9 and the named registers
+	const size_t MAXREGNAME = 32;
+
+	class CRPNRegisterNames
+	{
+	public:
+		CRPNRegisterNames();
+		void assign(const CRPNRegisterNames& source);
+		int slot(string_view name);
+		int find(string_view name) const;
+		string_view name(int slot) const;
+
+		// names given a slot so far
+		size_t size() const { return m_names.size(); }
+		// slots in use: S0-S9 and one per name
+		int registerCount() const
+		{
+			return NUMREGS + static_cast<int>(m_names.size());
+		}
+
+	private:
+		CRPNRegisterNames(const CRPNRegisterNames&);
+		CRPNRegisterNames& operator=(const CRPNRegisterNames&);
+
+		static bool fold(string_view name, char* buffer);
+
+		CRPNArena m_text;
+		unordered_map<string_view, int> m_slots;
+		vector<string_view> m_names;
+	};
+}
+
+#endif
@@ -0,0 +1,687 @@
+#include "rpnServer.h"
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#if defined(__linux__)
+#include <cerrno>
+#include <fcntl.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#include <sys/resource.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/un.h>
+#include <unistd.h>
+#endif
+//-------------------------------------------------------------------------------------------
+//    Class:		CRPNServer
+//
+//    File:			rpnServer.cpp
+//
+//    Description:	This file contains the function definitions for
+//					CRPNServer
+//
+//    Programmer:	Han Jung
+//
+//    Date:			10/17/2026
+//
+//    Version:		1.0
+//
+//    Environment:	Intel Xeon PC
+//                  Software:   Linux for the server; MS Windows 10 builds
+//                  it without one
+//                  Compiles under Microsoft Visual C++ 2017 (/std:c++17)
+//
+//	  class:		CRPNServer
+//
+//	  Properties:
+//				int m_listen;
+//				int m_epoll;
+//				int m_wake;
+//				int m_spare;
+//				string m_path;
+//				CRPNEngine m_libraryEngine;
+//				uint64_t m_jumpLimit;
+//				vector<unique_ptr<SSession>> m_sessions;
+//				size_t m_open;
+//				string m_buffer;
+//				CRPNStats m_closedStats;
+//				bool m_stopping;
+//
+//	  Non-inline Methods:
+//				CRPNServer();
+//				~CRPNServer();
+//				bool listen(const string& address);
+//				bool run();
+//				void stop();
+//				bool loadLibrary(const string& filename);
+//				bool mergeStats(CRPNStats& total) const;
+//				static bool supported();
+//
+//				private:
+//					void acceptSessions();
+//					void closeSession(int fd);
+//					void closeAll();
+//					void evaluateLine(SSession& session, string_view line);
+//					void evaluateLines(SSession& session, bool last);
+//					bool flush(SSession& session);
+//					void serve(int fd, unsigned events);
+//					bool watch(SSession& session);
+//
+//    History Log:
+//				10/17/2026	HJ epoll evaluation server, version 1.0
+//				10/17/2026	HJ library compiled once, not read per session,
+//									version 1.1
+//				10/17/2026	HJ jump limit per request, version 1.2
+// ----------------------------------------------------------------------------
+namespace PB_CALC
+{
+	//-------------------------------------------------------------------------
+	//		method:			CRPNServer()
+	//		description:	constructor; no socket until listen(), and a
+	//						jump limit of SERVERJUMPLIMIT
+	//		calls:			n/a
+	//		called by:		runServer()
+	//		parameters:		n/a
+	//		returns:		n/a
+	//		History Log:
+	//					10/17/2026 HJ completed version 1.0
+	//					10/17/2026 HJ jump limit, version 1.1
+	// -------------------------------------------------------------------------
+	CRPNServer::CRPNServer() : m_listen(-1), m_epoll(-1), m_wake(-1),
+		m_spare(-1), m_jumpLimit(SERVERJUMPLIMIT), m_open(0),
+		m_stopping(false)
+	{
+	}
+	//-------------------------------------------------------------------------
+	//		method:			~CRPNServer()
+	//		description:	destructor; closes every session and the socket
+	//		calls:			closeAll()
+	//		called by:		main()
+	//		parameters:		n/a
+	//		returns:		n/a
+	//		History Log:
+	//					10/17/2026 HJ completed version 1.0
+	// -------------------------------------------------------------------------
+	CRPNServer::~CRPNServer()
+	{
+		closeAll();
+	}
+	//-------------------------------------------------------------------------
+	//		method:			supported()
+	//		description:	tells whether this build has a server
+	//		calls:			n/a
+	//		called by:		main()
+	//		parameters:		n/a
+	//		returns:		bool -- false where there is no epoll
+	//		History Log:
+	//					10/17/2026 HJ completed version 1.0
+	// -------------------------------------------------------------------------
+	bool CRPNServer::supported()
+	{
+#if defined(__linux__)
+		return true;
+#else
+		return false;
+#endif
+	}
+	//-------------------------------------------------------------------------
+	//		method:			listen(const string& address)
+	//		description:	opens the listening socket.  An address of only
+	//						digits is a TCP port on 127.0.0.1; anything
+	//						else is the path of a Unix domain socket, and a
+	//						socket file left there by a server that did not
+	//						close is replaced.  The descriptor limit is
+	//						raised as far as it goes, since every session
+	//						holds one.
+	//		calls:			closeAll()
+	//		called by:		main()
+	//		parameters:		const string& address -- a port or a path
+	//		returns:		bool -- false if the socket could not be opened
+	//						or this build has no server
+	//		History Log:
+	//					10/17/2026 HJ completed version 1.0
+	// -------------------------------------------------------------------------
+	bool CRPNServer::listen(const string& address)
+	{
+#if defined(__linux__)
+		if (m_listen >= 0 || address.empty())
+			return false;
+		const bool tcp = address.find_first_not_of("0123456789")
+			== string::npos;
+		if (tcp)
+		{
+			const unsigned long port = strtoul(address.c_str(), nullptr, 10);
+			if (port == 0 || port > 65535 || address.size() > 5)
+				return false;
+			m_listen = socket(AF_INET, SOCK_STREAM | SOCK_NONBLOCK
+				| SOCK_CLOEXEC, 0);
+			if (m_listen < 0)
+				return false;
+			const int on = 1;
+			setsockopt(m_listen, SOL_SOCKET, SO_REUSEADDR, &on, sizeof(on));
+			sockaddr_in name;
+			memset(&name, 0, sizeof(name));
+			name.sin_family = AF_INET;
+			name.sin_port = htons(static_cast<uint16_t>(port));
+			name.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+			if (bind(m_listen, reinterpret_cast<sockaddr*>(&name),
+				sizeof(name)) != 0)
+			{
+				closeAll();
+				return false;
+			}
+		}
+		else
+		{
+			sockaddr_un name;
+			memset(&name, 0, sizeof(name));
+			name.sun_family = AF_UNIX;
+			if (address.size() >= sizeof(name.sun_path))
+				return false;
+			memcpy(name.sun_path, address.data(), address.size());
+			m_listen = socket(AF_UNIX, SOCK_STREAM | SOCK_NONBLOCK
+				| SOCK_CLOEXEC, 0);
+			if (m_listen < 0)
+				return false;
+			struct stat status;
+			if (lstat(address.c_str(), &status) == 0
+				&& S_ISSOCK(status.st_mode))
+				unlink(address.c_str());
+			if (bind(m_listen, reinterpret_cast<sockaddr*>(&name),
+				sizeof(name)) != 0)
+			{
+				closeAll();
+				return false;
+			}
+			m_path = address;
+		}
+
+		rlimit limit;
+		if (getrlimit(RLIMIT_NOFILE, &limit) == 0
+			&& limit.rlim_cur < limit.rlim_max)
+		{
+			limit.rlim_cur = limit.rlim_max;
+			setrlimit(RLIMIT_NOFILE, &limit);
+		}
+		m_epoll = epoll_create1(EPOLL_CLOEXEC);
+		m_wake = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+		m_spare = open("/dev/null", O_RDONLY | O_CLOEXEC);
+		epoll_event event;
+		memset(&event, 0, sizeof(event));
+		event.events = EPOLLIN;
+		event.data.fd = m_listen;
+		bool ok = ::listen(m_listen, SOMAXCONN) == 0 && m_epoll >= 0
+			&& m_wake >= 0
+			&& epoll_ctl(m_epoll, EPOLL_CTL_ADD, m_listen, &event) == 0;
+		event.data.fd = m_wake;
+		ok = ok && epoll_ctl(m_epoll, EPOLL_CTL_ADD, m_wake, &event) == 0;
+		if (!ok)
+		{
+			closeAll();
+			return false;
+		}
+		m_buffer.resize(SERVERREADSIZE);
+		m_stopping = false;
+		return true;
+#else
+		(void)address;
+		return false;
+#endif
+	}
+	//-------------------------------------------------------------------------
+	//		method:			run()
+	//		description:	serves sessions until stop() is called, then
+	//						closes them and the socket.  Results a session
+	//						has not been sent yet are dropped.
+	//		calls:			acceptSessions()
+	//						serve()
+	//						closeAll()
+	//		called by:		main()
+	//		parameters:		n/a
+	//		returns:		bool -- false if the server was not listening
+	//						or epoll failed
+	//		History Log:
+	//					10/17/2026 HJ completed version 1.0
+	// -------------------------------------------------------------------------
+	bool CRPNServer::run()
+	{
+#if defined(__linux__)
+		if (m_epoll < 0)
+			return false;
+		epoll_event events[SERVEREVENTS];
+		bool ok = true;
+		while (ok && !m_stopping)
+		{
+			const int count = epoll_wait(m_epoll, events, SERVEREVENTS, -1);
+			if (count < 0)
+			{
+				ok = (errno == EINTR);
+				continue;
+			}
+			for (int i = 0; i < count; i++)
+			{
+				const int fd = events[i].data.fd;
+				if (fd == m_listen)
+					acceptSessions();
+				else if (fd == m_wake)
+					m_stopping = true;
+				else
+					serve(fd, events[i].events);
+			}
+		}
+		closeAll();
+		return ok;
+#else
+		return false;
+#endif
+	}
+	//-------------------------------------------------------------------------
+	//		method:			stop()
+	//		description:	makes run() return.  Safe to call from another
+	//						thread or from a signal handler.
+	//		calls:			n/a
+	//		called by:		stopServer()
+	//						embedding code
+	//		parameters:		n/a
+	//		returns:		n/a
+	//		History Log:
+	//					10/17/2026 HJ completed version 1.0
+	// -------------------------------------------------------------------------
+	void CRPNServer::stop()
+	{
+#if defined(__linux__)
+		if (m_wake >= 0)
+		{
+			const uint64_t one = 1;
+			const ssize_t written = write(m_wake, &one, sizeof(one));
+			(void)written;
+		}
+#endif
+	}
+	//-------------------------------------------------------------------------
+	//		method:			loadLibrary(const string& filename)
+	//		description:	makes every session start with the programs of
+	//						a library file.  The file is read and compiled
+	//						here, once; a session that opens is given a
+	//						copy of the compiled programs, so the event
+	//						loop never waits on the file system.
+	//		calls:			CRPNEngine::loadLibrary()
+	//		called by:		runServer()
+	//		parameters:		const string& filename -- the library file
+	//		returns:		bool -- false if it could not be read or is not
+	//						a library
+	//		History Log:
+	//					10/17/2026 HJ completed version 1.0
+	//					10/17/2026 HJ compiled once here, version 1.1
+	// -------------------------------------------------------------------------
+	bool CRPNServer::loadLibrary(const string& filename)
+	{
+		return m_libraryEngine.loadLibrary(filename);
+	}
+	//-------------------------------------------------------------------------
+	//		method:			mergeStats(CRPNStats& total) const
+	//		description:	adds the statistics of every session, open or
+	//						closed, to total.  Call it when run() is not
+	//						running.
+	//		calls:			CRPNEngine::stats()
+	//						CRPNStats::merge()
+	//		called by:		main()
+	//		parameters:		CRPNStats& total -- receives the counts
+	//		returns:		bool -- false if this build collects none
+	//		History Log:
+	//					10/17/2026 HJ completed version 1.0
+	// -------------------------------------------------------------------------
+	bool CRPNServer::mergeStats(CRPNStats& total) const
+	{
+#if defined(RPNCALC_STATS)
+		total.merge(m_closedStats);
+		for (const unique_ptr<SSession>& session : m_sessions)
+			if (session)
+				total.merge(*session->engine.stats());
+		return true;
+#else
+		(void)total;
+		return false;
+#endif
+	}
+	//-------------------------------------------------------------------------
+	//		method:			acceptSessions()
+	//		description:	opens a session for every waiting connection.
+	//						With no descriptor left, a connection is
+	//						accepted on the spare one and closed at once;
+	//						left waiting, epoll would report it forever.
+	//		calls:			CRPNEngine::copyLibrary()
+	//						CRPNEngine::setJumpLimit()
+	//		called by:		run()
+	//		parameters:		n/a
+	//		returns:		n/a
+	//		History Log:
+	//					10/17/2026 HJ completed version 1.0
+	//					10/17/2026 HJ copies the compiled library,
+	//						version 1.1
+	//					10/17/2026 HJ jump limit per request, version 1.2
+	// -------------------------------------------------------------------------
+	void CRPNServer::acceptSessions()
+	{
+#if defined(__linux__)
+		for (;;)
+		{
+			const int fd = accept4(m_listen, nullptr, nullptr,
+				SOCK_NONBLOCK | SOCK_CLOEXEC);
+			if (fd < 0)
+			{
+				if (errno == EINTR || errno == ECONNABORTED)
+					continue;
+				if ((errno != EMFILE && errno != ENFILE) || m_spare < 0)
+					return;
+				close(m_spare);
+				const int refused = accept(m_listen, nullptr, nullptr);
+				if (refused >= 0)
+					close(refused);
+				m_spare = open("/dev/null", O_RDONLY | O_CLOEXEC);
+				continue;
+			}
+			// results are small and go out as soon as they are ready;
+			// this fails, harmlessly, on a Unix domain socket
+			const int on = 1;
+			setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &on, sizeof(on));
+			unique_ptr<SSession> session(new SSession);
+			session->fd = fd;
+			session->reading = true;
+			session->writing = false;
+			session->closing = false;
+			if (m_libraryEngine.library().size() > 0)
+				session->engine.copyLibrary(m_libraryEngine);
+			session->engine.setJumpLimit(m_jumpLimit, true);
+			epoll_event event;
+			memset(&event, 0, sizeof(event));
+			event.events = EPOLLIN;
+			event.data.fd = fd;
+			if (epoll_ctl(m_epoll, EPOLL_CTL_ADD, fd, &event) != 0)
+			{
+				close(fd);
+				continue;
+			}
+			if (static_cast<size_t>(fd) >= m_sessions.size())
+				m_sessions.resize(fd + 1);
+			m_sessions[fd] = move(session);
+			m_open++;
+		}
+#endif
+	}
+	//-------------------------------------------------------------------------
+	//		method:			serve(int fd, unsigned events)
+	//		description:	handles what epoll reported for a session: reads
+	//						once, evaluates the whole lines received and
+	//						sends what results it can.  A session is only
+	//						closed for what recv() and send() say, never
+	//						for the event bits alone, since a session closed
+	//						earlier in the same epoll_wait() may have
+	//						given its descriptor to a new one.
+	//		calls:			evaluateLines()
+	//						flush()
+	//						watch()
+	//						closeSession()
+	//		called by:		run()
+	//		parameters:		int fd -- the session's socket
+	//						unsigned events -- the epoll events
+	//		returns:		n/a
+	//		History Log:
+	//					10/17/2026 HJ completed version 1.0
+	// -------------------------------------------------------------------------
+	void CRPNServer::serve(int fd, unsigned events)
+	{
+#if defined(__linux__)
+		if (fd < 0 || static_cast<size_t>(fd) >= m_sessions.size()
+			|| !m_sessions[fd])
+			return;
+		SSession& session = *m_sessions[fd];
+		if (session.reading && (events & (EPOLLIN | EPOLLHUP | EPOLLERR)))
+		{
+			const ssize_t count = recv(fd, &m_buffer[0], m_buffer.size(), 0);
+			if (count > 0)
+			{
+				session.input.append(m_buffer.data(),
+					static_cast<size_t>(count));
+				evaluateLines(session, false);
+			}
+			else if (count == 0)
+			{
+				// the client is done sending; a last line without a
+				// line break still counts, as in a batch file
+				evaluateLines(session, true);
+				session.closing = true;
+			}
+			else if (errno != EAGAIN && errno != EWOULDBLOCK
+				&& errno != EINTR)
+			{
+				closeSession(fd);
+				return;
+			}
+		}
+		if (!flush(session))
+			closeSession(fd);
+		else if (session.closing && session.output.empty())
+			closeSession(fd);
+		else if (!watch(session))
+			closeSession(fd);
+#else
+		(void)fd;
+		(void)events;
+#endif
+	}
+	//-------------------------------------------------------------------------
+	//		method:			evaluateLines(SSession& session, bool last)
+	//		description:	evaluates each whole line of a session's input,
+	//						and keeps the partial line after them.  A line
+	//						that grows past SERVERMAXLINE gets an error and
+	//						ends the session, so a client cannot make the
+	//						server hold unbounded input.
+	//		calls:			evaluateLine()
+	//		called by:		serve()
+	//		parameters:		SSession& session -- the session
+	//						bool last -- no more input will come, so a
+	//						partial line is evaluated too
+	//		returns:		n/a
+	//		History Log:
+	//					10/17/2026 HJ completed version 1.0
+	// -------------------------------------------------------------------------
+	void CRPNServer::evaluateLines(SSession& session, bool last)
+	{
+		const char* const first = session.input.data();
+		const char* const end = first + session.input.size();
+		const char* p = first;
+		while (p < end)
+		{
+			const char* newline = static_cast<const char*>(
+				memchr(p, '\n', end - p));
+			if (newline == nullptr && !last)
+				break;
+			if (newline == nullptr)
+				newline = end;
+			const char* lineEnd = newline;
+			if (lineEnd > p && lineEnd[-1] == '\r')
+				lineEnd--;
+			evaluateLine(session, string_view(p, lineEnd - p));
+			p = (newline < end) ? newline + 1 : end;
+		}
+		session.input.erase(0, static_cast<size_t>(p - first));
+		if (session.input.size() > SERVERMAXLINE)
+		{
+			session.input.clear();
+			session.output.append(errorText, sizeof(errorText) - 1);
+			session.output.push_back('\n');
+			session.closing = true;
+		}
+	}
+	//-------------------------------------------------------------------------
+	//		method:			evaluateLine(SSession& session, string_view line)
+	//		description:	evaluates one line in a session and adds its
+	//						result to the output as CRPNCalc::runBatch()
+	//						writes it: the top of the stack, the error text,
+	//						or nothing for an empty stack, then a line
+	//						break
+	//		calls:			CRPNEngine::evaluate()
+	//						formatNumber()
+	//		called by:		evaluateLines()
+	//		parameters:		SSession& session -- the session
+	//						string_view line -- the line
+	//		returns:		n/a
+	//		History Log:
+	//					10/17/2026 HJ completed version 1.0
+	// -------------------------------------------------------------------------
+	void CRPNServer::evaluateLine(SSession& session, string_view line)
+	{
+		double top = 0.0;
+		switch (session.engine.evaluate(line, top))
+		{
+		case EVAL_OK:
+		{
+			char number[NUMBERSIZE];
+			session.output.append(number,
+				formatNumber(top, number, sizeof(number)));
+			break;
+		}
+		case EVAL_ERROR:
+			session.output.append(errorText, sizeof(errorText) - 1);
+			break;
+		default:
+			break;
+		}
+		session.output.push_back('\n');
+	}
+	//-------------------------------------------------------------------------
+	//		method:			flush(SSession& session)
+	//		description:	sends as much of a session's output as the
+	//						socket takes, and drops what was sent
+	//		calls:			n/a
+	//		called by:		serve()
+	//		parameters:		SSession& session -- the session
+	//		returns:		bool -- false if the connection failed
+	//		History Log:
+	//					10/17/2026 HJ completed version 1.0
+	// -------------------------------------------------------------------------
+	bool CRPNServer::flush(SSession& session)
+	{
+#if defined(__linux__)
+		size_t sent = 0;
+		while (sent < session.output.size())
+		{
+			const ssize_t count = send(session.fd,
+				session.output.data() + sent, session.output.size() - sent,
+				MSG_NOSIGNAL);
+			if (count < 0)
+			{
+				if (errno == EINTR)
+					continue;
+				if (errno != EAGAIN && errno != EWOULDBLOCK)
+					return false;
+				break;
+			}
+			sent += static_cast<size_t>(count);
+		}
+		session.output.erase(0, sent);
+		return true;
+#else
+		(void)session;
+		return false;
+#endif
+	}
+	//-------------------------------------------------------------------------
+	//		method:			watch(SSession& session)
+	//		description:	tells epoll what the session waits for: room
+	//						for output while it has any, and input unless it
+	//						is closing or has SERVEROUTPUTLIMIT bytes of
+	//						results the client is not reading
+	//		calls:			n/a
+	//		called by:		serve()
+	//		parameters:		SSession& session -- the session
+	//		returns:		bool -- false if epoll failed
+	//		History Log:
+	//					10/17/2026 HJ completed version 1.0
+	// -------------------------------------------------------------------------
+	bool CRPNServer::watch(SSession& session)
+	{
+#if defined(__linux__)
+		const bool reading = !session.closing
+			&& session.output.size() < SERVEROUTPUTLIMIT;
+		const bool writing = !session.output.empty();
+		if (reading == session.reading && writing == session.writing)
+			return true;
+		epoll_event event;
+		memset(&event, 0, sizeof(event));
+		event.events = (reading ? EPOLLIN : 0u) | (writing ? EPOLLOUT : 0u);
+		event.data.fd = session.fd;
+		if (epoll_ctl(m_epoll, EPOLL_CTL_MOD, session.fd, &event) != 0)
+			return false;
+		session.reading = reading;
+		session.writing = writing;
+		return true;
+#else
+		(void)session;
+		return false;
+#endif
+	}
+	//-------------------------------------------------------------------------
+	//		method:			closeSession(int fd)
+	//		description:	closes a session's connection and keeps its
+	//						statistics
+	//		calls:			CRPNEngine::stats()
+	//						CRPNStats::merge()
+	//		called by:		serve()
+	//						closeAll()
+	//		parameters:		int fd -- the session's socket
+	//		returns:		n/a
+	//		History Log:
+	//					10/17/2026 HJ completed version 1.0
+	// -------------------------------------------------------------------------
+	void CRPNServer::closeSession(int fd)
+	{
+#if defined(__linux__)
+		const CRPNStats* stats = m_sessions[fd]->engine.stats();
+		if (stats != nullptr)
+			m_closedStats.merge(*stats);
+		close(fd);
+		m_sessions[fd].reset();
+		m_open--;
+#else
+		(void)fd;
+#endif
+	}
+	//-------------------------------------------------------------------------
+	//		method:			closeAll()
+	//		description:	closes every session, the sockets and epoll,
+	//						and removes the socket file
+	//		calls:			closeSession()
+	//		called by:		listen()
+	//						run()
+	//						~CRPNServer()
+	//		parameters:		n/a
+	//		returns:		n/a
+	//		History Log:
+	//					10/17/2026 HJ completed version 1.0
+	// -------------------------------------------------------------------------
+	void CRPNServer::closeAll()
+	{
+#if defined(__linux__)
+		for (size_t fd = 0; fd < m_sessions.size(); fd++)
+			if (m_sessions[fd])
+				closeSession(static_cast<int>(fd));
+		m_sessions.clear();
+		const int fds[] = { m_listen, m_epoll, m_wake, m_spare };
+		for (int fd : fds)
+			if (fd >= 0)
+				close(fd);
+		if (!m_path.empty())
+			unlink(m_path.c_str());
+#endif
+		m_listen = -1;
+		m_epoll = -1;
+		m_wake = -1;
+		m_spare = -1;
+		m_path.clear();
+	}
+}
@@ -0,0 +1,174 @@
+//----------------------------------------------------------------------------
+//    File:		rpnServer.h
+//
+//    Class:	CRPNServer
+//----------------------------------------------------------------------------
+#ifndef RPNSERVER_H
+#define RPNSERVER_H
+
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+#include "rpnEngine.h"
+//----------------------------------------------------------------------------
+//
+//    Title:		RPNServer Class
+//
+//    Description:	This file contains the class definition for CRPNServer,
+//					an evaluation server.  It listens on a Unix domain
+//					socket, or on a TCP port of the loopback interface,
+//					and serves every connection from one thread with an
+//					epoll event loop.  Each connection is a session with
+//					an engine of its own, so its stack, registers and
+//					program last from line to line as in
+//					CRPNCalc::runBatch(), and one result is written per
+//					line in the same format.  A client may send any
+//					number of lines without waiting for their results;
+//					they are evaluated in order as they arrive.
+//
+//					Sessions have no shell, so L, P and F are errors and
+//					a client cannot touch the server's files.  The runs
+//					of one request share a budget of jumps, so a loop
+//					that never ends gets its client an error instead of
+//					holding up every other session.  The
+//					server has no authentication: TCP is only offered on
+//					127.0.0.1, and a socket file is as private as its
+//					directory.
+//
+//					epoll is Linux only; elsewhere listen() fails.
+//
+//    Programmer:	Han Jung
+//
+//    Date:			10/17/2026
+//
+//    Version:		1.0
+//
+//    Environment:
+//       Hardware: Intel Xeon PC
+//       Software: Linux (epoll); builds elsewhere without a server
+//       Compiles under Microsoft Visual C++ 2017 (/std:c++17)
+//
+//	  class CRPNServer:
+//
+//	  Properties:
+//		int m_listen -- the listening socket, or -1
+//		int m_epoll -- the epoll instance, or -1
+//		int m_wake -- an eventfd that stop() writes to, or -1
+//		int m_spare -- a descriptor held back so that a connection can
+//			still be accepted, and closed, when no others are left
+//		string m_path -- the socket file, removed when the server closes
+//		CRPNEngine m_libraryEngine -- holds the library programs, compiled
+//			once, that each session's engine is given a copy of
+//		uint64_t m_jumpLimit -- jumps one request may take
+//		vector<unique_ptr<SSession>> m_sessions -- by socket descriptor
+//		size_t m_open -- sessions open
+//		string m_buffer -- scratch for reads
+//		CRPNStats m_closedStats -- statistics of closed sessions
+//		bool m_stopping -- stop() was called
+//
+//	  Methods:
+//
+//		inline:
+//			size_t sessions() const;
+//			void setJumpLimit(uint64_t limit);
+//			uint64_t jumpLimit() const;
+//
+//		non-inline:
+//		public:
+//			CRPNServer();
+//			~CRPNServer();
+//			bool listen(const string& address);
+//			bool run();
+//			void stop();
+//			bool loadLibrary(const string& filename);
+//			bool mergeStats(CRPNStats& total) const;
+//			static bool supported();
+//		private:
+//			void acceptSessions();
+//			void closeSession(int fd);
+//			void closeAll();
+//			void evaluateLine(SSession& session, string_view line);
+//			void evaluateLines(SSession& session, bool last);
+//			bool flush(SSession& session);
+//			void serve(int fd, unsigned events);
+//			bool watch(SSession& session);
+//
+//    History Log:
+//			10/17/2026	HJ  epoll evaluation server, version 1.0
+//			10/17/2026	HJ  library compiled once, not read per session,
+//								version 1.1
+//			10/17/2026	HJ  jump limit per request, version 1.2
+// ----------------------------------------------------------------------------
+
+using namespace std;
+
+namespace PB_CALC
+{
+	const size_t SERVERREADSIZE = 65536;		// bytes read at a time
+	const size_t SERVERMAXLINE = 1024 * 1024;	// longer lines end the session
+	const size_t SERVEROUTPUTLIMIT = 1024 * 1024;	// unsent results at which
+													// a session stops reading
+	const int SERVEREVENTS = 256;			// events taken per epoll_wait()
+	const uint64_t SERVERJUMPLIMIT = 1000000;	// default jumps a request
+												// may take
+
+	class CRPNServer
+	{
+	public:
+		CRPNServer();
+		~CRPNServer();
+		bool listen(const string& address);
+		bool run();
+		void stop();
+		bool loadLibrary(const string& filename);
+		bool mergeStats(CRPNStats& total) const;
+		size_t sessions() const { return m_open; }
+		// for sessions opened after the call
+		void setJumpLimit(uint64_t limit) { m_jumpLimit = limit; }
+		uint64_t jumpLimit() const { return m_jumpLimit; }
+		static bool supported();
+
+	private:
+		struct SSession
+		{
+			int fd;
+			CRPNEngine engine;
+			string input;		// received, from the first line not
+								// evaluated yet
+			string output;		// results not sent yet
+			bool reading;		// epoll reports input
+			bool writing;		// epoll reports room for output
+			bool closing;		// nothing more is read; close once the
+								// output is sent
+		};
+
+		CRPNServer(const CRPNServer&);
+		CRPNServer& operator=(const CRPNServer&);
+
+		void acceptSessions();
+		void closeSession(int fd);
+		void closeAll();
+		void evaluateLine(SSession& session, string_view line);
+		void evaluateLines(SSession& session, bool last);
+		bool flush(SSession& session);
+		void serve(int fd, unsigned events);
+		bool watch(SSession& session);
+
+		int m_listen;
+		int m_epoll;
+		int m_wake;
+		int m_spare;
+		string m_path;
+		CRPNEngine m_libraryEngine;
+		uint64_t m_jumpLimit;
+		vector<unique_ptr<SSession>> m_sessions;
+		size_t m_open;
+		string m_buffer;
+		CRPNStats m_closedStats;
+		bool m_stopping;
+	};
+}
+
+#endif
@@ -0,0 +1,215 @@
+//----------------------------------------------------------------------------
+//    File:		rpnStack.h
+//
+//    Class:	CRPNStack
+//----------------------------------------------------------------------------
+#ifndef RPNSTACK_H
+#define RPNSTACK_H
+
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include <vector>
+//----------------------------------------------------------------------------
+//
+//    Title:		RPNStack Class
+//
+//    Description:	This file contains the class definition for CRPNStack,
+//					the calculator's operand stack.  Values live in a ring
+//					buffer whose size is a power of two: the bottom is at
+//					m_head and the values run up from it, wrapping at the
+//					end.  Push and pop, at either end, are an index change
+//					and never allocate once the buffer has grown to the
+//					working depth.
+//
+//					A rotation moves the cut between the top and the
+//					bottom of the ring instead of shifting the values: U
+//					and D copy one value across the free part of the
+//					ring, whatever the depth, and rotating by k copies
+//					min(k, size - k) values in at most three block
+//					moves.  When the ring is full nothing is copied and
+//					only m_head moves.
+//
+//    Programmer:	Han Jung
+//
+//    Date:			10/17/2026
+//
+//    Version:		1.0
+//
+//    Environment:
+//       Hardware: Intel Xeon PC
+//       Software: Windows 10
+//       Compiles under Microsoft Visual C++ 2017 (/std:c++17)
+//
+//	  class CRPNStack:
+//
+//	  Properties:
+//		vector<double> m_values -- the ring; its size is a power of two
+//		size_t m_mask -- m_values.size() - 1
+//		size_t m_head -- index of the bottom value
+//		size_t m_size -- values on the stack
+//
+//	  Methods:
+//
+//		inline:
+//			CRPNStack();
+//			bool empty() const;
+//			size_t size() const;
+//			double top() const;
+//			double bottom() const;
+//			double at(size_t i) const -- i counts down from the top
+//			void push(double d);
+//			void pop();
+//			void pushBottom(double d);
+//			void popBottom();
+//			void rotateUp(size_t k) -- the top k values to the bottom
+//			void rotateDown(size_t k) -- the bottom k values to the top
+//			void clear();
+//			void copyTo(vector<double>& out) const -- appends the values,
+//				bottom first
+//			void assign(const double* first, const double* last);
+//
+//		private:
+//			void grow();
+//
+//		non-inline:	None
+//
+//    History Log:
+//			10/17/2026	HJ  contiguous operand stack, version 1.0
+//			10/17/2026	HJ  ring buffer, O(1) rotation, version 1.1
+// ----------------------------------------------------------------------------
+
+using namespace std;
+
+namespace PB_CALC
+{
+	const size_t STACKRESERVE = 64;		// a power of two
+
+	class CRPNStack
+	{
+	public:
+		CRPNStack() : m_values(STACKRESERVE), m_mask(STACKRESERVE - 1),
+			m_head(0), m_size(0) {}
+		bool empty() const { return m_size == 0; }
+		size_t size() const { return m_size; }
+		double top() const { return m_values[(m_head + m_size - 1) & m_mask]; }
+		double bottom() const { return m_values[m_head]; }
+		double at(size_t i) const
+		{
+			return m_values[(m_head + m_size - 1 - i) & m_mask];
+		}
+		void push(double d)
+		{
+			if (m_size == m_values.size())
+				grow();
+			m_values[(m_head + m_size) & m_mask] = d;
+			m_size++;
+		}
+		void pop() { m_size--; }
+		void pushBottom(double d)
+		{
+			if (m_size == m_values.size())
+				grow();
+			m_head = (m_head - 1) & m_mask;
+			m_values[m_head] = d;
+			m_size++;
+		}
+		void popBottom()
+		{
+			m_head = (m_head + 1) & m_mask;
+			m_size--;
+		}
+		// both take k < size(); the shorter way round is taken, and the
+		// values are copied across the free part of the ring in at most
+		// three runs
+		void rotateUp(size_t k)
+		{
+			if (k > m_size - k)
+			{
+				rotateDown(m_size - k);
+				return;
+			}
+			// the top k slots are copied to just below the bottom
+			const size_t capacity = m_values.size();
+			if (m_size < capacity)
+			{
+				size_t from = (m_head + m_size) & m_mask;
+				size_t to = m_head;
+				for (size_t left = k; left > 0; )
+				{
+					// runs end at from and to, and stop at the array start
+					if (from == 0)
+						from = capacity;
+					if (to == 0)
+						to = capacity;
+					const size_t n = min(left, min(from, to));
+					from -= n;
+					to -= n;
+					memmove(&m_values[to], &m_values[from], n * sizeof(double));
+					left -= n;
+				}
+			}
+			m_head = (m_head - k) & m_mask;
+		}
+		void rotateDown(size_t k)
+		{
+			if (k > m_size - k)
+			{
+				rotateUp(m_size - k);
+				return;
+			}
+			// the bottom k slots are copied to just above the top
+			const size_t capacity = m_values.size();
+			if (m_size < capacity)
+			{
+				size_t from = m_head;
+				size_t to = (m_head + m_size) & m_mask;
+				for (size_t left = k; left > 0; )
+				{
+					const size_t n = min(left,
+						min(capacity - from, capacity - to));
+					memmove(&m_values[to], &m_values[from], n * sizeof(double));
+					from = (from + n) & m_mask;
+					to = (to + n) & m_mask;
+					left -= n;
+				}
+			}
+			m_head = (m_head + k) & m_mask;
+		}
+		void clear()
+		{
+			m_head = 0;
+			m_size = 0;
+		}
+		void copyTo(vector<double>& out) const
+		{
+			for (size_t i = 0; i < m_size; i++)
+				out.push_back(m_values[(m_head + i) & m_mask]);
+		}
+		void assign(const double* first, const double* last)
+		{
+			clear();
+			for (; first != last; ++first)
+				push(*first);
+		}
+
+	private:
+		// doubles the ring, unwrapping it so the bottom is at 0
+		void grow()
+		{
+			vector<double> values(m_values.size() * 2);
+			for (size_t i = 0; i < m_size; i++)
+				values[i] = m_values[(m_head + i) & m_mask];
+			m_values.swap(values);
+			m_mask = m_values.size() - 1;
+			m_head = 0;
+		}
+
+		vector<double> m_values;
+		size_t m_mask;
+		size_t m_head;
+		size_t m_size;
+	};
+}
+
+#endif
@@ -0,0 +1,409 @@
+#include "rpnStats.h"
+#include <algorithm>
+#include <iomanip>
+//-------------------------------------------------------------------------------------------
+//    Class:		CRPNHistogram, CRPNStats
+//
+//    File:			rpnStats.cpp
+//
+//    Description:	This file contains the function definitions for
+//					CRPNHistogram and CRPNStats
+//
+//    Programmer:	Han Jung
+//
+//    Date:			10/17/2026
+//
+//    Version:		1.0
+//
+//    Environment:	Intel Xeon PC
+//                  Software:   MS Windows 10 for execution;
+//                  Compiles under Microsoft Visual C++ 2017 (/std:c++17)
+//
+//	  class:		CRPNHistogram
+//
+//	  Properties:
+//				uint64_t m_buckets[HISTOGRAMBUCKETS];
+//				uint64_t m_count;
+//				uint64_t m_total;
+//				uint64_t m_max;
+//
+//	  Non-inline Methods:
+//				CRPNHistogram();
+//				void clear();
+//				void add(uint64_t nanoseconds);
+//				void merge(const CRPNHistogram& other);
+//				uint64_t percentile(double p) const;
+//
+//	  class:		CRPNStats
+//
+//	  Properties:
+//				uint64_t m_ops[NUMSTATOPS];
+//				uint64_t m_errors[NUMSTATERRORS];
+//				CRPNHistogram m_parse;
+//				CRPNHistogram m_run;
+//				CRPNHistogram m_file;
+//
+//	  Non-inline Methods:
+//				CRPNStats();
+//				void clear();
+//				void countInstruction(OpCode op);
+//				void merge(const CRPNStats& other);
+//				void writeText(ostream& ostr) const;
+//				void writeJson(ostream& ostr) const;
+//				static const char* opName(StatOp op);
+//				static const char* errorName(StatError cause);
+//
+//    History Log:
+//				10/17/2026	HJ engine statistics, version 1.0
+//				10/17/2026	HJ custom operator counts, version 1.1
+//				10/17/2026	HJ branch counts and errors, version 1.2
+//				10/17/2026	HJ noProgram error, version 1.3
+// ----------------------------------------------------------------------------
+namespace PB_CALC
+{
+	namespace
+	{
+		const char* const histogramNames[] = { "parse", "run", "file" };
+		const double percentiles[] = { 0.5, 0.9, 0.99 };
+		const char* const percentileNames[] = { "p50", "p90", "p99" };
+	}
+
+	//-------------------------------------------------------------------------
+	//		method:			CRPNHistogram()
+	//		description:	constructor; an empty histogram
+	//		calls:			clear()
+	//		called by:		CRPNStats()
+	//		parameters:		n/a
+	//		returns:		n/a
+	//		History Log:
+	//					10/17/2026 HJ completed version 1.0
+	// -------------------------------------------------------------------------
+	CRPNHistogram::CRPNHistogram()
+	{
+		clear();
+	}
+	//-------------------------------------------------------------------------
+	//		method:			clear()
+	//		description:	removes every sample
+	//		calls:			n/a
+	//		called by:		CRPNHistogram()
+	//						CRPNStats::clear()
+	//		parameters:		n/a
+	//		returns:		n/a
+	//		History Log:
+	//					10/17/2026 HJ completed version 1.0
+	// -------------------------------------------------------------------------
+	void CRPNHistogram::clear()
+	{
+		for (size_t i = 0; i < HISTOGRAMBUCKETS; i++)
+			m_buckets[i] = 0;
+		m_count = 0;
+		m_total = 0;
+		m_max = 0;
+	}
+	//-------------------------------------------------------------------------
+	//		method:			add(uint64_t nanoseconds)
+	//		description:	adds one sample
+	//		calls:			n/a
+	//		called by:		CRPNStatTimer::~CRPNStatTimer()
+	//		parameters:		uint64_t nanoseconds -- the sample
+	//		returns:		n/a
+	//		History Log:
+	//					10/17/2026 HJ completed version 1.0
+	// -------------------------------------------------------------------------
+	void CRPNHistogram::add(uint64_t nanoseconds)
+	{
+		size_t i = 0;
+		for (uint64_t n = nanoseconds >> 1; n != 0 && i + 1 < HISTOGRAMBUCKETS;
+			n >>= 1)
+			i++;
+		m_buckets[i]++;
+		m_count++;
+		m_total += nanoseconds;
+		m_max = std::max(m_max, nanoseconds);
+	}
+	//-------------------------------------------------------------------------
+	//		method:			merge(const CRPNHistogram& other)
+	//		description:	adds the samples of other
+	//		calls:			n/a
+	//		called by:		CRPNStats::merge()
+	//		parameters:		const CRPNHistogram& other -- samples to add
+	//		returns:		n/a
+	//		History Log:
+	//					10/17/2026 HJ completed version 1.0
+	// -------------------------------------------------------------------------
+	void CRPNHistogram::merge(const CRPNHistogram& other)
+	{
+		for (size_t i = 0; i < HISTOGRAMBUCKETS; i++)
+			m_buckets[i] += other.m_buckets[i];
+		m_count += other.m_count;
+		m_total += other.m_total;
+		m_max = std::max(m_max, other.m_max);
+	}
+	//-------------------------------------------------------------------------
+	//		method:			percentile(double p) const
+	//		description:	an upper bound on the p quantile: the top of
+	//						the bucket it falls in, but no more than the
+	//						largest sample
+	//		calls:			n/a
+	//		called by:		CRPNStats::writeText()
+	//						CRPNStats::writeJson()
+	//		parameters:		double p -- between 0 and 1
+	//		returns:		uint64_t -- nanoseconds; 0 if there are no
+	//						samples
+	//		History Log:
+	//					10/17/2026 HJ completed version 1.0
+	// -------------------------------------------------------------------------
+	uint64_t CRPNHistogram::percentile(double p) const
+	{
+		if (m_count == 0)
+			return 0;
+		uint64_t rank = static_cast<uint64_t>(p * m_count);
+		if (rank >= m_count)
+			rank = m_count - 1;
+		uint64_t seen = 0;
+		for (size_t i = 0; i < HISTOGRAMBUCKETS; i++)
+		{
+			seen += m_buckets[i];
+			if (seen > rank)
+				return std::min(m_max, (uint64_t(2) << i) - 1);
+		}
+		return m_max;
+	}
+
+	//-------------------------------------------------------------------------
+	//		method:			CRPNStats()
+	//		description:	constructor; every count is zero
+	//		calls:			clear()
+	//		called by:		CRPNEngine()
+	//		parameters:		n/a
+	//		returns:		n/a
+	//		History Log:
+	//					10/17/2026 HJ completed version 1.0
+	// -------------------------------------------------------------------------
+	CRPNStats::CRPNStats()
+	{
+		clear();
+	}
+	//-------------------------------------------------------------------------
+	//		method:			clear()
+	//		description:	sets every count to zero
+	//		calls:			CRPNHistogram::clear()
+	//		called by:		CRPNStats()
+	//						CRPNEngine::clearStats()
+	//		parameters:		n/a
+	//		returns:		n/a
+	//		History Log:
+	//					10/17/2026 HJ completed version 1.0
+	// -------------------------------------------------------------------------
+	void CRPNStats::clear()
+	{
+		for (int i = 0; i < NUMSTATOPS; i++)
+			m_ops[i] = 0;
+		for (int i = 0; i < NUMSTATERRORS; i++)
+			m_errors[i] = 0;
+		m_parse.clear();
+		m_run.clear();
+		m_file.clear();
+	}
+	//-------------------------------------------------------------------------
+	//		method:			countInstruction(OpCode op)
+	//		description:	counts the operators one compiled instruction
+	//						runs, as the interpreter would count them; used
+	//						for code that does not go through the operator
+	//						methods, such as native code
+	//		calls:			count()
+	//		called by:		CRPNEngine::runJit()
+	//		parameters:		OpCode op -- the instruction
+	//		returns:		n/a
+	//		History Log:
+	//					10/17/2026 HJ completed version 1.0
+	// -------------------------------------------------------------------------
+	void CRPNStats::countInstruction(OpCode op)
+	{
+		switch (op)
+		{
+		case OP_PUSH: count(STAT_PUSH); break;
+		case OP_NEGZERO: count(STAT_PUSH); count(STAT_NEG); break;
+		case OP_ADD: count(STAT_ADD); break;
+		case OP_SUBTRACT: count(STAT_SUBTRACT); break;
+		case OP_MULTIPLY: count(STAT_MULTIPLY); break;
+		case OP_DIVIDE: count(STAT_DIVIDE); break;
+		case OP_EXP: count(STAT_EXP); break;
+		case OP_MOD: count(STAT_MOD); break;
+		case OP_NEG: count(STAT_NEG); break;
+		case OP_CLEARENTRY:
+		case OP_CLEARALL: count(STAT_CLEAR); break;
+		case OP_ROTATEUP: count(STAT_ROTATEUP); break;
+		case OP_ROTATEDOWN: count(STAT_ROTATEDOWN); break;
+		case OP_GETREG: count(STAT_GETREG); break;
+		case OP_SETREG: count(STAT_SETREG); break;
+		case OP_ADDCONST:
+		case OP_SUBTRACTCONST:
+		case OP_MULTIPLYCONST:
+		case OP_DIVIDECONST:
+		case OP_EXPCONST:
+		case OP_MODCONST:
+			count(STAT_PUSH);
+			count(static_cast<StatOp>(STAT_ADD + (op - OP_ADDCONST)));
+			break;
+		default:
+			break;
+		}
+	}
+	//-------------------------------------------------------------------------
+	//		method:			merge(const CRPNStats& other)
+	//		description:	adds the counts of other, e.g. to total the
+	//						engines of several threads
+	//		calls:			CRPNHistogram::merge()
+	//		called by:		CRPNBatch::mergeStats()
+	//		parameters:		const CRPNStats& other -- counts to add
+	//		returns:		n/a
+	//		History Log:
+	//					10/17/2026 HJ completed version 1.0
+	// -------------------------------------------------------------------------
+	void CRPNStats::merge(const CRPNStats& other)
+	{
+		for (int i = 0; i < NUMSTATOPS; i++)
+			m_ops[i] += other.m_ops[i];
+		for (int i = 0; i < NUMSTATERRORS; i++)
+			m_errors[i] += other.m_errors[i];
+		m_parse.merge(other.m_parse);
+		m_run.merge(other.m_run);
+		m_file.merge(other.m_file);
+	}
+	//-------------------------------------------------------------------------
+	//		method:			writeText(ostream& ostr) const
+	//		description:	writes the counts as three tables: operators,
+	//						errors, and latencies with percentiles
+	//		calls:			opName()
+	//						errorName()
+	//						CRPNHistogram::percentile()
+	//		called by:		main()
+	//		parameters:		ostream& ostr -- where to write
+	//		returns:		n/a
+	//		History Log:
+	//					10/17/2026 HJ completed version 1.0
+	// -------------------------------------------------------------------------
+	void CRPNStats::writeText(ostream& ostr) const
+	{
+		ostr << left << setw(14) << "operator" << right << setw(14)
+			<< "count" << '\n';
+		for (int i = 0; i < NUMSTATOPS; i++)
+			ostr << left << setw(14) << opName(static_cast<StatOp>(i))
+				<< right << setw(14) << m_ops[i] << '\n';
+		ostr << '\n' << left << setw(14) << "error" << right << setw(14)
+			<< "count" << '\n';
+		for (int i = 0; i < NUMSTATERRORS; i++)
+			ostr << left << setw(14) << errorName(static_cast<StatError>(i))
+				<< right << setw(14) << m_errors[i] << '\n';
+		ostr << '\n' << left << setw(14) << "latency (ns)" << right
+			<< setw(14) << "count" << setw(12) << "mean";
+		for (const char* name : percentileNames)
+			ostr << setw(12) << name;
+		ostr << setw(12) << "max" << '\n';
+		const CRPNHistogram* histograms[] = { &m_parse, &m_run, &m_file };
+		for (int h = 0; h < 3; h++)
+		{
+			const CRPNHistogram& histogram = *histograms[h];
+			ostr << left << setw(14) << histogramNames[h] << right
+				<< setw(14) << histogram.count() << setw(12)
+				<< (histogram.count() ? histogram.total() / histogram.count()
+					: 0);
+			for (double p : percentiles)
+				ostr << setw(12) << histogram.percentile(p);
+			ostr << setw(12) << histogram.max() << '\n';
+		}
+		ostr.flush();
+	}
+	//-------------------------------------------------------------------------
+	//		method:			writeJson(ostream& ostr) const
+	//		description:	writes the counts as one JSON object; the
+	//						histograms include their buckets, up to the
+	//						last one in use
+	//		calls:			opName()
+	//						errorName()
+	//						CRPNHistogram::percentile()
+	//		called by:		main()
+	//		parameters:		ostream& ostr -- where to write
+	//		returns:		n/a
+	//		History Log:
+	//					10/17/2026 HJ completed version 1.0
+	// -------------------------------------------------------------------------
+	void CRPNStats::writeJson(ostream& ostr) const
+	{
+		ostr << "{\n  \"ops\": {";
+		for (int i = 0; i < NUMSTATOPS; i++)
+			ostr << (i ? ", " : "") << '"' << opName(static_cast<StatOp>(i))
+				<< "\": " << m_ops[i];
+		ostr << "},\n  \"errors\": {";
+		for (int i = 0; i < NUMSTATERRORS; i++)
+			ostr << (i ? ", " : "") << '"'
+				<< errorName(static_cast<StatError>(i)) << "\": "
+				<< m_errors[i];
+		ostr << "},\n  \"latency_ns\": {";
+		const CRPNHistogram* histograms[] = { &m_parse, &m_run, &m_file };
+		for (int h = 0; h < 3; h++)
+		{
+			const CRPNHistogram& histogram = *histograms[h];
+			ostr << (h ? "," : "") << "\n    \"" << histogramNames[h]
+				<< "\": {\"count\": " << histogram.count()
+				<< ", \"total\": " << histogram.total()
+				<< ", \"max\": " << histogram.max();
+			for (size_t p = 0; p < 3; p++)
+				ostr << ", \"" << percentileNames[p] << "\": "
+					<< histogram.percentile(percentiles[p]);
+			size_t used = HISTOGRAMBUCKETS;
+			while (used > 0 && histogram.bucket(used - 1) == 0)
+				used--;
+			ostr << ", \"buckets\": [";
+			for (size_t i = 0; i < used; i++)
+				ostr << (i ? ", " : "") << histogram.bucket(i);
+			ostr << "]}";
+		}
+		ostr << "\n  }\n}\n";
+		ostr.flush();
+	}
+	//-------------------------------------------------------------------------
+	//		method:			opName(StatOp op)
+	//		description:	the name of an operator counter
+	//		calls:			n/a
+	//		called by:		writeText()
+	//						writeJson()
+	//		parameters:		StatOp op -- the counter
+	//		returns:		const char* -- its name
+	//		History Log:
+	//					10/17/2026 HJ completed version 1.0
+	// -------------------------------------------------------------------------
+	const char* CRPNStats::opName(StatOp op)
+	{
+		static const char* const names[NUMSTATOPS] =
+		{
+			"push", "add", "subtract", "multiply", "divide", "exp", "mod",
+			"neg", "clear", "rotateUp", "rotateDown", "getReg", "setReg",
+			"custom", "branch"
+		};
+		return names[op];
+	}
+	//-------------------------------------------------------------------------
+	//		method:			errorName(StatError cause)
+	//		description:	the name of an error cause
+	//		calls:			n/a
+	//		called by:		writeText()
+	//						writeJson()
+	//		parameters:		StatError cause -- the cause
+	//		returns:		const char* -- its name
+	//		History Log:
+	//					10/17/2026 HJ completed version 1.0
+	// -------------------------------------------------------------------------
+	const char* CRPNStats::errorName(StatError cause)
+	{
+		static const char* const names[NUMSTATERRORS] =
+		{
+			"underflow", "divideByZero", "zeroPower", "badToken",
+			"runDepth", "noShell", "file", "operator",
+			"callDepth", "jumpLimit", "noProgram"
+		};
+		return names[cause];
+	}
+}
@@ -0,0 +1,248 @@
+//----------------------------------------------------------------------------
+//    File:		rpnStats.h
+//
+//    Class:	CRPNHistogram, CRPNStats, CRPNStatTimer
+//----------------------------------------------------------------------------
+#ifndef RPNSTATS_H
+#define RPNSTATS_H
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <ostream>
+#include "rpnProgram.h"
+//----------------------------------------------------------------------------
+//
+//    Title:		RPNStats Classes
+//
+//    Description:	This file contains the class definitions for the
+//					engine's instrumentation.  CRPNStats holds how many
+//					times each operator ran, errors by cause, and latency
+//					histograms for parsed lines, program runs and program
+//					file loads and saves.  It can be written as text or
+//					JSON at any time.
+//
+//					The engine only collects statistics when it is built
+//					with RPNCALC_STATS defined.  Otherwise RPN_STAT()
+//					drops every statement that updates them, the engine
+//					has no CRPNStats member, and CRPNEngine::stats()
+//					returns nullptr, so the hot paths are unchanged.
+//
+//					A histogram has one bucket per power of two
+//					nanoseconds; bucket i counts times in [2^i, 2^(i+1))
+//					and bucket 0 also counts times under a nanosecond.
+//
+//    Programmer:	Han Jung
+//
+//    Date:			10/17/2026
+//
+//    Version:		1.0
+//
+//    Environment:
+//       Hardware: Intel Xeon PC
+//       Software: Windows 10
+//       Compiles under Microsoft Visual C++ 2017 (/std:c++17)
+//       RPNCALC_STATS turns collection on
+//
+//	  class CRPNHistogram:
+//
+//	  Properties:
+//		uint64_t m_buckets[HISTOGRAMBUCKETS] -- counts per power of two
+//		uint64_t m_count -- samples
+//		uint64_t m_total -- sum of the samples, nanoseconds
+//		uint64_t m_max -- largest sample, nanoseconds
+//
+//	  Methods:
+//
+//		inline:
+//			uint64_t count() const;
+//			uint64_t total() const;
+//			uint64_t max() const;
+//			uint64_t bucket(size_t i) const;
+//
+//		non-inline:
+//		public:
+//			CRPNHistogram();
+//			void clear();
+//			void add(uint64_t nanoseconds);
+//			void merge(const CRPNHistogram& other);
+//			uint64_t percentile(double p) const;
+//
+//	  class CRPNStats:
+//
+//	  Properties:
+//		uint64_t m_ops[NUMSTATOPS] -- executions of each operator
+//		uint64_t m_errors[NUMSTATERRORS] -- errors by cause
+//		CRPNHistogram m_parse -- time per parse() of a line
+//		CRPNHistogram m_run -- time per program run
+//		CRPNHistogram m_file -- time per program file load or save
+//
+//	  Methods:
+//
+//		inline:
+//			void count(StatOp op);
+//			void error(StatError cause);
+//			uint64_t ops(StatOp op) const;
+//			uint64_t errors(StatError cause) const;
+//			CRPNHistogram& parseLatency();
+//			CRPNHistogram& runLatency();
+//			CRPNHistogram& fileLatency();
+//			const CRPNHistogram& parseLatency() const;
+//			const CRPNHistogram& runLatency() const;
+//			const CRPNHistogram& fileLatency() const;
+//
+//		non-inline:
+//		public:
+//			CRPNStats();
+//			void clear();
+//			void countInstruction(OpCode op);
+//			void merge(const CRPNStats& other);
+//			void writeText(ostream& ostr) const;
+//			void writeJson(ostream& ostr) const;
+//			static const char* opName(StatOp op);
+//			static const char* errorName(StatError cause);
+//
+//	  class CRPNStatTimer:
+//
+//	  Properties:
+//		CRPNHistogram& m_histogram -- receives the time
+//		steady_clock::time_point m_start -- when the timer was made
+//
+//	  Methods:
+//
+//		inline:
+//			CRPNStatTimer(CRPNHistogram& histogram);
+//			~CRPNStatTimer();
+//
+//    History Log:
+//			10/17/2026	HJ  engine statistics, version 1.0
+//			10/17/2026	HJ  custom operator counts, version 1.1
+//			10/17/2026	HJ  branch counts and errors, version 1.2
+//			10/17/2026	HJ  noProgram error, version 1.3
+// ----------------------------------------------------------------------------
+
+#if defined(RPNCALC_STATS)
+#define RPN_STAT(statement) statement
+#else
+#define RPN_STAT(statement)
+#endif
+
+using namespace std;
+
+namespace PB_CALC
+{
+	const size_t HISTOGRAMBUCKETS = 48;
+
+	enum StatOp
+	{
+		STAT_PUSH,
+		STAT_ADD,
+		STAT_SUBTRACT,
+		STAT_MULTIPLY,
+		STAT_DIVIDE,
+		STAT_EXP,
+		STAT_MOD,
+		STAT_NEG,
+		STAT_CLEAR,			// C and CE
+		STAT_ROTATEUP,
+		STAT_ROTATEDOWN,
+		STAT_GETREG,
+		STAT_SETREG,
+		STAT_CUSTOM,		// operators added with CRPNOperators::add()
+		STAT_BRANCH,		// jumps, branches, loops, calls and returns
+		NUMSTATOPS
+	};
+
+	enum StatError
+	{
+		STATERR_UNDERFLOW,		// too few values on the stack
+		STATERR_DIVIDEBYZERO,	// divide or mod by zero
+		STATERR_ZEROPOWER,		// 0^0
+		STATERR_BADTOKEN,		// a token parse() rejects
+		STATERR_RUNDEPTH,		// R nested past MAXRUNDEPTH
+		STATERR_NOSHELL,		// L, P or F without a shell
+		STATERR_FILE,			// a program file could not be read or written
+		STATERR_OPERATOR,		// a custom operator's kernel failed
+		STATERR_CALLDEPTH,		// calls nested past MAXCALLDEPTH
+		STATERR_JUMPLIMIT,		// a run took more jumps than its limit
+		STATERR_NOPROGRAM,		// R:name of a program with no code
+		NUMSTATERRORS
+	};
+
+	class CRPNHistogram
+	{
+	public:
+		CRPNHistogram();
+		void clear();
+		void add(uint64_t nanoseconds);
+		void merge(const CRPNHistogram& other);
+		uint64_t percentile(double p) const;
+
+		uint64_t count() const { return m_count; }
+		uint64_t total() const { return m_total; }
+		uint64_t max() const { return m_max; }
+		uint64_t bucket(size_t i) const { return m_buckets[i]; }
+
+	private:
+		uint64_t m_buckets[HISTOGRAMBUCKETS];
+		uint64_t m_count;
+		uint64_t m_total;
+		uint64_t m_max;
+	};
+
+	class CRPNStats
+	{
+	public:
+		CRPNStats();
+		void clear();
+		void countInstruction(OpCode op);
+		void merge(const CRPNStats& other);
+		void writeText(ostream& ostr) const;
+		void writeJson(ostream& ostr) const;
+		static const char* opName(StatOp op);
+		static const char* errorName(StatError cause);
+
+		void count(StatOp op) { m_ops[op]++; }
+		void error(StatError cause) { m_errors[cause]++; }
+		uint64_t ops(StatOp op) const { return m_ops[op]; }
+		uint64_t errors(StatError cause) const { return m_errors[cause]; }
+		CRPNHistogram& parseLatency() { return m_parse; }
+		CRPNHistogram& runLatency() { return m_run; }
+		CRPNHistogram& fileLatency() { return m_file; }
+		const CRPNHistogram& parseLatency() const { return m_parse; }
+		const CRPNHistogram& runLatency() const { return m_run; }
+		const CRPNHistogram& fileLatency() const { return m_file; }
+
+	private:
+		uint64_t m_ops[NUMSTATOPS];
+		uint64_t m_errors[NUMSTATERRORS];
+		CRPNHistogram m_parse;
+		CRPNHistogram m_run;
+		CRPNHistogram m_file;
+	};
+
+	// adds the time from its construction to its destruction to a histogram
+	class CRPNStatTimer
+	{
+	public:
+		explicit CRPNStatTimer(CRPNHistogram& histogram)
+			: m_histogram(histogram), m_start(chrono::steady_clock::now())
+		{
+		}
+		~CRPNStatTimer()
+		{
+			m_histogram.add(static_cast<uint64_t>(
+				chrono::duration_cast<chrono::nanoseconds>(
+					chrono::steady_clock::now() - m_start).count()));
+		}
+
+	private:
+		CRPNStatTimer(const CRPNStatTimer&);
+		CRPNStatTimer& operator=(const CRPNStatTimer&);
+
+		CRPNHistogram& m_histogram;
+		chrono::steady_clock::time_point m_start;
+	};
+}
+
+#endif
@@ -0,0 +1,382 @@
+#include "rpnTokenizer.h"
+#include <cctype>
+#include <charconv>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+//-------------------------------------------------------------------------------------------
+//    Class:		CRPNTokenizer
+//
+//    File:			rpnTokenizer.cpp
+//
+//    Description:	This file contains the function definitions for
+//					CRPNTokenizer.  The tokenizer walks a string_view with a
+//					cursor and never copies or erases the line, so a line of
+//					n characters is tokenized in O(n).  Numbers are
+//					converted with from_chars(), which is exact and does not
+//					depend on the locale, where the library provides it for
+//					double (__cpp_lib_to_chars); otherwise with strtod().
+//
+//    Programmer:	Han Jung
+//
+//    Date:			10/17/2026
+//
+//    Version:		1.0
+//
+//    Environment:	Intel Xeon PC
+//                  Software:   MS Windows 10 for execution;
+//                  Compiles under Microsoft Visual C++ 2017 (/std:c++17)
+//
+//	  class:		CRPNTokenizer
+//
+//	  Properties:
+//				string_view m_line;
+//				size_t m_pos;
+//
+//	  Non-inline Methods:
+//				CRPNTokenizer(string_view line);
+//				bool next(SToken& token);
+//
+//				private:
+//					double scanValue(size_t& last) const;
+//
+//    History Log:
+//				10/17/2026	HJ linear-time cursor tokenizer, version 1.0
+//				10/17/2026	HJ from_chars() and exponents, version 1.1
+//				10/17/2026	HJ named registers, version 1.2
+//				10/17/2026	HJ rotate by k, version 1.3
+//				10/17/2026	HJ labels and branches, version 1.4
+//				10/17/2026	HJ R:name, version 1.5
+// ----------------------------------------------------------------------------
+namespace PB_CALC
+{
+	namespace
+	{
+		inline bool isDigit(char c)
+		{
+			return c >= '0' && c <= '9';
+		}
+
+		inline char upper(char c)
+		{
+			return static_cast<char>(toupper(static_cast<unsigned char>(c)));
+		}
+
+		inline bool isNameChar(char c)
+		{
+			return isDigit(c) || c == '_' || (c >= 'A' && c <= 'Z')
+				|| (c >= 'a' && c <= 'z');
+		}
+
+#if defined(__cpp_lib_to_chars)
+		//--------------------------------------------------------------------
+		//	Function:		outOfRange(const char* first, const char* last)
+		//	Description:	the value of a literal from_chars() reports as
+		//					out of range: +-HUGE_VAL if it overflows and +-0
+		//					if it underflows, as strtod() returns.  Which one
+		//					follows from the power of ten of its first
+		//					non-zero digit plus its exponent.
+		//	Returns:		the value
+		//--------------------------------------------------------------------
+		double outOfRange(const char* first, const char* last)
+		{
+			const bool negative = *first == '-';
+			long position = 0;		// power of ten of the first digit, + 1
+			bool point = false;
+			bool seen = false;
+			const char* p = negative ? first + 1 : first;
+			for (; p < last && *p != 'e' && *p != 'E'; p++)
+			{
+				if (*p == '.')
+					point = true;
+				else if (!point && (seen || *p != '0'))
+				{
+					seen = true;
+					position++;
+				}
+				else if (point && !seen)
+				{
+					if (*p == '0')
+						position--;
+					else
+						seen = true;
+				}
+			}
+			long exponent = 0;
+			if (p < last)
+			{
+				p++;
+				const bool negativeExponent = *p == '-';
+				if (*p == '-' || *p == '+')
+					p++;
+				for (; p < last; p++)
+					if (exponent < 1000000)
+						exponent = exponent * 10 + (*p - '0');
+				if (negativeExponent)
+					exponent = -exponent;
+			}
+			const double magnitude = (position + exponent > 0) ? HUGE_VAL : 0.0;
+			return negative ? -magnitude : magnitude;
+		}
+#endif
+	}
+	//-------------------------------------------------------------------------
+	//		method:			CRPNTokenizer(string_view line)
+	//		description:	constructor; the line must outlive the tokenizer
+	//		calls:			n/a
+	//		called by:		CRPNCalc::parse()
+	//
+	//		parameters:		string_view line -- the line to tokenize
+	//
+	//		returns:		n/a
+	//		History Log:
+	//					10/17/2026 HJ completed version 1.0
+	// -------------------------------------------------------------------------
+	CRPNTokenizer::CRPNTokenizer(string_view line) : m_line(line), m_pos(0)
+	{
+	}
+	//-------------------------------------------------------------------------
+	//		method:			next(SToken& token)
+	//		description:	skips blanks and reads the next token.  The rules
+	//						are the ones parse() has always used:
+	//						- a number is an optional '-' followed by digits
+	//						  and at most one '.', then an optional exponent
+	//						  (e or E, an optional sign and digits), as long
+	//						  as its value is non-zero or it starts with '0';
+	//						  '+' never starts a number
+	//						- "-0" (a zero valued '-' number) consumes the
+	//						  '-' and the run of zeros only
+	//						- "CE", "Sn" and "Gn" are two character tokens
+	//						- "S:name" and "G:name" take the run of
+	//						  letters, digits and '_' after the ':'; reg is
+	//						  -1 and the name is left in token.text, for the
+	//						  engine to give it a slot
+	//						- "U:k" and "D:k" take the digits after the ':'
+	//						  as the rotation count
+	//						- ":name" is a label, and "J:name", "<:name",
+	//						  ">:name", "=:name", "!:name", "@:name" and
+	//						  "K0:name" - "K9:name" branch to one; names
+	//						  are read as register names are
+	//						- "R:name" runs a library program
+	//						- anything else is a single character operator
+	//						A number's text is left in token.text, for
+	//						engines that convert it to another type.
+	//		calls:			scanValue()
+	//		called by:		CRPNCalc::parse()
+	//
+	//		parameters:		SToken& token -- receives the token
+	//
+	//		returns:		false at the end of the line
+	//		History Log:
+	//					10/17/2026 HJ completed version 1.0
+	//					10/17/2026 HJ numbers take their exponent, version 1.1
+	//					10/17/2026 HJ numbers keep their text, version 1.2
+	//					10/17/2026 HJ named registers, version 1.3
+	//					10/17/2026 HJ rotate by k, version 1.4
+	//					10/17/2026 HJ labels and branches, version 1.5
+	//					10/17/2026 HJ R:name, version 1.6
+	// -------------------------------------------------------------------------
+	bool CRPNTokenizer::next(SToken& token)
+	{
+		const size_t end = m_line.size();
+		while (m_pos < end && m_line[m_pos] == ' ')
+			m_pos++;
+		if (m_pos >= end)
+			return false;
+
+		const char c = m_line[m_pos];
+		if (isDigit(c) || c == '.' || c == '-')
+		{
+			size_t last = m_pos;
+			double value = scanValue(last);
+			//if it is a number
+			if (value != 0 || c == '0')
+			{
+				token.type = TOK_NUMBER;
+				token.value = value;
+				token.text = m_line.substr(m_pos, last - m_pos);
+				m_pos = last;
+				return true;
+			}
+			//special situation with -0
+			if (c == '-' && m_pos + 1 < end && m_line[m_pos + 1] == '0')
+			{
+				const size_t start = m_pos++;
+				while (m_pos < end && m_line[m_pos] == '0')
+					m_pos++;
+				token.type = TOK_NEGZERO;
+				token.value = value;
+				token.text = m_line.substr(start, m_pos - start);
+				return true;
+			}
+		}
+
+		if (m_pos + 1 < end)
+		{
+			const char c0 = upper(c);
+			const char c1 = m_line[m_pos + 1];
+			//special situation with CE
+			if (c0 == 'C' && upper(c1) == 'E')
+			{
+				m_pos += 2;
+				token.type = TOK_CLEARALL;
+				return true;
+			}
+			//special situation with S0-9 and G0-9
+			if ((c0 == 'S' || c0 == 'G') && isDigit(c1))
+			{
+				m_pos += 2;
+				token.type = (c0 == 'S') ? TOK_SETREG : TOK_GETREG;
+				token.reg = c1 - '0';
+				return true;
+			}
+			//named registers, S:name and G:name, and programs, R:name
+			if ((c0 == 'S' || c0 == 'G' || c0 == 'R') && c1 == ':'
+				&& m_pos + 2 < end && isNameChar(m_line[m_pos + 2]))
+			{
+				const size_t start = m_pos + 2;
+				m_pos = start;
+				while (m_pos < end && isNameChar(m_line[m_pos]))
+					m_pos++;
+				token.type = (c0 == 'S') ? TOK_SETREG
+					: (c0 == 'G') ? TOK_GETREG : TOK_RUNPROGRAM;
+				token.reg = -1;
+				token.text = m_line.substr(start, m_pos - start);
+				return true;
+			}
+			//rotate by k, U:k and D:k
+			if ((c0 == 'U' || c0 == 'D') && c1 == ':' && m_pos + 2 < end
+				&& isDigit(m_line[m_pos + 2]))
+			{
+				int count = 0;
+				m_pos += 2;
+				while (m_pos < end && isDigit(m_line[m_pos]))
+				{
+					//more than MAXROTATE sticks at -1
+					if (count >= 0)
+						count = (count > MAXROTATE / 10) ? -1
+							: count * 10 + (m_line[m_pos] - '0');
+					m_pos++;
+				}
+				token.type = TOK_ROTATE;
+				token.op = c0;
+				token.reg = count;
+				return true;
+			}
+			//a label, :name
+			if (c == ':' && isNameChar(c1))
+			{
+				const size_t start = m_pos + 1;
+				m_pos = start;
+				while (m_pos < end && isNameChar(m_line[m_pos]))
+					m_pos++;
+				token.type = TOK_LABEL;
+				token.text = m_line.substr(start, m_pos - start);
+				return true;
+			}
+			//branches, J:name, <:name, >:name, =:name, !:name, @:name and
+			//K0:name - K9:name
+			const bool loop = (c0 == 'K' && isDigit(c1));
+			const size_t colon = m_pos + (loop ? 2 : 1);
+			if ((loop || c0 == 'J' || c == '<' || c == '>' || c == '='
+				|| c == '!' || c == '@') && colon + 1 < end
+				&& m_line[colon] == ':' && isNameChar(m_line[colon + 1]))
+			{
+				const size_t start = colon + 1;
+				m_pos = start;
+				while (m_pos < end && isNameChar(m_line[m_pos]))
+					m_pos++;
+				token.type = TOK_BRANCH;
+				token.op = c0;
+				token.reg = loop ? c1 - '0' : -1;
+				token.text = m_line.substr(start, m_pos - start);
+				return true;
+			}
+		}
+
+		m_pos++;
+		token.type = TOK_OPERATOR;
+		token.op = c;
+		return true;
+	}
+	//-------------------------------------------------------------------------
+	//		method:			scanValue(size_t& last)
+	//		description:	converts the longest decimal literal at the cursor
+	//						([-]digits[.digits][e[+-]digits]) without moving
+	//						the cursor.  This is the value atof() used to
+	//						produce on the remaining buffer, rounded
+	//						correctly; the literal is bounded here because
+	//						the line need not be NUL terminated.
+	//		calls:			from_chars() or strtod()
+	//						outOfRange()
+	//		called by:		next()
+	//		parameters:		size_t& last -- receives the position just past
+	//						the literal
+	//		returns:		double -- the value, 0.0 if there is no literal
+	//		History Log:
+	//					10/17/2026 HJ completed version 1.0
+	//					10/17/2026 HJ from_chars(), version 1.1
+	// -------------------------------------------------------------------------
+	double CRPNTokenizer::scanValue(size_t& last) const
+	{
+		const size_t end = m_line.size();
+		size_t i = m_pos;
+		size_t digits = 0;
+		if (i < end && m_line[i] == '-')
+			i++;
+		while (i < end && isDigit(m_line[i]))
+		{
+			i++;
+			digits++;
+		}
+		if (i < end && m_line[i] == '.')
+		{
+			i++;
+			while (i < end && isDigit(m_line[i]))
+			{
+				i++;
+				digits++;
+			}
+		}
+		if (digits == 0)
+		{
+			last = i;
+			return 0.0;
+		}
+		if (i < end && (m_line[i] == 'e' || m_line[i] == 'E'))
+		{
+			size_t j = i + 1;
+			if (j < end && (m_line[j] == '+' || m_line[j] == '-'))
+				j++;
+			if (j < end && isDigit(m_line[j]))
+			{
+				while (j < end && isDigit(m_line[j]))
+					j++;
+				i = j;
+			}
+		}
+
+		last = i;
+
+#if defined(__cpp_lib_to_chars)
+		const char* first = m_line.data() + m_pos;
+		double value = 0.0;
+		if (from_chars(first, first + (i - m_pos), value).ec
+			== errc::result_out_of_range)
+			return outOfRange(first, first + (i - m_pos));
+		return value;
+#else
+		const size_t length = i - m_pos;
+		char literal[64];
+		if (length < sizeof(literal))
+		{
+			memcpy(literal, m_line.data() + m_pos, length);
+			literal[length] = '\0';
+			return strtod(literal, nullptr);
+		}
+		string longLiteral(m_line.substr(m_pos, length));
+		return strtod(longLiteral.c_str(), nullptr);
+#endif
+	}
+}
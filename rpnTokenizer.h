@@ -0,0 +1,110 @@
+//----------------------------------------------------------------------------
+//    File:		rpnTokenizer.h
+//
+//    Class:	CRPNTokenizer
+//----------------------------------------------------------------------------
+#ifndef RPNTOKENIZER_H
+#define RPNTOKENIZER_H
+
+#include <cstddef>
+#include <string_view>
+//----------------------------------------------------------------------------
+//
+//    Title:		RPNTokenizer Class
+//
+//    Description:	This file contains the class definition for CRPNTokenizer,
+//					a single-pass tokenizer over one line of calculator input
+//
+//    Programmer:	Han Jung
+//
+//    Date:			10/17/2026
+//
+//    Version:		1.0
+//
+//    Environment:
+//       Hardware: Intel Xeon PC
+//       Software: Windows 10
+//       Compiles under Microsoft Visual C++ 2017 (/std:c++17)
+//
+//	  class CRPNTokenizer:
+//
+//	  Properties:
+//		string_view m_line -- the line being tokenized (not owned)
+//		size_t m_pos -- cursor into m_line
+//
+//	  Methods:
+//
+//		inline:
+//			size_t position() const;
+//			string_view rest() const;
+//
+//		non-inline:
+//		public:
+//			CRPNTokenizer(string_view line);
+//			bool next(SToken& token);
+//		private:
+//			double scanValue(size_t& last) const;
+//
+//    History Log:
+//			10/17/2026	HJ  linear-time cursor tokenizer, version 1.0
+//			10/17/2026	HJ  numbers take their exponent, version 1.1
+//			10/17/2026	HJ  numbers keep their text, version 1.2
+//			10/17/2026	HJ  named registers, version 1.3
+//			10/17/2026	HJ  rotate by k, version 1.4
+//			10/17/2026	HJ  labels and branches, version 1.5
+//			10/17/2026	HJ  R:name, version 1.6
+// ----------------------------------------------------------------------------
+
+using namespace std;
+
+namespace PB_CALC
+{
+	const int MAXROTATE = 999999999;
+
+	enum TokenType
+	{
+		TOK_NUMBER,		// push value
+		TOK_NEGZERO,	// "-0": push value, then negate it
+		TOK_CLEARALL,	// "CE"
+		TOK_SETREG,		// "S0" - "S9", or "S:name" with reg -1
+		TOK_GETREG,		// "G0" - "G9", or "G:name" with reg -1
+		TOK_ROTATE,		// "U:k" or "D:k": op is 'U' or 'D' and reg is k,
+						// or -1 if k is more than MAXROTATE
+		TOK_LABEL,		// ":name", the name in text
+		TOK_BRANCH,		// "J:name", "<:name", ">:name", "=:name",
+						// "!:name" and "@:name": op is the first
+						// character, in upper case, and the label is in
+						// text; "K0:name" - "K9:name" have op 'K' and
+						// the register in reg
+		TOK_RUNPROGRAM,	// "R:name", a library program, the name in text
+		TOK_OPERATOR	// any other single character, in op
+	};
+
+	struct SToken
+	{
+		TokenType type;
+		double value;
+		string_view text;	// TOK_NUMBER, TOK_NEGZERO: the literal, in the line;
+							// a named register or library program: the
+							// name; a label or branch: the label
+		int reg;
+		char op;
+	};
+
+	class CRPNTokenizer
+	{
+	public:
+		CRPNTokenizer(string_view line);
+		bool next(SToken& token);
+		size_t position() const { return m_pos; }
+		string_view rest() const { return m_line.substr(m_pos); }
+
+	private:
+		double scanValue(size_t& last) const;
+
+		string_view m_line;
+		size_t m_pos;
+	};
+}
+
+#endif
@@ -0,0 +1,686 @@
+#include "rpnVector.h"
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#if defined(__AVX2__)
+#include <immintrin.h>
+#define RPNVECTOR_AVX2
+#elif defined(__SSE2__) || defined(_M_X64) \
+	|| (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define RPNVECTOR_SSE2
+#endif
+//-------------------------------------------------------------------------------------------
+//    Class:		CRPNVector
+//
+//    File:			rpnVector.cpp
+//
+//    Description:	This file contains the function definitions for
+//					CRPNVector and the lane kernels it runs
+//
+//    Programmer:	Han Jung
+//
+//    Date:			10/17/2026
+//
+//    Version:		1.0
+//
+//    Environment:	Intel Xeon PC
+//                  Software:   MS Windows 10 for execution;
+//                  Compiles under Microsoft Visual C++ 2017 (/std:c++17)
+//
+//	  class:		CRPNVector
+//
+//	  Properties:
+//				CRPNEngine m_scalar;
+//				CRPNProgram m_code;
+//				size_t m_rows;
+//				size_t m_depth;
+//				vector<vector<double>> m_stackIn;
+//				vector<double> m_registerIn[NUMREGS];
+//				vector<double> m_registerOut[NUMREGS];
+//				vector<double> m_results;
+//				vector<unsigned char> m_status;
+//				vector<double> m_slots;
+//				vector<double*> m_slotOrder;
+//				vector<unsigned char> m_errors;
+//				size_t m_errorRows;
+//				bool m_vectorized;
+//
+//	  Non-inline Methods:
+//				CRPNVector();
+//				void setProgram(const list<string>& program);
+//				bool loadProgramFile(const string& filename);
+//				void setRows(size_t rows, size_t depth);
+//				void run();
+//
+//				private:
+//					void compile();
+//					bool plan(size_t& maxDepth, size_t& endDepth) const;
+//					void runBlock(size_t first, size_t count,
+//						size_t endDepth);
+//					void runScalar(size_t row);
+//
+//	  related functions:
+//				const char* vectorKernels();
+//
+//    History Log:
+//				10/17/2026	HJ columnar vector mode, version 1.0
+//				10/17/2026	HJ named registers, version 1.1
+//				10/17/2026	HJ rotations by count, version 1.2
+// ----------------------------------------------------------------------------
+namespace PB_CALC
+{
+	namespace
+	{
+		// the lane width of the target; each wrapper is one instruction
+#if defined(RPNVECTOR_AVX2)
+		typedef __m256d vdouble;
+		const size_t VLANES = 4;
+		inline vdouble vload(const double* p) { return _mm256_loadu_pd(p); }
+		inline void vstore(double* p, vdouble v) { _mm256_storeu_pd(p, v); }
+		inline vdouble vset(double d) { return _mm256_set1_pd(d); }
+		inline vdouble vadd(vdouble a, vdouble b) { return _mm256_add_pd(a, b); }
+		inline vdouble vsub(vdouble a, vdouble b) { return _mm256_sub_pd(a, b); }
+		inline vdouble vmul(vdouble a, vdouble b) { return _mm256_mul_pd(a, b); }
+		inline vdouble vdiv(vdouble a, vdouble b) { return _mm256_div_pd(a, b); }
+		inline int vzero(vdouble v)
+		{
+			return _mm256_movemask_pd(
+				_mm256_cmp_pd(v, _mm256_setzero_pd(), _CMP_EQ_OQ));
+		}
+#elif defined(RPNVECTOR_SSE2)
+		typedef __m128d vdouble;
+		const size_t VLANES = 2;
+		inline vdouble vload(const double* p) { return _mm_loadu_pd(p); }
+		inline void vstore(double* p, vdouble v) { _mm_storeu_pd(p, v); }
+		inline vdouble vset(double d) { return _mm_set1_pd(d); }
+		inline vdouble vadd(vdouble a, vdouble b) { return _mm_add_pd(a, b); }
+		inline vdouble vsub(vdouble a, vdouble b) { return _mm_sub_pd(a, b); }
+		inline vdouble vmul(vdouble a, vdouble b) { return _mm_mul_pd(a, b); }
+		inline vdouble vdiv(vdouble a, vdouble b) { return _mm_div_pd(a, b); }
+		inline int vzero(vdouble v)
+		{
+			return _mm_movemask_pd(_mm_cmpeq_pd(v, _mm_setzero_pd()));
+		}
+#endif
+
+		// the arithmetic of add() through mod(); d1 is the top of the
+		// stack, as in binary_prep()
+		struct SAdd
+		{
+			static double lane(double d1, double d2) { return d1 + d2; }
+#if defined(RPNVECTOR_AVX2) || defined(RPNVECTOR_SSE2)
+			static vdouble lanes(vdouble d1, vdouble d2) { return vadd(d1, d2); }
+#endif
+		};
+		struct SSubtract
+		{
+			static double lane(double d1, double d2) { return d1 - d2; }
+#if defined(RPNVECTOR_AVX2) || defined(RPNVECTOR_SSE2)
+			static vdouble lanes(vdouble d1, vdouble d2) { return vsub(d1, d2); }
+#endif
+		};
+		struct SMultiply
+		{
+			static double lane(double d1, double d2) { return d1 * d2; }
+#if defined(RPNVECTOR_AVX2) || defined(RPNVECTOR_SSE2)
+			static vdouble lanes(vdouble d1, vdouble d2) { return vmul(d1, d2); }
+#endif
+		};
+		struct SDivide
+		{
+			static double lane(double d1, double d2) { return d1 / d2; }
+#if defined(RPNVECTOR_AVX2) || defined(RPNVECTOR_SSE2)
+			static vdouble lanes(vdouble d1, vdouble d2) { return vdiv(d1, d2); }
+#endif
+		};
+		// fmod() and pow() have no exact vector form, so their kernels
+		// call the library per lane and only the error masks are SIMD
+		struct SMod
+		{
+			static double lane(double d1, double d2) { return fmod(d1, d2); }
+		};
+		struct SExp
+		{
+			static double lane(double d1, double d2) { return pow(d1, d2); }
+		};
+
+		//--------------------------------------------------------------------
+		//	Function:		binaryKernel(const double* top, double* next,
+		//						size_t n)
+		//	Description:	next[i] = top[i] OP next[i] for n lanes
+		//--------------------------------------------------------------------
+		template <class TOp>
+		void binaryKernel(const double* top, double* next, size_t n)
+		{
+			size_t i = 0;
+#if defined(RPNVECTOR_AVX2) || defined(RPNVECTOR_SSE2)
+			for (; i + VLANES <= n; i += VLANES)
+				vstore(next + i, TOp::lanes(vload(top + i), vload(next + i)));
+#endif
+			for (; i < n; i++)
+				next[i] = TOp::lane(top[i], next[i]);
+		}
+
+		//--------------------------------------------------------------------
+		//	Function:		libraryKernel(const double* top, double* next,
+		//						size_t n)
+		//	Description:	binaryKernel() for ops without a vector form
+		//--------------------------------------------------------------------
+		template <class TOp>
+		void libraryKernel(const double* top, double* next, size_t n)
+		{
+			for (size_t i = 0; i < n; i++)
+				next[i] = TOp::lane(top[i], next[i]);
+		}
+
+		//--------------------------------------------------------------------
+		//	Function:		negKernel(double* top, size_t n)
+		//	Description:	top[i] *= -1.0 for n lanes, as neg() does it (a
+		//					multiply, not a sign flip, so NaNs match)
+		//--------------------------------------------------------------------
+		void negKernel(double* top, size_t n)
+		{
+			size_t i = 0;
+#if defined(RPNVECTOR_AVX2) || defined(RPNVECTOR_SSE2)
+			const vdouble minusOne = vset(-1.0);
+			for (; i + VLANES <= n; i += VLANES)
+				vstore(top + i, vmul(vload(top + i), minusOne));
+#endif
+			for (; i < n; i++)
+				top[i] *= -1.0;
+		}
+
+		//--------------------------------------------------------------------
+		//	Function:		markZero(const double* d2, size_t n,
+		//						unsigned char* errors)
+		//	Description:	sets errors[i] where d2[i] == 0, the divide()
+		//					and mod() error
+		//	Returns:		true if any lane was marked
+		//--------------------------------------------------------------------
+		bool markZero(const double* d2, size_t n, unsigned char* errors)
+		{
+			bool any = false;
+			size_t i = 0;
+#if defined(RPNVECTOR_AVX2) || defined(RPNVECTOR_SSE2)
+			for (; i + VLANES <= n; i += VLANES)
+			{
+				int mask = vzero(vload(d2 + i));
+				if (mask == 0)
+					continue;
+				any = true;
+				for (size_t k = 0; k < VLANES; k++)
+					if (mask & (1 << k))
+						errors[i + k] = 1;
+			}
+#endif
+			for (; i < n; i++)
+				if (d2[i] == 0)
+				{
+					errors[i] = 1;
+					any = true;
+				}
+			return any;
+		}
+
+		//--------------------------------------------------------------------
+		//	Function:		markBothZero(const double* d1, const double* d2,
+		//						size_t n, unsigned char* errors)
+		//	Description:	sets errors[i] where d1[i] and d2[i] are both 0,
+		//					the exp() error
+		//	Returns:		true if any lane was marked
+		//--------------------------------------------------------------------
+		bool markBothZero(const double* d1, const double* d2, size_t n,
+			unsigned char* errors)
+		{
+			bool any = false;
+			size_t i = 0;
+#if defined(RPNVECTOR_AVX2) || defined(RPNVECTOR_SSE2)
+			for (; i + VLANES <= n; i += VLANES)
+			{
+				int mask = vzero(vload(d1 + i)) & vzero(vload(d2 + i));
+				if (mask == 0)
+					continue;
+				any = true;
+				for (size_t k = 0; k < VLANES; k++)
+					if (mask & (1 << k))
+						errors[i + k] = 1;
+			}
+#endif
+			for (; i < n; i++)
+				if (d1[i] == 0 && d2[i] == 0)
+				{
+					errors[i] = 1;
+					any = true;
+				}
+			return any;
+		}
+
+		//--------------------------------------------------------------------
+		//	Function:		binaryLanes(OpCode op, const double* top,
+		//						double* next, size_t n, unsigned char* errors)
+		//	Description:	one binary op over n lanes, with its error mask
+		//	Returns:		true if any lane was marked
+		//--------------------------------------------------------------------
+		bool binaryLanes(OpCode op, const double* top, double* next,
+			size_t n, unsigned char* errors)
+		{
+			bool any = false;
+			switch (op)
+			{
+			case OP_ADD:
+				binaryKernel<SAdd>(top, next, n);
+				break;
+			case OP_SUBTRACT:
+				binaryKernel<SSubtract>(top, next, n);
+				break;
+			case OP_MULTIPLY:
+				binaryKernel<SMultiply>(top, next, n);
+				break;
+			case OP_DIVIDE:
+				any = markZero(next, n, errors);
+				binaryKernel<SDivide>(top, next, n);
+				break;
+			case OP_EXP:
+				any = markBothZero(top, next, n, errors);
+				libraryKernel<SExp>(top, next, n);
+				break;
+			case OP_MOD:
+				any = markZero(next, n, errors);
+				libraryKernel<SMod>(top, next, n);
+				break;
+			default:
+				break;
+			}
+			return any;
+		}
+	}
+	//-------------------------------------------------------------------------
+	//		method:			CRPNVector()
+	//		description:	constructor; no program and no rows
+	//		calls:			n/a
+	//		called by:		embedding code
+	//		parameters:		n/a
+	//		returns:		n/a
+	//		History Log:
+	//					10/17/2026 HJ completed version 1.0
+	// -------------------------------------------------------------------------
+	CRPNVector::CRPNVector() : m_rows(0), m_depth(0), m_errorRows(0),
+		m_vectorized(false)
+	{
+	}
+	//-------------------------------------------------------------------------
+	//		method:			setProgram(const list<string>& program)
+	//		description:	sets the program run over every row
+	//		calls:			CRPNEngine::setProgram()
+	//						compile()
+	//		called by:		embedding code
+	//		parameters:		const list<string>& program -- the program lines
+	//		returns:		n/a
+	//		History Log:
+	//					10/17/2026 HJ completed version 1.0
+	// -------------------------------------------------------------------------
+	void CRPNVector::setProgram(const list<string>& program)
+	{
+		m_scalar.setProgram(program);
+		compile();
+	}
+	//-------------------------------------------------------------------------
+	//		method:			loadProgramFile(const string& filename)
+	//		description:	sets the program run over every row from a file
+	//		calls:			CRPNEngine::loadProgramFile()
+	//						compile()
+	//		called by:		embedding code
+	//		parameters:		const string& filename -- the program file
+	//		returns:		bool -- false if the file could not be opened, in
+	//						which case the program is unchanged
+	//		History Log:
+	//					10/17/2026 HJ completed version 1.0
+	// -------------------------------------------------------------------------
+	bool CRPNVector::loadProgramFile(const string& filename)
+	{
+		if (!m_scalar.loadProgramFile(filename))
+			return false;
+		compile();
+		return true;
+	}
+	//-------------------------------------------------------------------------
+	//		method:			setRows(size_t rows, size_t depth)
+	//		description:	sizes the input columns: depth stack columns and
+	//						NUMREGS register columns of rows lanes, all 0.0
+	//		calls:			n/a
+	//		called by:		embedding code
+	//		parameters:		size_t rows -- number of rows
+	//						size_t depth -- stack values per row
+	//		returns:		n/a
+	//		History Log:
+	//					10/17/2026 HJ completed version 1.0
+	// -------------------------------------------------------------------------
+	void CRPNVector::setRows(size_t rows, size_t depth)
+	{
+		m_rows = rows;
+		m_depth = depth;
+		m_stackIn.assign(depth, vector<double>(rows, 0.0));
+		for (int reg = 0; reg < NUMREGS; reg++)
+			m_registerIn[reg].assign(rows, 0.0);
+	}
+	//-------------------------------------------------------------------------
+	//		method:			run()
+	//		description:	runs the program over every row.  Afterwards
+	//						results(), status() and registerResults() hold
+	//						what each row's engine would hold.
+	//		calls:			plan()
+	//						runBlock()
+	//						runScalar()
+	//		called by:		embedding code
+	//		parameters:		n/a
+	//		returns:		n/a
+	//		History Log:
+	//					10/17/2026 HJ completed version 1.0
+	// -------------------------------------------------------------------------
+	void CRPNVector::run()
+	{
+		m_errorRows = 0;
+		m_results.assign(m_rows, 0.0);
+		m_status.assign(m_rows, static_cast<unsigned char>(EVAL_EMPTY));
+		for (int reg = 0; reg < NUMREGS; reg++)
+			m_registerOut[reg] = m_registerIn[reg];
+
+		size_t maxDepth = 0;
+		size_t endDepth = 0;
+		m_vectorized = plan(maxDepth, endDepth);
+		if (!m_vectorized)
+		{
+			for (size_t row = 0; row < m_rows; row++)
+				runScalar(row);
+			m_errorRows = m_rows;
+			return;
+		}
+
+		m_slots.resize(maxDepth * VECTORBLOCK);
+		m_slotOrder.resize(maxDepth);
+		m_errors.resize(VECTORBLOCK);
+		for (size_t first = 0; first < m_rows; first += VECTORBLOCK)
+			runBlock(first, min(VECTORBLOCK, m_rows - first), endDepth);
+	}
+	//-------------------------------------------------------------------------
+	//		method:			compile()
+	//		description:	compiles the scalar engine's program for the
+	//						kernels, optimized; rows that fail are rerun on
+	//						the scalar engine, so the optimized code only
+	//						has to match while there is no error
+	//		calls:			CRPNProgram::compile()
+	//						CRPNProgram::optimize()
+	//		called by:		setProgram()
+	//						loadProgramFile()
+	//		parameters:		n/a
+	//		returns:		n/a
+	//		History Log:
+	//					10/17/2026 HJ completed version 1.0
+	//					10/17/2026 HJ the scalar engine's register names,
+	//						version 1.1
+	//					10/17/2026 HJ no library: R:name compiles to an
+	//						error, which sends the program to the scalar
+	//						engine, version 1.2
+	// -------------------------------------------------------------------------
+	void CRPNVector::compile()
+	{
+		CRPNProgram source;
+		source.compile(m_scalar.program(), m_scalar.registerNames(), nullptr);
+		m_code.optimize(source);
+	}
+	//-------------------------------------------------------------------------
+	//		method:			plan(size_t& maxDepth, size_t& endDepth)
+	//		description:	follows the stack depth through the program,
+	//						starting from m_depth.  Without errors the depth
+	//						does not depend on the values, so one walk
+	//						covers every row.
+	//		calls:			n/a
+	//		called by:		run()
+	//		parameters:		size_t& maxDepth -- receives the deepest point
+	//						size_t& endDepth -- receives the final depth
+	//		returns:		bool -- false if some op would fail on every row
+	//						or needs the scalar engine
+	//		History Log:
+	//					10/17/2026 HJ completed version 1.0
+	//					10/17/2026 HJ named registers, version 1.1
+	//					10/17/2026 HJ mapped programs, version 1.2
+	// -------------------------------------------------------------------------
+	bool CRPNVector::plan(size_t& maxDepth, size_t& endDepth) const
+	{
+		size_t depth = m_depth;
+		maxDepth = depth;
+		for (size_t i = 0; i < m_code.size(); i++)
+		{
+			const SInstruction& instruction = m_code.code()[i];
+			switch (instruction.op)
+			{
+			case OP_GETREG:
+				// named registers have no columns
+				if (instruction.arg >= NUMREGS)
+					return false;
+				depth++;
+				maxDepth = max(maxDepth, depth);
+				break;
+			case OP_PUSH:
+			case OP_NEGZERO:
+				depth++;
+				maxDepth = max(maxDepth, depth);
+				break;
+			case OP_ADD:
+			case OP_SUBTRACT:
+			case OP_MULTIPLY:
+			case OP_DIVIDE:
+			case OP_EXP:
+			case OP_MOD:
+				if (depth < 2)
+					return false;
+				depth--;
+				break;
+			case OP_ADDCONST:
+			case OP_SUBTRACTCONST:
+			case OP_MULTIPLYCONST:
+			case OP_DIVIDECONST:
+			case OP_EXPCONST:
+			case OP_MODCONST:
+				// the constant needs a slot of its own for a moment
+				if (depth < 1)
+					return false;
+				maxDepth = max(maxDepth, depth + 1);
+				break;
+			case OP_SETREG:
+				if (depth < 1 || instruction.arg >= NUMREGS)
+					return false;
+				break;
+			case OP_NEG:
+			case OP_ROTATEDOWN:
+			case OP_ROTATEUP:
+				if (depth < 1)
+					return false;
+				break;
+			case OP_CLEARENTRY:
+				if (depth > 0)
+					depth--;
+				break;
+			case OP_CLEARALL:
+				depth = 0;
+				break;
+			default:
+				return false;
+			}
+		}
+		endDepth = depth;
+		return true;
+	}
+	//-------------------------------------------------------------------------
+	//		method:			runBlock(size_t first, size_t count,
+	//							size_t endDepth)
+	//		description:	runs the program over rows first to
+	//						first + count - 1 with the kernels.  Stack slots
+	//						are moved by pointer, so rotations and pops copy
+	//						no lanes.  Lanes marked in the error mask are
+	//						rerun on the scalar engine.
+	//		calls:			binaryLanes()
+	//						negKernel()
+	//						runScalar()
+	//		called by:		run()
+	//		parameters:		size_t first -- first row of the block
+	//						size_t count -- rows in the block
+	//						size_t endDepth -- stack depth at the end
+	//		returns:		n/a
+	//		History Log:
+	//					10/17/2026 HJ completed version 1.0
+	//					10/17/2026 HJ rotations by count, D fixed, version 1.1
+	//					10/17/2026 HJ mapped programs, version 1.2
+	// -------------------------------------------------------------------------
+	void CRPNVector::runBlock(size_t first, size_t count, size_t endDepth)
+	{
+		double** slot = m_slotOrder.data();
+		for (size_t s = 0; s < m_slotOrder.size(); s++)
+			slot[s] = m_slots.data() + s * VECTORBLOCK;
+		const size_t bytes = count * sizeof(double);
+		for (size_t s = 0; s < m_depth; s++)
+			memcpy(slot[s], m_stackIn[s].data() + first, bytes);
+		double* reg[NUMREGS];
+		for (int r = 0; r < NUMREGS; r++)
+			reg[r] = m_registerOut[r].data() + first;
+		unsigned char* errors = m_errors.data();
+		memset(errors, 0, count);
+		bool anyError = false;
+
+		const double* const constants = m_code.constants();
+		size_t depth = m_depth;
+		for (size_t i = 0; i < m_code.size(); i++)
+		{
+			const SInstruction& instruction = m_code.code()[i];
+			switch (instruction.op)
+			{
+			case OP_PUSH:
+				fill(slot[depth], slot[depth] + count,
+					constants[instruction.arg]);
+				depth++;
+				break;
+			case OP_NEGZERO:
+				fill(slot[depth], slot[depth] + count,
+					constants[instruction.arg] * -1.0);
+				depth++;
+				break;
+			case OP_ADD:
+			case OP_SUBTRACT:
+			case OP_MULTIPLY:
+			case OP_DIVIDE:
+			case OP_EXP:
+			case OP_MOD:
+				anyError = binaryLanes(instruction.op, slot[depth - 1],
+					slot[depth - 2], count, errors) || anyError;
+				depth--;
+				break;
+			case OP_ADDCONST:
+			case OP_SUBTRACTCONST:
+			case OP_MULTIPLYCONST:
+			case OP_DIVIDECONST:
+			case OP_EXPCONST:
+			case OP_MODCONST:
+				// the pushed constant is the top operand
+				fill(slot[depth], slot[depth] + count,
+					constants[instruction.arg]);
+				anyError = binaryLanes(static_cast<OpCode>(OP_ADD
+					+ (instruction.op - OP_ADDCONST)), slot[depth],
+					slot[depth - 1], count, errors) || anyError;
+				break;
+			case OP_NEG:
+				negKernel(slot[depth - 1], count);
+				break;
+			case OP_CLEARENTRY:
+				if (depth > 0)
+					depth--;
+				break;
+			case OP_CLEARALL:
+				depth = 0;
+				break;
+			case OP_ROTATEDOWN:
+				// the bottom k slots go to the top
+				rotate(slot, slot + instruction.arg % depth, slot + depth);
+				break;
+			case OP_ROTATEUP:
+				// the top k slots go to the bottom
+				rotate(slot, slot + (depth - instruction.arg % depth),
+					slot + depth);
+				break;
+			case OP_SETREG:
+				memcpy(reg[instruction.arg], slot[depth - 1], bytes);
+				break;
+			case OP_GETREG:
+				memcpy(slot[depth], reg[instruction.arg], bytes);
+				depth++;
+				break;
+			default:
+				// plan() sends programs with any other op to runScalar()
+				break;
+			}
+		}
+
+		if (endDepth > 0)
+		{
+			memcpy(m_results.data() + first, slot[endDepth - 1], bytes);
+			memset(m_status.data() + first, EVAL_OK, count);
+		}
+		if (anyError)
+			for (size_t i = 0; i < count; i++)
+				if (errors[i])
+				{
+					runScalar(first + i);
+					m_errorRows++;
+				}
+	}
+	//-------------------------------------------------------------------------
+	//		method:			runScalar(size_t row)
+	//		description:	runs one row on the scalar engine and stores its
+	//						result and registers
+	//		calls:			CRPNEngine::reset()
+	//						CRPNEngine::push()
+	//						CRPNEngine::setRegister()
+	//						CRPNEngine::evaluate()
+	//						CRPNEngine::registerValue()
+	//		called by:		run()
+	//						runBlock()
+	//		parameters:		size_t row -- the row
+	//		returns:		n/a
+	//		History Log:
+	//					10/17/2026 HJ completed version 1.0
+	// -------------------------------------------------------------------------
+	void CRPNVector::runScalar(size_t row)
+	{
+		m_scalar.reset();
+		for (size_t s = 0; s < m_depth; s++)
+			m_scalar.push(m_stackIn[s][row]);
+		for (int reg = 0; reg < NUMREGS; reg++)
+			m_scalar.setRegister(reg, m_registerIn[reg][row]);
+		double top = 0.0;
+		EvalResult result = m_scalar.evaluate("R", top);
+		m_status[row] = static_cast<unsigned char>(result);
+		m_results[row] = (result == EVAL_OK) ? top : 0.0;
+		for (int reg = 0; reg < NUMREGS; reg++)
+			m_registerOut[reg][row] = m_scalar.registerValue(reg);
+	}
+	//-------------------------------------------------------------------------
+	//		function:		vectorKernels()
+	//		description:	names the kernels this build runs
+	//		calls:			n/a
+	//		called by:		benchVector()
+	//		parameters:		n/a
+	//		returns:		const char* -- "AVX2", "SSE2" or "scalar"
+	//		History Log:
+	//					10/17/2026 HJ completed version 1.0
+	// -------------------------------------------------------------------------
+	const char* vectorKernels()
+	{
+#if defined(RPNVECTOR_AVX2)
+		return "AVX2";
+#elif defined(RPNVECTOR_SSE2)
+		return "SSE2";
+#else
+		return "scalar";
+#endif
+	}
+}
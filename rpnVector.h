@@ -0,0 +1,157 @@
+//----------------------------------------------------------------------------
+//    File:		rpnVector.h
+//
+//    Class:	CRPNVector
+//----------------------------------------------------------------------------
+#ifndef RPNVECTOR_H
+#define RPNVECTOR_H
+
+#include <cstddef>
+#include <list>
+#include <string>
+#include <vector>
+#include "rpnEngine.h"
+#include "rpnProgram.h"
+//----------------------------------------------------------------------------
+//
+//    Title:		RPNVector Class
+//
+//    Description:	This file contains the class definition for CRPNVector,
+//					the columnar "vector mode".  One recorded program is
+//					run over many rows at once: every stack slot and every
+//					register is a column with one lane per row, and each
+//					compiled op runs as a SIMD kernel over VECTORBLOCK
+//					lanes at a time (AVX2 or SSE2 when the compiler
+//					targets them, plain loops otherwise).
+//
+//					A row gives the same result as a CRPNEngine that
+//					starts from the row's stack and registers and runs
+//					'R'.  Divide and mod by zero and 0^0 are found lane by
+//					lane with error masks; a lane that hit one is rerun on
+//					a scalar engine, so its result, error and registers
+//					match the engine exactly.  A program whose stack
+//					depth does not work out the same for every row (an
+//					underflow, or L, P, R, F, H, X inside it) runs every
+//					row on the scalar engine.  So does a program that uses
+//					a named register: only S0-S9 have columns, and named
+//					registers start each row at 0.0.
+//
+//    Programmer:	Han Jung
+//
+//    Date:			10/17/2026
+//
+//    Version:		1.0
+//
+//    Environment:
+//       Hardware: Intel Xeon PC
+//       Software: Windows 10
+//       Compiles under Microsoft Visual C++ 2017 (/std:c++17)
+//       /arch:AVX2 (MSVC) or -mavx2 (GCC, Clang) selects the AVX2 kernels
+//
+//	  class CRPNVector:
+//
+//	  Properties:
+//		CRPNEngine m_scalar -- runs rows the kernels cannot
+//		CRPNProgram m_code -- the program, compiled and optimized
+//		size_t m_rows -- number of rows
+//		size_t m_depth -- stack values per row on entry
+//		vector<vector<double>> m_stackIn -- input stack columns, bottom first
+//		vector<double> m_registerIn[NUMREGS] -- input register columns
+//		vector<double> m_registerOut[NUMREGS] -- register columns after run()
+//		vector<double> m_results -- top of each row's stack after run()
+//		vector<unsigned char> m_status -- EvalResult of each row
+//		vector<double> m_slots -- VECTORBLOCK lanes per stack slot
+//		vector<double*> m_slotOrder -- the slots from the bottom up
+//		vector<unsigned char> m_errors -- error mask of the current block
+//		size_t m_errorRows -- rows the last run() sent to m_scalar
+//		bool m_vectorized -- the last run() used the kernels
+//
+//	  Methods:
+//
+//		inline:
+//			size_t rows() const;
+//			size_t depth() const;
+//			double* stackColumn(size_t slot);
+//			double* registerColumn(int reg);
+//			const double* results() const;
+//			const unsigned char* status() const;
+//			const double* registerResults(int reg) const;
+//			size_t errorRows() const;
+//			bool vectorized() const;
+//
+//		non-inline:
+//		public:
+//			CRPNVector();
+//			void setProgram(const list<string>& program);
+//			bool loadProgramFile(const string& filename);
+//			void setRows(size_t rows, size_t depth);
+//			void run();
+//		private:
+//			void compile();
+//			bool plan(size_t& maxDepth, size_t& endDepth) const;
+//			void runBlock(size_t first, size_t count, size_t endDepth);
+//			void runScalar(size_t row);
+//
+//	  related functions:
+//			const char* vectorKernels();
+//
+//    History Log:
+//			10/17/2026	HJ  columnar vector mode, version 1.0
+//			10/17/2026	HJ  named registers, version 1.1
+// ----------------------------------------------------------------------------
+
+using namespace std;
+
+namespace PB_CALC
+{
+	const size_t VECTORBLOCK = 1024;	// lanes per kernel call
+
+	class CRPNVector
+	{
+	public:
+		CRPNVector();
+		void setProgram(const list<string>& program);
+		bool loadProgramFile(const string& filename);
+		void setRows(size_t rows, size_t depth);
+		void run();
+
+		size_t rows() const { return m_rows; }
+		size_t depth() const { return m_depth; }
+		// slot 0 is the bottom of the stack
+		double* stackColumn(size_t slot) { return m_stackIn[slot].data(); }
+		double* registerColumn(int reg) { return m_registerIn[reg].data(); }
+		const double* results() const { return m_results.data(); }
+		const unsigned char* status() const { return m_status.data(); }
+		const double* registerResults(int reg) const
+		{
+			return m_registerOut[reg].data();
+		}
+		size_t errorRows() const { return m_errorRows; }
+		bool vectorized() const { return m_vectorized; }
+
+	private:
+		void compile();
+		bool plan(size_t& maxDepth, size_t& endDepth) const;
+		void runBlock(size_t first, size_t count, size_t endDepth);
+		void runScalar(size_t row);
+
+		CRPNEngine m_scalar;
+		CRPNProgram m_code;
+		size_t m_rows;
+		size_t m_depth;
+		vector<vector<double>> m_stackIn;
+		vector<double> m_registerIn[NUMREGS];
+		vector<double> m_registerOut[NUMREGS];
+		vector<double> m_results;
+		vector<unsigned char> m_status;
+		vector<double> m_slots;
+		vector<double*> m_slotOrder;
+		vector<unsigned char> m_errors;
+		size_t m_errorRows;
+		bool m_vectorized;
+	};
+
+	const char* vectorKernels();
+}
+
+#endif